@@ -0,0 +1,142 @@
+/**
+ * @file BenchmarkRunner.cpp
+ * Implements the BenchmarkState and BenchmarkRunner classes.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <iostream>
+#include <algorithm>
+#include "BenchmarkRunner.h"
+
+BenchmarkState::BenchmarkState( const TIterations iterations, const TArgument argument ) : m_maximumIterations( iterations ),
+                                                                                          m_remainingIterations( iterations ),
+                                                                                          m_argument( argument ),
+                                                                                          m_bytesPerIteration( 0 )
+{
+}
+
+BenchmarkRunner::BenchmarkRunner( void ) : m_minimumTime( 200 ), m_csvOutput( false )
+{
+}
+
+bool
+BenchmarkRunner::ParseArguments( int argc, char **argv )
+{
+    int option;
+    while ( ( option = getopt( argc, argv, "f:m:cl" ) ) != -1 )
+    {
+        switch ( option )
+        {
+            case 'f':
+                this->m_filter = optarg;
+                break;
+            case 'm':
+                this->m_minimumTime = std::chrono::milliseconds( std::stoul( optarg ) );
+                break;
+            case 'c':
+                this->m_csvOutput = true;
+                break;
+            case 'l':
+                for ( auto benchmark : this->m_benchmarks )
+                {
+                    std::cout << benchmark.name << std::endl;
+                }
+                return ( false );
+            default:
+                std::cerr << "Usage: " << argv[0] << " [-f <filter>] [-m <minimum time in ms>] [-c] [-l]" << std::endl;
+                return ( false );
+        }
+    }
+    return ( true );
+}
+
+void
+BenchmarkRunner::Register( const std::string & name, TBenchmarkFunction function )
+{
+    this->Register( name, function, TArguments() );
+}
+
+void
+BenchmarkRunner::Register( const std::string & name, TBenchmarkFunction function, const TArguments & arguments )
+{
+    Benchmark benchmark;
+    benchmark.name = name;
+    benchmark.function = function;
+    benchmark.arguments = arguments;
+    this->m_benchmarks.push_back( benchmark );
+}
+
+void
+BenchmarkRunner::Run( const Benchmark & benchmark, const BenchmarkState::TArgument argument, const std::string & name ) const
+{
+    const BenchmarkState::TIterations maximumIterations = 1000000000ULL;
+    const double minimumTime = std::chrono::duration<double>( this->m_minimumTime ).count();
+
+    BenchmarkState::TIterations iterations = 1;
+    while ( true )
+    {
+        BenchmarkState state( iterations, argument );
+        benchmark.function( state );
+
+        double elapsedTime = std::chrono::duration<double>( state.GetElapsedTime() ).count();
+        if ( elapsedTime >= minimumTime || iterations >= maximumIterations )
+        {
+            double timePerIteration = elapsedTime * 1e9 / iterations;
+            double bytesPerSecond = elapsedTime > 0.0 ? state.GetBytesPerIteration() * ( double )iterations / elapsedTime : 0.0;
+            if ( this->m_csvOutput )
+            {
+                std::printf( "%s,%llu,%.3f,%.0f\n", name.c_str(), iterations, timePerIteration, bytesPerSecond );
+            }
+            else if ( state.GetBytesPerIteration() > 0 )
+            {
+                std::printf( "%-52s %14.2f ns/op %12llu %10.2f MB/s\n", name.c_str(), timePerIteration, iterations, bytesPerSecond / 1e6 );
+            }
+            else
+            {
+                std::printf( "%-52s %14.2f ns/op %12llu\n", name.c_str(), timePerIteration, iterations );
+            }
+            std::fflush( stdout );
+            return;
+        }
+
+        double multiplier = elapsedTime > 0.0 ? minimumTime * 1.4 / elapsedTime : 10.0;
+        multiplier = std::max( std::min( multiplier, 10.0 ), 2.0 );
+        iterations = std::min( ( BenchmarkState::TIterations )( iterations * multiplier ), maximumIterations );
+    }
+}
+
+void
+BenchmarkRunner::RunAll( void ) const
+{
+    if ( this->m_csvOutput )
+    {
+        std::printf( "name,iterations,ns_per_op,bytes_per_second\n" );
+    }
+    else
+    {
+        std::printf( "%-52s %20s %12s %15s\n", "Benchmark", "Time", "Iterations", "Throughput" );
+    }
+
+    for ( auto benchmark : this->m_benchmarks )
+    {
+        if ( benchmark.arguments.empty() )
+        {
+            if ( benchmark.name.find( this->m_filter ) != std::string::npos )
+            {
+                this->Run( benchmark, 0, benchmark.name );
+            }
+            continue;
+        }
+        for ( auto argument : benchmark.arguments )
+        {
+            std::string name = benchmark.name + "/" + std::to_string( argument );
+            if ( name.find( this->m_filter ) != std::string::npos )
+            {
+                this->Run( benchmark, argument, name );
+            }
+        }
+    }
+}
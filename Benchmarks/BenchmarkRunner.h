@@ -0,0 +1,296 @@
+/**
+ * @file BenchmarkRunner.h
+ * Defines the BenchmarkState and BenchmarkRunner classes used by the S2Sim microbenchmarks.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef BENCHMARKRUNNER_H_
+#define BENCHMARKRUNNER_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+
+/**
+ *  Prevents the compiler from optimizing away a value computed by a benchmark.
+ *
+ *  @param value Value that must be materialized.
+ */
+template <typename TValue>
+inline void
+DoNotOptimize( const TValue & value )
+{
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+}
+
+/**
+ *  Prevents the compiler from caching memory contents across the point of the call.
+ */
+inline void
+ClobberMemory( void )
+{
+    asm volatile( "" : : : "memory" );
+}
+
+/**
+ *  @brief Iteration state of a single benchmark run, modeled after benchmark::State of Google Benchmark.
+
+    The benchmark body loops with while ( state.KeepRunning() ) and reports the number of bytes handled per iteration with SetBytesPerIteration. Work done before the first KeepRunning call is not measured.
+ */
+class BenchmarkState
+{
+    public:
+    /**
+     *  Defines the iteration counter type.
+     */
+        typedef unsigned long long TIterations;
+
+    /**
+     *  Defines the type of the benchmark argument.
+     */
+        typedef unsigned long long TArgument;
+
+    /**
+     *  Defines the byte counter type.
+     */
+        typedef unsigned long long TBytes;
+
+    /**
+     *  Defines the clock used for the measurements.
+     */
+        typedef std::chrono::steady_clock TClock;
+
+    private:
+    /**
+     *  Number of iterations to be run.
+     */
+        TIterations m_maximumIterations;
+
+    /**
+     *  Number of iterations left.
+     */
+        TIterations m_remainingIterations;
+
+    /**
+     *  Argument of the benchmark, e.g. the payload size.
+     */
+        TArgument m_argument;
+
+    /**
+     *  Bytes processed in each iteration.
+     */
+        TBytes m_bytesPerIteration;
+
+    /**
+     *  Time of the first KeepRunning call.
+     */
+        TClock::time_point m_startTime;
+
+    /**
+     *  Time of the last KeepRunning call.
+     */
+        TClock::time_point m_endTime;
+
+    public:
+    /**
+     *  Creates the state for a run.
+     *
+     *  @param iterations Number of iterations to be run.
+     *  @param argument   Argument of the benchmark.
+     */
+        BenchmarkState( const TIterations iterations, const TArgument argument );
+
+    /**
+     *  Starts the clock on the first call and stops it after the last iteration.
+     *
+     *  @return True while there are iterations left.
+     */
+        bool
+        KeepRunning( void )
+        {
+            if ( this->m_remainingIterations == this->m_maximumIterations )
+            {
+                this->m_startTime = TClock::now();
+            }
+            if ( this->m_remainingIterations == 0 )
+            {
+                this->m_endTime = TClock::now();
+                return ( false );
+            }
+            --this->m_remainingIterations;
+            return ( true );
+        }
+
+    /**
+     *  Returns the argument of the benchmark.
+     *
+     *  @return Argument of the benchmark.
+     */
+        TArgument
+        GetArgument( void ) const
+        {
+            return ( this->m_argument );
+        }
+
+    /**
+     *  Sets the number of bytes processed in each iteration for the throughput report.
+     *
+     *  @param bytes Bytes per iteration.
+     */
+        void
+        SetBytesPerIteration( const TBytes bytes )
+        {
+            this->m_bytesPerIteration = bytes;
+        }
+
+    /**
+     *  Returns the number of bytes processed in each iteration.
+     *
+     *  @return Bytes per iteration.
+     */
+        TBytes
+        GetBytesPerIteration( void ) const
+        {
+            return ( this->m_bytesPerIteration );
+        }
+
+    /**
+     *  Returns the number of iterations of the run.
+     *
+     *  @return Number of iterations.
+     */
+        TIterations
+        GetIterations( void ) const
+        {
+            return ( this->m_maximumIterations );
+        }
+
+    /**
+     *  Returns the measured time of the run.
+     *
+     *  @return Time between the first and the last KeepRunning call.
+     */
+        TClock::duration
+        GetElapsedTime( void ) const
+        {
+            return ( this->m_endTime - this->m_startTime );
+        }
+};
+
+/**
+ *  @brief Registers benchmarks, calibrates the number of iterations and prints the results.
+
+    Each benchmark is run once per argument. The iteration count is increased until a run takes at least the minimum time, and the report contains the time per operation and the throughput for benchmarks that set their bytes per iteration.
+ */
+class BenchmarkRunner
+{
+    public:
+    /**
+     *  Defines the benchmark body type.
+     */
+        typedef std::function<void( BenchmarkState & )> TBenchmarkFunction;
+
+    /**
+     *  Defines the list of arguments of a benchmark.
+     */
+        typedef std::vector<BenchmarkState::TArgument> TArguments;
+
+    private:
+    /**
+     *  Registered benchmark.
+     */
+        struct Benchmark
+        {
+            /**
+             *  Name of the benchmark.
+             */
+            std::string name;
+
+            /**
+             *  Body of the benchmark.
+             */
+            TBenchmarkFunction function;
+
+            /**
+             *  Arguments the benchmark is run with. Empty for benchmarks without argument.
+             */
+            TArguments arguments;
+        };
+
+    /**
+     *  Registered benchmarks in the order of registration.
+     */
+        std::vector<Benchmark> m_benchmarks;
+
+    /**
+     *  Minimum measured time of a run.
+     */
+        std::chrono::milliseconds m_minimumTime;
+
+    /**
+     *  Only the benchmarks with a name containing this string are run.
+     */
+        std::string m_filter;
+
+    /**
+     *  Prints comma separated values instead of a table.
+     */
+        bool m_csvOutput;
+
+    private:
+    /**
+     *  Runs a benchmark with an argument until the minimum time is reached and prints the result.
+     *
+     *  @param benchmark Benchmark to be run.
+     *  @param argument  Argument of the run.
+     *  @param name      Name printed in the report.
+     */
+        void
+        Run( const Benchmark & benchmark, const BenchmarkState::TArgument argument, const std::string & name ) const;
+
+    public:
+    /**
+     *  Creates a runner with a minimum run time of 200 ms.
+     */
+        BenchmarkRunner( void );
+
+    /**
+     *  Parses the common command line options: -f <filter>, -m <milliseconds>, -c for csv output and -l to list the benchmarks.
+     *
+     *  @param argc Number of arguments.
+     *  @param argv Arguments.
+     *
+     *  @return False if the program should exit without running the benchmarks.
+     */
+        bool
+        ParseArguments( int argc, char **argv );
+
+    /**
+     *  Registers a benchmark that does not take an argument.
+     *
+     *  @param name     Name of the benchmark.
+     *  @param function Body of the benchmark.
+     */
+        void
+        Register( const std::string & name, TBenchmarkFunction function );
+
+    /**
+     *  Registers a benchmark that is run once per argument.
+     *
+     *  @param name      Name of the benchmark, the argument is appended as /argument.
+     *  @param function  Body of the benchmark.
+     *  @param arguments Arguments of the benchmark.
+     */
+        void
+        Register( const std::string & name, TBenchmarkFunction function, const TArguments & arguments );
+
+    /**
+     *  Runs all the registered benchmarks matching the filter.
+     */
+        void
+        RunAll( void ) const;
+};
+
+#endif /* BENCHMARKRUNNER_H_ */
@@ -0,0 +1,154 @@
+/**
+ * @file ByteOrderBenchmark.cpp
+ * Microbenchmarks of the array byte order conversion kernels.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "BenchmarkRunner.h"
+#include "LogPrint.h"
+#include "MessageHeader.h"
+#include "ByteOrderConverter.h"
+
+using namespace TerraSwarm;
+
+/**
+ *  Number of elements in the converted arrays.
+ */
+static const BenchmarkRunner::TArguments ArraySizes = { 16, 1000, 10000 };
+
+/**
+ *  Creates increasing values as an arbitrary array.
+ *
+ *  @param numberOfElements Number of elements.
+ *
+ *  @return Values.
+ */
+static std::vector<unsigned int>
+CreateValues( const BenchmarkState::TArgument numberOfElements )
+{
+    std::vector<unsigned int> values( numberOfElements );
+    for ( size_t index = 0; index < values.size(); ++index )
+    {
+        values[index] = 1000 + ( unsigned int )index;
+    }
+    return ( values );
+}
+
+/**
+ *  Checks a kernel against htonl before it is measured.
+ *
+ *  @param kernel Kernel to be checked.
+ *
+ *  @return true if every tested length converts correctly.
+ */
+static bool
+VerifyKernel( const ByteOrderConverter::TKernel kernel )
+{
+    for ( BenchmarkState::TArgument numberOfElements = 0; numberOfElements < 70; ++numberOfElements )
+    {
+        std::vector<unsigned int> values = CreateValues( numberOfElements );
+        std::vector<char> buffer( MessageHeader::MessageHeaderSize + numberOfElements * sizeof( unsigned int ) );
+        ByteOrderConverter::Convert( kernel, buffer.data() + MessageHeader::MessageHeaderSize, values.data(), numberOfElements );
+        for ( size_t index = 0; index < numberOfElements; ++index )
+        {
+            unsigned int value;
+            memcpy( &value, buffer.data() + MessageHeader::MessageHeaderSize + index * sizeof( value ), sizeof( value ) );
+            if ( value != htonl( values[index] ) )
+            {
+                return ( false );
+            }
+        }
+    }
+    return ( true );
+}
+
+/**
+ *  Registers the benchmarks of the kernels. The arrays are written behind a message header, like the payloads of the messages.
+ *
+ *  @param runner Benchmark runner.
+ *
+ *  @return false if a kernel converts incorrectly.
+ */
+static bool
+RegisterKernelBenchmarks( BenchmarkRunner & runner )
+{
+    runner.Register( "ByteOrderConverter/PerElementHtonl", []( BenchmarkState & state )
+    {
+        std::vector<unsigned int> values = CreateValues( state.GetArgument() );
+        std::vector<char> buffer( MessageHeader::MessageHeaderSize + values.size() * sizeof( unsigned int ) );
+        state.SetBytesPerIteration( values.size() * sizeof( unsigned int ) );
+        while ( state.KeepRunning() )
+        {
+            char* currentPointer = buffer.data() + MessageHeader::MessageHeaderSize;
+            for ( size_t index = 0; index < values.size(); ++index )
+            {
+                unsigned int convertedValue = htonl( values[index] );
+                memcpy( currentPointer, &convertedValue, sizeof( convertedValue ) );
+                currentPointer += sizeof( convertedValue );
+            }
+            ClobberMemory();
+        }
+    }, ArraySizes );
+
+    for ( ByteOrderConverter::TKernel kernel = 0; kernel < ByteOrderConverter::NumberOfKernels; ++kernel )
+    {
+        if ( !ByteOrderConverter::IsKernelSupported( kernel ) )
+        {
+            continue;
+        }
+        if ( !VerifyKernel( kernel ) )
+        {
+            std::cerr << ByteOrderConverter::GetKernelName( kernel ) << " kernel converts incorrectly" << std::endl;
+            return ( false );
+        }
+
+        std::string name = std::string( "ByteOrderConverter/" ) + ByteOrderConverter::GetKernelName( kernel );
+        runner.Register( name, [kernel]( BenchmarkState & state )
+        {
+            std::vector<unsigned int> values = CreateValues( state.GetArgument() );
+            std::vector<char> buffer( MessageHeader::MessageHeaderSize + values.size() * sizeof( unsigned int ) );
+            state.SetBytesPerIteration( values.size() * sizeof( unsigned int ) );
+            while ( state.KeepRunning() )
+            {
+                ByteOrderConverter::Convert( kernel, buffer.data() + MessageHeader::MessageHeaderSize, values.data(), values.size() );
+                ClobberMemory();
+            }
+        }, ArraySizes );
+
+        runner.Register( name + "/InPlace", [kernel]( BenchmarkState & state )
+        {
+            std::vector<unsigned int> values = CreateValues( state.GetArgument() );
+            state.SetBytesPerIteration( values.size() * sizeof( unsigned int ) );
+            while ( state.KeepRunning() )
+            {
+                ByteOrderConverter::Convert( kernel, values.data(), values.data(), values.size() );
+                ClobberMemory();
+            }
+        }, ArraySizes );
+    }
+    return ( true );
+}
+
+int
+main( int argc, char **argv )
+{
+    LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::NoLogging );
+
+    BenchmarkRunner runner;
+    if ( !RegisterKernelBenchmarks( runner ) )
+    {
+        return ( EXIT_FAILURE );
+    }
+    std::cout << "Selected kernel: " << ByteOrderConverter::GetKernelName( ByteOrderConverter::GetKernel() ) << std::endl;
+
+    if ( !runner.ParseArguments( argc, argv ) )
+    {
+        return ( EXIT_SUCCESS );
+    }
+    runner.RunAll();
+    return ( EXIT_SUCCESS );
+}
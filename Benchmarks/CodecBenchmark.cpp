@@ -0,0 +1,837 @@
+/**
+ * @file CodecBenchmark.cpp
+ * Microbenchmarks of the TerraswarmLibrary message encoders and decoders.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <vector>
+#include <string>
+#include "BenchmarkRunner.h"
+#include "LogPrint.h"
+#include "MessageHeader.h"
+#include "MessageEnder.h"
+#include "SequenceCounter.h"
+#include "ClientConnectionRequest.h"
+#include "ClientConnectionResponse.h"
+#include "ClientData.h"
+#include "PayloadEncoding.h"
+#include "DemandNegotiation.h"
+#include "GetPrice.h"
+#include "PriceProposal.h"
+#include "RegulationClientRegisterRequest.h"
+#include "SetCurrentPrice.h"
+#include "SystemTimePrompt.h"
+#include "SystemVersionPrompt.h"
+
+using namespace TerraSwarm;
+
+/**
+ *  Sender id used in all the messages, the id of S2Sim.
+ */
+static const MessageHeader::TSenderId SenderId = 0;
+
+/**
+ *  Receiver id used in all the messages.
+ */
+static const MessageHeader::TReceiverId ReceiverId = 1;
+
+/**
+ *  Number of points in the data and price payloads.
+ */
+static const BenchmarkRunner::TArguments PayloadSizes = { 1, 24, 96, 288, 1440, 10000 };
+
+/**
+ *  Number of points in the extended data payloads, up to a week of minutes.
+ */
+static const BenchmarkRunner::TArguments HorizonSizes = { 1, 24, 96, 1440, 10080 };
+
+/**
+ *  Lengths of the client names.
+ */
+static const BenchmarkRunner::TArguments NameLengths = { 4, 16, 64 };
+
+/**
+ *  Calculates the size of a message on the wire.
+ *
+ *  @param message Complete message.
+ *
+ *  @return Size of the header, the data and the EOM field.
+ */
+template <typename TMessage>
+static TDataSize
+GetMessageSize( const SmartPointer<TMessage> & message )
+{
+    return ( MessageHeader::MessageHeaderSize + ( ( MessageHeader* )message )->GetDataSize() + MessageEnder::EndOfMessageSize );
+}
+
+/**
+ *  Creates increasing data points as an arbitrary payload.
+ *
+ *  @param numberOfPoints Number of points.
+ *
+ *  @return Data points.
+ */
+static std::vector<unsigned int>
+CreatePoints( const BenchmarkState::TArgument numberOfPoints )
+{
+    std::vector<unsigned int> points( numberOfPoints );
+    for ( size_t index = 0; index < points.size(); ++index )
+    {
+        points[index] = 1000 + ( unsigned int )index;
+    }
+    return ( points );
+}
+
+/**
+ *  Measures a message factory.
+ *
+ *  @param state   Benchmark state.
+ *  @param factory Creates a complete message.
+ */
+template <typename TFactory>
+static void
+EncodeMessage( BenchmarkState & state, TFactory factory )
+{
+    state.SetBytesPerIteration( GetMessageSize( factory() ) );
+    while ( state.KeepRunning() )
+    {
+        auto message = factory();
+        DoNotOptimize( message );
+    }
+}
+
+/**
+ *  Reads the header fields and checks the EOM field, which S2Sim does for every received message.
+ *
+ *  @param message Received message.
+ */
+static void
+DecodeFrame( const void* message )
+{
+    const MessageHeader* header = ( const MessageHeader* )message;
+    DoNotOptimize( header->GetSenderId() );
+    DoNotOptimize( header->GetReceiverId() );
+    DoNotOptimize( header->GetMessageType() );
+    DoNotOptimize( header->GetMessageId() );
+    DoNotOptimize( header->GetDataSize() );
+    DoNotOptimize( ( ( const MessageEnder* )message )->CheckEndOfMessageField() );
+}
+
+/**
+ *  Measures the parsing of a received message.
+ *
+ *  @param state   Benchmark state.
+ *  @param message Message to be parsed.
+ *  @param decoder Reads all the fields of the message.
+ */
+template <typename TMessage, typename TDecoder>
+static void
+DecodeMessage( BenchmarkState & state, const SmartPointer<TMessage> & message, TDecoder decoder )
+{
+    state.SetBytesPerIteration( GetMessageSize( message ) );
+    const TMessage* receivedMessage = message;
+    while ( state.KeepRunning() )
+    {
+        DecodeFrame( receivedMessage );
+        decoder( receivedMessage );
+        ClobberMemory();
+    }
+}
+
+/**
+ *  Creates a consumption trace with small changes between neighbours, like a household meter. The uncompressed messages are measured with the same trace, so the sizes can be compared.
+ *
+ *  @param numberOfPoints Number of points.
+ *
+ *  @return Data points.
+ */
+static std::vector<unsigned int>
+CreateConsumptionPoints( const BenchmarkState::TArgument numberOfPoints )
+{
+    std::vector<unsigned int> points( numberOfPoints );
+    unsigned int consumption = 1000;
+    for ( size_t index = 0; index < points.size(); ++index )
+    {
+        consumption = consumption + ( unsigned int )( index * 7919 % 201 ) - 100;
+        points[index] = consumption;
+    }
+    return ( points );
+}
+
+/**
+ *  Creates consumption values with small changes between neighbours, like the readings of a meter.
+ *
+ *  @param numberOfValues Number of values.
+ *
+ *  @return Consumption values.
+ */
+static std::vector<PayloadEncoding::TValue>
+CreateConsumptions( const BenchmarkState::TArgument numberOfValues )
+{
+    std::vector<PayloadEncoding::TValue> values( numberOfValues );
+    for ( size_t index = 0; index < values.size(); ++index )
+    {
+        values[index] = 1000 + ( PayloadEncoding::TValue )( index % 50 );
+    }
+    return ( values );
+}
+
+/**
+ *  Reads every element of a payload view, like SystemManager does when it stores the received data.
+ *
+ *  @param view View of the payload.
+ *
+ *  @return Sum of the elements.
+ */
+template <typename TElement>
+static TElement
+ReadView( const NetworkArrayView<TElement> & view )
+{
+    TElement sum = 0;
+    for ( TElement element : view )
+    {
+        sum += element;
+    }
+    return ( sum );
+}
+
+/**
+ *  Registers the benchmarks of NetworkByteAccessor, MessageHeader and SequenceCounter.
+ *
+ *  @param runner Benchmark runner.
+ */
+static void
+RegisterFieldBenchmarks( BenchmarkRunner & runner )
+{
+    runner.Register( "NetworkByteAccessor/Write16", []( BenchmarkState & state )
+    {
+        char buffer[8] = { 0 };
+        unsigned short value = 0;
+        state.SetBytesPerIteration( sizeof( value ) );
+        while ( state.KeepRunning() )
+        {
+            ( ( NetworkByteAccessor<2, sizeof( value )>* )buffer )->Write( value++ );
+            ClobberMemory();
+        }
+    } );
+
+    runner.Register( "NetworkByteAccessor/Read16", []( BenchmarkState & state )
+    {
+        char buffer[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        unsigned short value;
+        state.SetBytesPerIteration( sizeof( value ) );
+        while ( state.KeepRunning() )
+        {
+            ( ( NetworkByteAccessor<2, sizeof( value )>* )buffer )->Read( value );
+            DoNotOptimize( value );
+        }
+    } );
+
+    runner.Register( "NetworkByteAccessor/Write32", []( BenchmarkState & state )
+    {
+        char buffer[8] = { 0 };
+        unsigned int value = 0;
+        state.SetBytesPerIteration( sizeof( value ) );
+        while ( state.KeepRunning() )
+        {
+            ( ( NetworkByteAccessor<4, sizeof( value )>* )buffer )->Write( value++ );
+            ClobberMemory();
+        }
+    } );
+
+    runner.Register( "NetworkByteAccessor/Read32", []( BenchmarkState & state )
+    {
+        char buffer[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        unsigned int value;
+        state.SetBytesPerIteration( sizeof( value ) );
+        while ( state.KeepRunning() )
+        {
+            ( ( NetworkByteAccessor<4, sizeof( value )>* )buffer )->Read( value );
+            DoNotOptimize( value );
+        }
+    } );
+
+    runner.Register( "MessageHeader/PrepareOutgoingMessage", []( BenchmarkState & state )
+    {
+        char buffer[MessageHeader::MessageHeaderSize + MessageEnder::EndOfMessageSize];
+        state.SetBytesPerIteration( sizeof( buffer ) );
+        while ( state.KeepRunning() )
+        {
+            ( ( MessageHeader* )buffer )->PrepareOutgoingMessage( SenderId, ReceiverId, 0x0003, 0x0002, 0 );
+            ClobberMemory();
+        }
+    } );
+
+    runner.Register( "SequenceCounter/Stamp", []( BenchmarkState & state )
+    {
+        char buffer[MessageHeader::MessageHeaderSize + MessageEnder::EndOfMessageSize];
+        ( ( MessageHeader* )buffer )->PrepareOutgoingMessage( SenderId, ReceiverId, 0x0003, 0x0002, 0 );
+        SequenceCounter sequenceCounter;
+        state.SetBytesPerIteration( sizeof( buffer ) );
+        while ( state.KeepRunning() )
+        {
+            sequenceCounter.Stamp( buffer );
+            ClobberMemory();
+        }
+    } );
+
+    runner.Register( "SequenceCounter/CheckIncoming", []( BenchmarkState & state )
+    {
+        char buffer[MessageHeader::MessageHeaderSize + MessageEnder::EndOfMessageSize];
+        ( ( MessageHeader* )buffer )->PrepareOutgoingMessage( SenderId, ReceiverId, 0x0003, 0x0002, 0 );
+        SequenceCounter sender;
+        SequenceCounter receiver( SequenceCounter::GapDetectionEnabled );
+        state.SetBytesPerIteration( sizeof( buffer ) );
+        while ( state.KeepRunning() )
+        {
+            sender.Stamp( buffer );
+            DoNotOptimize( receiver.CheckIncoming( buffer ) );
+        }
+    } );
+
+    runner.Register( "MessageHeader/Decode", []( BenchmarkState & state )
+    {
+        char buffer[MessageHeader::MessageHeaderSize + MessageEnder::EndOfMessageSize];
+        ( ( MessageHeader* )buffer )->PrepareOutgoingMessage( SenderId, ReceiverId, 0x0003, 0x0002, 0 );
+        ( ( MessageEnder* )buffer )->SetEndOfMessageField();
+        state.SetBytesPerIteration( sizeof( buffer ) );
+        while ( state.KeepRunning() )
+        {
+            DecodeFrame( buffer );
+            ClobberMemory();
+        }
+    } );
+}
+
+/**
+ *  Registers the benchmarks of the connection and system messages.
+ *
+ *  @param runner Benchmark runner.
+ */
+static void
+RegisterConnectionBenchmarks( BenchmarkRunner & runner )
+{
+    runner.Register( "Asynchronous::ClientConnectionRequest/Encode", []( BenchmarkState & state )
+    {
+        Asynchronous::ClientConnectionRequest::TClientName name( state.GetArgument(), 'a' );
+        EncodeMessage( state, [&]()
+        {
+            return ( Asynchronous::ClientConnectionRequest::GetNewClientConnectionRequest( SenderId, ReceiverId, name ) );
+        } );
+    }, NameLengths );
+
+    runner.Register( "Asynchronous::ClientConnectionRequest/Decode", []( BenchmarkState & state )
+    {
+        Asynchronous::ClientConnectionRequest::TClientName name( state.GetArgument(), 'a' );
+        auto message = Asynchronous::ClientConnectionRequest::GetNewClientConnectionRequest( SenderId, ReceiverId, name );
+        DecodeMessage( state, message, []( const Asynchronous::ClientConnectionRequest* request )
+        {
+            DoNotOptimize( request->CheckMessage() );
+            DoNotOptimize( request->GetClientName() );
+        } );
+    }, NameLengths );
+
+    runner.Register( "Synchronous::ClientConnectionRequest/Encode", []( BenchmarkState & state )
+    {
+        Synchronous::ClientConnectionRequest::TClientName name( state.GetArgument(), 'a' );
+        EncodeMessage( state, [&]()
+        {
+            return ( Synchronous::ClientConnectionRequest::GetNewClientConnectionRequest( SenderId, ReceiverId, name ) );
+        } );
+    }, NameLengths );
+
+    runner.Register( "Synchronous::ClientConnectionRequest/Decode", []( BenchmarkState & state )
+    {
+        Synchronous::ClientConnectionRequest::TClientName name( state.GetArgument(), 'a' );
+        auto message = Synchronous::ClientConnectionRequest::GetNewClientConnectionRequest( SenderId, ReceiverId, name );
+        DecodeMessage( state, message, []( const Synchronous::ClientConnectionRequest* request )
+        {
+            DoNotOptimize( request->CheckMessage() );
+            DoNotOptimize( request->GetClientName() );
+        } );
+    }, NameLengths );
+
+    runner.Register( "Asynchronous::ClientConnectionResponse/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( Asynchronous::ClientConnectionResponse::GetNewClientConnectionResponse( SenderId,
+                                                                                             ReceiverId,
+                                                                                             Asynchronous::ClientConnectionResponse::RequestAccepted,
+                                                                                             1000,
+                                                                                             100,
+                                                                                             Asynchronous::ClientConnectionResponse::SimulationMode ) );
+        } );
+    } );
+
+    runner.Register( "Asynchronous::ClientConnectionResponse/Decode", []( BenchmarkState & state )
+    {
+        auto message = Asynchronous::ClientConnectionResponse::GetNewClientConnectionResponse( SenderId,
+                                                                                               ReceiverId,
+                                                                                               Asynchronous::ClientConnectionResponse::RequestAccepted,
+                                                                                               1000,
+                                                                                               100,
+                                                                                               Asynchronous::ClientConnectionResponse::SimulationMode );
+        DecodeMessage( state, message, []( const Asynchronous::ClientConnectionResponse* response )
+        {
+            DoNotOptimize( response->CheckMessage() );
+            DoNotOptimize( response->GetRequestResult() );
+            DoNotOptimize( response->GetSystemTime() );
+            DoNotOptimize( response->GetNumberOfClients() );
+            DoNotOptimize( response->GetSystemMode() );
+        } );
+    } );
+
+    runner.Register( "Synchronous::ClientConnectionResponse/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( Synchronous::ClientConnectionResponse::GetNewClientConnectionResponse( SenderId,
+                                                                                            ReceiverId,
+                                                                                            Synchronous::ClientConnectionResponse::RequestAccepted,
+                                                                                            1000,
+                                                                                            100,
+                                                                                            Synchronous::ClientConnectionResponse::SimulationMode,
+                                                                                            1 ) );
+        } );
+    } );
+
+    runner.Register( "Synchronous::ClientConnectionResponse/Decode", []( BenchmarkState & state )
+    {
+        auto message = Synchronous::ClientConnectionResponse::GetNewClientConnectionResponse( SenderId,
+                                                                                              ReceiverId,
+                                                                                              Synchronous::ClientConnectionResponse::RequestAccepted,
+                                                                                              1000,
+                                                                                              100,
+                                                                                              Synchronous::ClientConnectionResponse::SimulationMode,
+                                                                                              1 );
+        DecodeMessage( state, message, []( const Synchronous::ClientConnectionResponse* response )
+        {
+            DoNotOptimize( response->CheckMessage() );
+            DoNotOptimize( response->GetRequestResult() );
+            DoNotOptimize( response->GetSystemTime() );
+            DoNotOptimize( response->GetNumberOfClients() );
+            DoNotOptimize( response->GetSystemMode() );
+            DoNotOptimize( response->GetSystemTimeStep() );
+        } );
+    } );
+
+    runner.Register( "SystemTimePrompt/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( SystemTimePrompt::GetNewSystemTimePrompt( SenderId, ReceiverId ) );
+        } );
+    } );
+
+    runner.Register( "SystemTimePrompt/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, SystemTimePrompt::GetNewSystemTimePrompt( SenderId, ReceiverId ), []( const SystemTimePrompt* prompt )
+        {
+            DoNotOptimize( prompt->CheckMessage() );
+        } );
+    } );
+
+    runner.Register( "SystemTimeResponse/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( SystemTimeResponse::GetNewSystemTimeResponse( SenderId, ReceiverId, 1000 ) );
+        } );
+    } );
+
+    runner.Register( "SystemTimeResponse/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, SystemTimeResponse::GetNewSystemTimeResponse( SenderId, ReceiverId, 1000 ), []( const SystemTimeResponse* response )
+        {
+            DoNotOptimize( response->CheckMessage() );
+            DoNotOptimize( response->GetSystemTime() );
+        } );
+    } );
+
+    runner.Register( "SystemVersionPrompt/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( SystemVersionPrompt::GetNewSystemVersionPrompt( SenderId, ReceiverId ) );
+        } );
+    } );
+
+    runner.Register( "SystemVersionPrompt/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, SystemVersionPrompt::GetNewSystemVersionPrompt( SenderId, ReceiverId ), []( const SystemVersionPrompt* prompt )
+        {
+            DoNotOptimize( prompt->CheckMessage() );
+        } );
+    } );
+
+    runner.Register( "SystemVersionResponse/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( SystemVersionResponse::GetNewSystemVersionResponse( SenderId, ReceiverId, 1, 0 ) );
+        } );
+    } );
+
+    runner.Register( "SystemVersionResponse/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, SystemVersionResponse::GetNewSystemVersionResponse( SenderId, ReceiverId, 1, 0 ), []( const SystemVersionResponse* response )
+        {
+            DoNotOptimize( response->CheckMessage() );
+            DoNotOptimize( response->GetMajorVersion() );
+            DoNotOptimize( response->GetMinorVersion() );
+        } );
+    } );
+
+    runner.Register( "RegulationClientRegisterRequest/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( RegulationClientRegisterRequest::GetNewRegulationClientRegisterRequest( SenderId, ReceiverId ) );
+        } );
+    } );
+
+    runner.Register( "RegulationClientRegisterRequest/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, RegulationClientRegisterRequest::GetNewRegulationClientRegisterRequest( SenderId, ReceiverId ), []( const RegulationClientRegisterRequest* request )
+        {
+            DoNotOptimize( request->CheckMessage() );
+        } );
+    } );
+}
+
+/**
+ *  Registers the benchmarks of the data and price messages exchanged at every time step.
+ *
+ *  @param runner Benchmark runner.
+ */
+static void
+RegisterDataBenchmarks( BenchmarkRunner & runner )
+{
+    runner.Register( "Asynchronous::ClientData/Encode", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        EncodeMessage( state, [&]()
+        {
+            return ( Asynchronous::ClientData::GetNewClientData( SenderId, ReceiverId, 1000, 1, ( Asynchronous::ClientData::TNumberOfDataPoints )points.size(), points.data() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Asynchronous::ClientData/Decode", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        auto message = Asynchronous::ClientData::GetNewClientData( SenderId, ReceiverId, 1000, 1, ( Asynchronous::ClientData::TNumberOfDataPoints )points.size(), points.data() );
+        DecodeMessage( state, message, []( const Asynchronous::ClientData* data )
+        {
+            DoNotOptimize( data->CheckMessage() );
+            DoNotOptimize( data->GetStartTime() );
+            DoNotOptimize( data->GetTimeResolution() );
+            DoNotOptimize( data->GetDataPoints() );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Asynchronous::ClientData/DecodeView", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        auto message = Asynchronous::ClientData::GetNewClientData( SenderId, ReceiverId, 1000, 1, ( Asynchronous::ClientData::TNumberOfDataPoints )points.size(), points.data() );
+        DecodeMessage( state, message, []( const Asynchronous::ClientData* data )
+        {
+            DoNotOptimize( data->CheckMessage() );
+            DoNotOptimize( data->GetStartTime() );
+            DoNotOptimize( data->GetTimeResolution() );
+            DoNotOptimize( ReadView( data->GetDataPointView() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Asynchronous::ClientCompressedData/Encode", []( BenchmarkState & state )
+    {
+        auto points = CreateConsumptionPoints( state.GetArgument() );
+        EncodeMessage( state, [&]()
+        {
+            return ( Asynchronous::ClientCompressedData::GetNewClientCompressedData( SenderId, ReceiverId, 1000, 1, ( Asynchronous::ClientCompressedData::TNumberOfDataPoints )points.size(), points.data() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Asynchronous::ClientCompressedData/Decode", []( BenchmarkState & state )
+    {
+        auto points = CreateConsumptionPoints( state.GetArgument() );
+        auto message = Asynchronous::ClientCompressedData::GetNewClientCompressedData( SenderId, ReceiverId, 1000, 1, ( Asynchronous::ClientCompressedData::TNumberOfDataPoints )points.size(), points.data() );
+        DecodeMessage( state, message, []( const Asynchronous::ClientCompressedData* data )
+        {
+            DoNotOptimize( data->CheckMessage() );
+            DoNotOptimize( data->CheckEncodedSize() );
+            DoNotOptimize( data->GetStartTime() );
+            DoNotOptimize( data->GetTimeResolution() );
+            TraceCodec::Decoder decoder( data->GetEncodedData(), data->GetEncodedSize() );
+            TraceCodec::TValue value;
+            TraceCodec::TValue sum = 0;
+            for ( Asynchronous::ClientCompressedData::TNumberOfDataPoints index = data->GetNumberOfDataPoints(); index > 0 && decoder.Next( value ); --index )
+            {
+                sum += value;
+            }
+            DoNotOptimize( sum );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::ClientData/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( Synchronous::ClientData::GetNewClientData( SenderId, ReceiverId, 1000 ) );
+        } );
+    } );
+
+    runner.Register( "Synchronous::ClientData/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, Synchronous::ClientData::GetNewClientData( SenderId, ReceiverId, 1000 ), []( const Synchronous::ClientData* data )
+        {
+            DoNotOptimize( data->CheckMessage() );
+            DoNotOptimize( data->GetDataPoint() );
+        } );
+    } );
+
+    runner.Register( "Synchronous::ClientExtendedData/Encode", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        EncodeMessage( state, [&]()
+        {
+            return ( Synchronous::ClientExtendedData::GetNewClientData( SenderId, ReceiverId, ( Synchronous::ClientExtendedData::TNumberOfDataPoints )points.size(), points.data() ) );
+        } );
+    }, HorizonSizes );
+
+    runner.Register( "Synchronous::ClientExtendedData/Decode", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::ClientExtendedData::GetNewClientData( SenderId, ReceiverId, ( Synchronous::ClientExtendedData::TNumberOfDataPoints )points.size(), points.data() );
+        DecodeMessage( state, message, []( const Synchronous::ClientExtendedData* data )
+        {
+            DoNotOptimize( data->CheckMessage() );
+            DoNotOptimize( data->GetDataPoints() );
+        } );
+    }, HorizonSizes );
+
+    runner.Register( "Synchronous::ClientExtendedData/DecodeView", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::ClientExtendedData::GetNewClientData( SenderId, ReceiverId, ( Synchronous::ClientExtendedData::TNumberOfDataPoints )points.size(), points.data() );
+        DecodeMessage( state, message, []( const Synchronous::ClientExtendedData* data )
+        {
+            DoNotOptimize( data->CheckMessage() );
+            DoNotOptimize( ReadView( data->GetDataPointView() ) );
+        } );
+    }, HorizonSizes );
+
+    runner.Register( "Synchronous::DemandNegotiation/Encode", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        EncodeMessage( state, [&]()
+        {
+            return ( Synchronous::DemandNegotiation::GetNewDemandNegotiation( SenderId, ReceiverId, ( Synchronous::DemandNegotiation::TNumberOfDataPoints )points.size(), points.data() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::DemandNegotiation/Decode", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::DemandNegotiation::GetNewDemandNegotiation( SenderId, ReceiverId, ( Synchronous::DemandNegotiation::TNumberOfDataPoints )points.size(), points.data() );
+        DecodeMessage( state, message, []( const Synchronous::DemandNegotiation* negotiation )
+        {
+            DoNotOptimize( negotiation->CheckMessage() );
+            DoNotOptimize( negotiation->GetDataPoints() );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::DemandNegotiation/DecodeView", []( BenchmarkState & state )
+    {
+        auto points = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::DemandNegotiation::GetNewDemandNegotiation( SenderId, ReceiverId, ( Synchronous::DemandNegotiation::TNumberOfDataPoints )points.size(), points.data() );
+        DecodeMessage( state, message, []( const Synchronous::DemandNegotiation* negotiation )
+        {
+            DoNotOptimize( negotiation->CheckMessage() );
+            DoNotOptimize( ReadView( negotiation->GetDataPointView() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::SetCurrentPrice/Encode", []( BenchmarkState & state )
+    {
+        auto prices = CreatePoints( state.GetArgument() );
+        EncodeMessage( state, [&]()
+        {
+            return ( Synchronous::SetCurrentPrice::GetNewSetCurrentPrice( SenderId, ReceiverId, 1000, ( Synchronous::SetCurrentPrice::TNumberOfPricePoints )prices.size(), prices.data() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::SetCurrentPrice/Decode", []( BenchmarkState & state )
+    {
+        auto prices = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::SetCurrentPrice::GetNewSetCurrentPrice( SenderId, ReceiverId, 1000, ( Synchronous::SetCurrentPrice::TNumberOfPricePoints )prices.size(), prices.data() );
+        DecodeMessage( state, message, []( const Synchronous::SetCurrentPrice* price )
+        {
+            DoNotOptimize( price->CheckMessage() );
+            DoNotOptimize( price->GetIntervalBegin() );
+            DoNotOptimize( price->GetPrice() );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::SetCurrentPrice/DecodeView", []( BenchmarkState & state )
+    {
+        auto prices = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::SetCurrentPrice::GetNewSetCurrentPrice( SenderId, ReceiverId, 1000, ( Synchronous::SetCurrentPrice::TNumberOfPricePoints )prices.size(), prices.data() );
+        DecodeMessage( state, message, []( const Synchronous::SetCurrentPrice* price )
+        {
+            DoNotOptimize( price->CheckMessage() );
+            DoNotOptimize( price->GetIntervalBegin() );
+            DoNotOptimize( ReadView( price->GetPriceView() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::SetCurrentPriceAndRegulation/Encode", []( BenchmarkState & state )
+    {
+        auto prices = CreatePoints( state.GetArgument() );
+        EncodeMessage( state, [&]()
+        {
+            return ( Synchronous::SetCurrentPriceAndRegulation::GetNewSetCurrentPriceAndRegulation( SenderId,
+                                                                                                    ReceiverId,
+                                                                                                    1000,
+                                                                                                    ( Synchronous::SetCurrentPriceAndRegulation::TNumberOfPricePoints )prices.size(),
+                                                                                                    prices.data(),
+                                                                                                    prices.data(),
+                                                                                                    prices.data() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::SetCurrentPriceAndRegulation/Decode", []( BenchmarkState & state )
+    {
+        auto prices = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::SetCurrentPriceAndRegulation::GetNewSetCurrentPriceAndRegulation( SenderId,
+                                                                                                      ReceiverId,
+                                                                                                      1000,
+                                                                                                      ( Synchronous::SetCurrentPriceAndRegulation::TNumberOfPricePoints )prices.size(),
+                                                                                                      prices.data(),
+                                                                                                      prices.data(),
+                                                                                                      prices.data() );
+        DecodeMessage( state, message, []( const Synchronous::SetCurrentPriceAndRegulation* price )
+        {
+            DoNotOptimize( price->CheckMessage() );
+            DoNotOptimize( price->GetIntervalBegin() );
+            DoNotOptimize( price->GetPrice() );
+            DoNotOptimize( price->GetUpRegulationPrice() );
+            DoNotOptimize( price->GetDownRegulationPrice() );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::SetCurrentPriceAndRegulation/DecodeView", []( BenchmarkState & state )
+    {
+        auto prices = CreatePoints( state.GetArgument() );
+        auto message = Synchronous::SetCurrentPriceAndRegulation::GetNewSetCurrentPriceAndRegulation( SenderId,
+                                                                                                      ReceiverId,
+                                                                                                      1000,
+                                                                                                      ( Synchronous::SetCurrentPriceAndRegulation::TNumberOfPricePoints )prices.size(),
+                                                                                                      prices.data(),
+                                                                                                      prices.data(),
+                                                                                                      prices.data() );
+        DecodeMessage( state, message, []( const Synchronous::SetCurrentPriceAndRegulation* price )
+        {
+            DoNotOptimize( price->CheckMessage() );
+            DoNotOptimize( price->GetIntervalBegin() );
+            DoNotOptimize( ReadView( price->GetPriceView() ) );
+            DoNotOptimize( ReadView( price->GetUpRegulationPriceView() ) );
+            DoNotOptimize( ReadView( price->GetDownRegulationPriceView() ) );
+        } );
+    }, PayloadSizes );
+
+    runner.Register( "Synchronous::GetPrice/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( Synchronous::GetPrice::GetNewGetPrice( SenderId, ReceiverId ) );
+        } );
+    } );
+
+    runner.Register( "Synchronous::GetPrice/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, Synchronous::GetPrice::GetNewGetPrice( SenderId, ReceiverId ), []( const Synchronous::GetPrice* request )
+        {
+            DoNotOptimize( request->CheckMessage() );
+        } );
+    } );
+
+    runner.Register( "Synchronous::PriceProposal/Encode", []( BenchmarkState & state )
+    {
+        EncodeMessage( state, []()
+        {
+            return ( Synchronous::PriceProposal::GetNewPriceProposal( SenderId, ReceiverId, 100, 1000, 1001 ) );
+        } );
+    } );
+
+    runner.Register( "Synchronous::PriceProposal/Decode", []( BenchmarkState & state )
+    {
+        DecodeMessage( state, Synchronous::PriceProposal::GetNewPriceProposal( SenderId, ReceiverId, 100, 1000, 1001 ), []( const Synchronous::PriceProposal* proposal )
+        {
+            DoNotOptimize( proposal->CheckMessage() );
+            DoNotOptimize( proposal->GetPrice() );
+            DoNotOptimize( proposal->GetIntervalBegin() );
+            DoNotOptimize( proposal->GetIntervalEnd() );
+        } );
+    } );
+}
+
+/**
+ *  Registers the benchmarks of the negotiated payload encodings. The encoded messages are measured with their own size, so the compaction shows up in the throughput.
+ *
+ *  @param runner Benchmark runner.
+ */
+static void
+RegisterPayloadEncodingBenchmarks( BenchmarkRunner & runner )
+{
+    const std::vector<std::pair<std::string, PayloadEncoding>> encodings = { { "Integer", PayloadEncoding( PayloadEncoding::IntegerEncoding ) },
+                                                                             { "Float", PayloadEncoding( PayloadEncoding::FloatEncoding, 8 ) },
+                                                                             { "FixedPoint", PayloadEncoding( PayloadEncoding::FixedPointEncoding, 8 ) },
+                                                                             { "Delta", PayloadEncoding( PayloadEncoding::DeltaEncoding, 8 ) } };
+    for ( const auto & encoding : encodings )
+    {
+        PayloadEncoding payloadEncoding = encoding.second;
+        runner.Register( "PayloadEncoding/" + encoding.first + "/Encode", [payloadEncoding]( BenchmarkState & state )
+        {
+            auto values = CreateConsumptions( state.GetArgument() );
+            EncodeMessage( state, [&]()
+            {
+                return ( Asynchronous::ClientData::GetNewClientData( SenderId, ReceiverId, 1000, 1, ( Asynchronous::ClientData::TNumberOfDataPoints )values.size(), payloadEncoding, values.data() ) );
+            } );
+        }, PayloadSizes );
+
+        runner.Register( "PayloadEncoding/" + encoding.first + "/DecodeToScaled", [payloadEncoding]( BenchmarkState & state )
+        {
+            auto values = CreateConsumptions( state.GetArgument() );
+            auto message = Asynchronous::ClientData::GetNewClientData( SenderId, ReceiverId, 1000, 1, ( Asynchronous::ClientData::TNumberOfDataPoints )values.size(), payloadEncoding, values.data() );
+            std::vector<unsigned int> points( values.size() );
+            DecodeMessage( state, message, [&]( const Asynchronous::ClientData* data )
+            {
+                DoNotOptimize( data->CheckMessage() );
+                DoNotOptimize( data->CheckPayloadSize( payloadEncoding ) );
+                payloadEncoding.DecodeToScaledPayload( data->GetPayload(), data->GetNumberOfDataPoints(), points.data() );
+                DoNotOptimize( ReadView( Asynchronous::ClientData::TDataPointView( points.data(), data->GetNumberOfDataPoints() ) ) );
+            } );
+        }, PayloadSizes );
+    }
+}
+
+int
+main( int argc, char **argv )
+{
+    LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::NoLogging );
+
+    BenchmarkRunner runner;
+    RegisterFieldBenchmarks( runner );
+    RegisterConnectionBenchmarks( runner );
+    RegisterDataBenchmarks( runner );
+    RegisterPayloadEncodingBenchmarks( runner );
+
+    if ( !runner.ParseArguments( argc, argv ) )
+    {
+        return ( EXIT_SUCCESS );
+    }
+    runner.RunAll();
+    return ( EXIT_SUCCESS );
+}
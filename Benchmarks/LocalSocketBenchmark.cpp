@@ -0,0 +1,244 @@
+/**
+ * @file LocalSocketBenchmark.cpp
+ * Round trip latency of the OpenDSS query pattern over the transports for local peers.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <unistd.h>
+#include "BenchmarkRunner.h"
+#include "LogPrint.h"
+#include "TCPServer.h"
+#include "TCPClient.h"
+#include "SharedMemoryChannel.h"
+#include "SocketOptions.h"
+
+/**
+ *  Numbers of clients queried in a time step.
+ */
+static const BenchmarkRunner::TArguments NumbersOfClients = { 1, 100, 1000 };
+
+/**
+ *  Port of the loopback server.
+ */
+static const IPAddress::TPort BenchmarkPort = 26989;
+
+/**
+ *  Frame types of the OpenDSS link used by the benchmark.
+ */
+enum FrameTypeValues
+{
+    SetWattageType = 1, /**< Sets the consumption of a client, not answered. */
+    GetVoltageDeviationAndConsumptionType = 2, /**< Asks for the voltage deviation and consumption of a client. */
+    VoltageDeviationAndConsumptionResultType = 3 /**< Answers the query with two values. */
+};
+
+/**
+ *  Name of the queried client, the length of the usual load names.
+ */
+static const std::string ClientName = "load1234";
+
+/**
+ *  Receives exactly the given number of bytes.
+ *
+ *  @param socket Socket to receive from.
+ *  @param buffer Buffer of at least length bytes.
+ *  @param length Number of bytes to receive.
+ *
+ *  @return false if the connection is closed before.
+ */
+template <typename TSocket>
+static bool
+ReceiveAll( TSocket & socket, char* buffer, const size_t length )
+{
+    size_t receivedBytes = 0;
+    while ( receivedBytes < length )
+    {
+        size_t result = socket.ReceiveData( buffer + receivedBytes, length - receivedBytes );
+        if ( result == 0 || result > length - receivedBytes )
+        {
+            return ( false );
+        }
+        receivedBytes += result;
+    }
+    return ( true );
+}
+
+/**
+ *  Builds a frame of the OpenDSS link, a length and a type followed by the payload, all in network byte order.
+ *
+ *  @param type    Type of the frame.
+ *  @param payload Payload of the frame.
+ *
+ *  @return Frame to be sent.
+ */
+static std::vector<char>
+BuildFrame( const uint32_t type, const std::string & payload )
+{
+    std::vector<char> frame( 2 * sizeof( uint32_t ) + payload.size() );
+    uint32_t length = htonl( ( uint32_t )frame.size() );
+    uint32_t networkType = htonl( type );
+    memcpy( frame.data(), &length, sizeof( length ) );
+    memcpy( frame.data() + sizeof( length ), &networkType, sizeof( networkType ) );
+    memcpy( frame.data() + 2 * sizeof( uint32_t ), payload.data(), payload.size() );
+    return ( frame );
+}
+
+/**
+ *  Answers the queries like the OpenDSS controller until the connection is closed.
+ *
+ *  @param connection Connection to S2Sim.
+ */
+template <typename TSocket>
+static void
+AnswerQueries( TSocket & connection )
+{
+    std::vector<char> result = BuildFrame( VoltageDeviationAndConsumptionResultType, std::string( 2 * sizeof( uint32_t ), '\0' ) );
+    std::vector<char> frame;
+    uint32_t length;
+    while ( ReceiveAll( connection, ( char* )&length, sizeof( length ) ) )
+    {
+        frame.resize( ntohl( length ) - sizeof( length ) );
+        if ( !ReceiveAll( connection, frame.data(), frame.size() ) )
+        {
+            return;
+        }
+        uint32_t type;
+        memcpy( &type, frame.data(), sizeof( type ) );
+        if ( ntohl( type ) == GetVoltageDeviationAndConsumptionType )
+        {
+            connection.SendData( result.data(), result.size() );
+        }
+    }
+}
+
+/**
+ *  Sets the consumption of every client and queries its voltage deviation and consumption, the way MatlabManager does in a time step.
+ *
+ *  @param client          Connection to the OpenDSS controller.
+ *  @param numberOfClients Number of queried clients.
+ *  @param setWattage      Frame setting the consumption.
+ *  @param getVoltage      Frame querying the values.
+ *  @param result          Buffer of the answer.
+ */
+static void
+QueryClients( TCPClient & client, const size_t numberOfClients, const std::vector<char> & setWattage, const std::vector<char> & getVoltage, std::vector<char> & result )
+{
+    for ( size_t clientIndex = 0; clientIndex < numberOfClients; ++clientIndex )
+    {
+        client.SendData( ( void* )setWattage.data(), setWattage.size() );
+        client.SendData( ( void* )getVoltage.data(), getVoltage.size() );
+        ReceiveAll( client, result.data(), result.size() );
+    }
+}
+
+/**
+ *  Measures the queries of a time step over a connected pair.
+ *
+ *  @param state      Benchmark state, the argument is the number of queried clients.
+ *  @param client     S2Sim side of the connection.
+ *  @param connection OpenDSS side of the connection, answering in another thread.
+ */
+static void
+MeasureQueries( BenchmarkState & state, TCPClient & client, SmartPointer<ThreadedTCPConnectedClient> connection )
+{
+    std::thread answerThread( [connection]() mutable
+    {
+        AnswerQueries( *connection );
+    } );
+
+    const std::vector<char> setWattage = BuildFrame( SetWattageType, std::string( sizeof( uint32_t ), '\0' ) + ClientName );
+    const std::vector<char> getVoltage = BuildFrame( GetVoltageDeviationAndConsumptionType, ClientName );
+    std::vector<char> result( 4 * sizeof( uint32_t ) );
+    const size_t numberOfClients = state.GetArgument();
+    state.SetBytesPerIteration( numberOfClients * ( setWattage.size() + getVoltage.size() + result.size() ) );
+    while ( state.KeepRunning() )
+    {
+        QueryClients( client, numberOfClients, setWattage, getVoltage, result );
+    }
+    connection->Shutdown();
+    answerThread.join();
+    connection->StopThread( connection );
+}
+
+/**
+ *  Registers the benchmark of a transport.
+ *
+ *  @param runner  Benchmark runner.
+ *  @param name    Name of the transport.
+ *  @param connect Connects the client to a server of the transport and returns the accepted connection, a null pointer on failure.
+ */
+static void
+RegisterTransport( BenchmarkRunner & runner, const std::string & name, std::function<SmartPointer<ThreadedTCPConnectedClient>( TCPClient & )> connect )
+{
+    runner.Register( "LocalSocket/" + name, [name, connect]( BenchmarkState & state )
+    {
+        TCPClient client;
+        SmartPointer<ThreadedTCPConnectedClient> connection = connect( client );
+        if ( connection.IsNull() )
+        {
+            std::cerr << "Cannot connect through " << name << std::endl;
+            return;
+        }
+        MeasureQueries( state, client, connection );
+    }, NumbersOfClients );
+}
+
+int
+main( int argc, char **argv )
+{
+    LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::NoLogging );
+    const std::string localPath = "/tmp/s2sim-benchmark-" + std::to_string( getpid() ) + ".sock";
+
+    BenchmarkRunner runner;
+    RegisterTransport( runner, "TCP", []( TCPClient & client )
+    {
+        TCPServer server;
+        server.SetPort( BenchmarkPort );
+        server.SetConnectionOptions( SocketOptions::GetSolverProfile() );
+        server.Listen();
+        IPAddress serverAddress;
+        serverAddress.SetAddress( INADDR_LOOPBACK );
+        serverAddress.SetPort( BenchmarkPort );
+        if ( !client.Connect( serverAddress ) )
+        {
+            return ( SmartPointer<ThreadedTCPConnectedClient>() );
+        }
+        client.SetOptions( SocketOptions::GetSolverProfile() );
+        return ( server.Accept() );
+    } );
+    RegisterTransport( runner, "Unix", [localPath]( TCPClient & client )
+    {
+        TCPServer server;
+        if ( !server.SetLocalPath( localPath ) || !server.Listen() || !client.ConnectLocal( localPath ) )
+        {
+            return ( SmartPointer<ThreadedTCPConnectedClient>() );
+        }
+        return ( server.Accept() );
+    } );
+#if defined( __linux__ )
+    RegisterTransport( runner, "SharedMemory", []( TCPClient & client )
+    {
+        const std::string name = "/s2sim-benchmark-" + std::to_string( getpid() );
+        auto channel = CreateObject<SharedMemoryChannel>();
+        if ( !channel->Create( name ) || !client.ConnectSharedMemory( name ) || !channel->WaitForPeer() )
+        {
+            return ( SmartPointer<ThreadedTCPConnectedClient>() );
+        }
+        return ( CreateObject<ThreadedTCPConnectedClient>( channel ) );
+    } );
+#endif
+
+    if ( !runner.ParseArguments( argc, argv ) )
+    {
+        return ( EXIT_SUCCESS );
+    }
+    runner.RunAll();
+    return ( EXIT_SUCCESS );
+}
@@ -0,0 +1,141 @@
+/**
+ * @file SocketOptionsBenchmark.cpp
+ * Round trip latency of the socket option profiles over loopback.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <iostream>
+#include "BenchmarkRunner.h"
+#include "LogPrint.h"
+#include "MessageHeader.h"
+#include "TCPServer.h"
+#include "TCPClient.h"
+#include "SocketOptions.h"
+
+using namespace TerraSwarm;
+
+/**
+ *  Payload sizes of the exchanged frames.
+ */
+static const BenchmarkRunner::TArguments PayloadSizes = { 64, 1024, 16384 };
+
+/**
+ *  Port of the loopback server.
+ */
+static const IPAddress::TPort BenchmarkPort = 26990;
+
+/**
+ *  Receives exactly the given number of bytes.
+ *
+ *  @param socket Socket to receive from.
+ *  @param buffer Buffer of at least length bytes.
+ *  @param length Number of bytes to receive.
+ *
+ *  @return false if the connection is closed before.
+ */
+template <typename TSocket>
+static bool
+ReceiveAll( TSocket & socket, char* buffer, const size_t length )
+{
+    size_t receivedBytes = 0;
+    while ( receivedBytes < length )
+    {
+        size_t result = socket.ReceiveData( buffer + receivedBytes, length - receivedBytes );
+        if ( result == 0 || result > length - receivedBytes )
+        {
+            return ( false );
+        }
+        receivedBytes += result;
+    }
+    return ( true );
+}
+
+/**
+ *  Sends a frame as a header and a payload in two writes, the way a frame built in parts is sent. Without TCP_NODELAY the payload waits for the acknowledgement of the header, which the peer delays.
+ *
+ *  @param socket Socket to send to.
+ *  @param frame  Header followed by the payload.
+ *  @param length Length of the frame.
+ */
+template <typename TSocket>
+static void
+SendFrame( TSocket & socket, char* frame, const size_t length )
+{
+    socket.SendData( frame, MessageHeader::MessageHeaderSize );
+    socket.SendData( frame + MessageHeader::MessageHeaderSize, length - MessageHeader::MessageHeaderSize );
+}
+
+/**
+ *  Registers the round trip benchmark of a profile. The server side answers every frame with a frame of the same size, both sides use the profile.
+ *
+ *  @param runner  Benchmark runner.
+ *  @param name    Name of the profile.
+ *  @param options Options of the profile.
+ */
+static void
+RegisterProfile( BenchmarkRunner & runner, const std::string & name, const SocketOptions & options )
+{
+    runner.Register( "SocketOptions/" + name, [options]( BenchmarkState & state )
+    {
+        const size_t frameLength = MessageHeader::MessageHeaderSize + state.GetArgument();
+        TCPServer server;
+        server.SetBacklog( 1 );
+        server.SetPort( BenchmarkPort );
+        server.SetConnectionOptions( options );
+        server.Listen();
+
+        TCPClient client;
+        client.SetOptions( options );
+        IPAddress serverAddress;
+        serverAddress.SetAddress( INADDR_LOOPBACK );
+        serverAddress.SetPort( BenchmarkPort );
+        if ( !client.Connect( serverAddress ) )
+        {
+            std::cerr << "Cannot connect to the loopback server" << std::endl;
+            return;
+        }
+        SmartPointer<ThreadedTCPConnectedClient> connectedClient = server.Accept();
+        std::thread echoThread( [connectedClient, frameLength]() mutable
+        {
+            std::vector<char> frame( frameLength );
+            while ( ReceiveAll( *connectedClient, frame.data(), frameLength ) )
+            {
+                SendFrame( *connectedClient, frame.data(), frameLength );
+            }
+        } );
+
+        std::vector<char> frame( frameLength, 0x55 );
+        state.SetBytesPerIteration( 2 * frameLength );
+        while ( state.KeepRunning() )
+        {
+            SendFrame( client, frame.data(), frameLength );
+            ReceiveAll( client, frame.data(), frameLength );
+        }
+        connectedClient->Shutdown();
+        echoThread.join();
+        connectedClient->StopThread( connectedClient );
+    }, PayloadSizes );
+}
+
+int
+main( int argc, char **argv )
+{
+    LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::NoLogging );
+
+    BenchmarkRunner runner;
+    RegisterProfile( runner, "Default", SocketOptions() );
+    RegisterProfile( runner, "ClientProfile", SocketOptions::GetClientProfile() );
+    RegisterProfile( runner, "SolverProfile", SocketOptions::GetSolverProfile() );
+    RegisterProfile( runner, "ControllerProfile", SocketOptions::GetControllerProfile() );
+
+    if ( !runner.ParseArguments( argc, argv ) )
+    {
+        return ( EXIT_SUCCESS );
+    }
+    runner.RunAll();
+    return ( EXIT_SUCCESS );
+}
@@ -0,0 +1,58 @@
+/**
+ * @file CheckpointFile.cpp
+ * Implements the CheckpointWriter and CheckpointReader classes.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <cstdio>
+#include "CheckpointFile.h"
+
+CheckpointWriter::CheckpointWriter( const std::string & path ) : m_path( path ),
+                                                                 m_stream( path + ".tmp", std::ios::binary | std::ios::trunc )
+{
+    this->Write( ( unsigned int )Magic );
+    this->Write( ( unsigned int )Version );
+}
+
+void
+CheckpointWriter::WriteString( const std::string & value )
+{
+    this->Write( ( TStringLength )value.size() );
+    this->WriteBytes( value.data(), value.size() );
+}
+
+bool
+CheckpointWriter::Commit( void )
+{
+    this->m_stream.close();
+    if ( this->m_stream.fail() )
+    {
+        std::remove( ( this->m_path + ".tmp" ).c_str() );
+        return ( false );
+    }
+    return ( std::rename( ( this->m_path + ".tmp" ).c_str(), this->m_path.c_str() ) == 0 );
+}
+
+CheckpointReader::CheckpointReader( const std::string & path ) : m_stream( path, std::ios::binary )
+{
+    unsigned int magic = 0;
+    unsigned int version = 0;
+    if ( !this->Read( magic ) || !this->Read( version ) || magic != Magic || version != Version )
+    {
+        this->m_stream.setstate( std::ios::failbit );
+    }
+}
+
+bool
+CheckpointReader::ReadString( std::string & value )
+{
+    TStringLength length;
+    if ( !this->Read( length ) || length > MaximumStringLength )
+    {
+        this->m_stream.setstate( std::ios::failbit );
+        return ( false );
+    }
+    value.resize( length );
+    return ( length == 0 || this->ReadBytes( &value[0], length ) );
+}
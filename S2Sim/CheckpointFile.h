@@ -0,0 +1,185 @@
+/**
+ * @file CheckpointFile.h
+ * Defines the CheckpointWriter and CheckpointReader classes for the binary checkpoint of S2Sim.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef CHECKPOINTFILE_H_
+#define CHECKPOINTFILE_H_
+
+#include <string>
+#include <fstream>
+
+/**
+ *  @brief Identification of a checkpoint file.
+
+    Values are written in host byte order, as a checkpoint is restored on the machine that wrote it. The magic value is read back differently on a machine with a different byte order.
+ */
+class CheckpointFile
+{
+    public:
+    /**
+     *  Defines the identification values at the start of a checkpoint.
+     */
+        enum HeaderValues
+        {
+            Magic = 0x53324350, /**< Identifies a checkpoint. */
+            Version = 0x00000002 /**< Version of the layout. */
+        };
+
+    /**
+     *  Defines the type of a string length in the checkpoint.
+     */
+        typedef unsigned int TStringLength;
+
+    /**
+     *  Defines the limits of the read values.
+     */
+        enum LimitValues
+        {
+            MaximumStringLength = 0x00010000 /**< Longest string accepted, protects against corrupted lengths. */
+        };
+};
+
+/**
+ *  @brief Writes a checkpoint to a temporary file and replaces the previous checkpoint when it is complete.
+
+    A checkpoint is either written completely or not at all, so a crash while writing leaves the previous checkpoint intact.
+ */
+class CheckpointWriter : public CheckpointFile
+{
+    private:
+    /**
+     *  Path of the checkpoint.
+     */
+        std::string m_path;
+
+    /**
+     *  Stream of the temporary file.
+     */
+        std::ofstream m_stream;
+
+    public:
+    /**
+     *  Creates the temporary file and writes the identification.
+     *
+     *  @param path Path of the checkpoint.
+     */
+        CheckpointWriter( const std::string & path );
+
+    /**
+     *  Writes a value.
+     *
+     *  @param value Value to be written.
+     */
+        template <typename TValue>
+        void
+        Write( const TValue & value )
+        {
+            this->m_stream.write( ( const char* )&value, sizeof( TValue ) );
+        }
+
+    /**
+     *  Writes memory as it is.
+     *
+     *  @param data Memory to be written.
+     *  @param size Number of bytes.
+     */
+        void
+        WriteBytes( const void* data, const size_t size )
+        {
+            this->m_stream.write( ( const char* )data, size );
+        }
+
+    /**
+     *  Writes a string with its length.
+     *
+     *  @param value String to be written.
+     */
+        void
+        WriteString( const std::string & value );
+
+    /**
+     *  Replaces the previous checkpoint with the written one.
+     *
+     *  @return false if writing failed, the previous checkpoint is kept.
+     */
+        bool
+        Commit( void );
+};
+
+/**
+ *  @brief Reads a checkpoint written by CheckpointWriter.
+
+    A read fails after the first error, so the values can be read in a sequence and checked once with IsGood().
+ */
+class CheckpointReader : public CheckpointFile
+{
+    private:
+    /**
+     *  Stream of the checkpoint.
+     */
+        std::ifstream m_stream;
+
+    public:
+    /**
+     *  Opens the checkpoint and checks the identification.
+     *
+     *  @param path Path of the checkpoint.
+     */
+        CheckpointReader( const std::string & path );
+
+    /**
+     *  Checks whether all reads succeeded.
+     *
+     *  @return false if the checkpoint cannot be opened, is not a valid checkpoint or ended early.
+     */
+        bool
+        IsGood( void ) const
+        {
+            return ( this->m_stream.good() );
+        }
+
+    /**
+     *  Reads a value.
+     *
+     *  @param value Read value.
+     *
+     *  @return false if the read failed.
+     */
+        template <typename TValue>
+        bool
+        Read( TValue & value )
+        {
+            this->m_stream.read( ( char* )&value, sizeof( TValue ) );
+            return ( this->IsGood() );
+        }
+
+    /**
+     *  Reads memory as it is.
+     *
+     *  @param data Memory to be read into.
+     *  @param size Number of bytes.
+     *
+     *  @return false if the read failed.
+     */
+        bool
+        ReadBytes( void* data, const size_t size )
+        {
+            this->m_stream.read( ( char* )data, size );
+            return ( this->IsGood() );
+        }
+
+    /**
+     *  Reads a string written with its length.
+     *
+     *  @param value Read string.
+     *
+     *  @return false if the read failed or the length is not valid.
+     */
+        bool
+        ReadString( std::string & value );
+};
+
+#endif /* CHECKPOINTFILE_H_ */
@@ -9,13 +9,21 @@
 
 ClientManager::TId ClientManager::nextClientId = 1;
 
+SequenceCounter::TGapDetection ClientManager::gapDetection = SequenceCounter::GapDetectionDisabled;
+
 ClientManager::ClientManager( const SmartPointer<ThreadedTCPConnectedClient> & client ) : m_isRegistered( IsNotRegistered ),
                                                                                           m_client( client ),
                                                                                           m_clientId( 0 ),
                                                                                           m_clientType( 0 ),
-                                                                                          m_keepAliveCounter( 0 )
+                                                                                          m_keepAliveCounter( 0 ),
+                                                                                          m_sequenceCounter( gapDetection ),
+                                                                                          m_clientAddress( client->GetClientAddress() ),
+                                                                                          m_datagramReceived( false ),
+                                                                                          m_datagramSequenceNumber( 0 ),
+                                                                                          m_reportTime( 0 )
 {
     LOG_FUNCTION_START();
+    ClientNumberManager::GetClientNumberManager().AddConnection();
     LOG_FUNCTION_END();
 }
 
@@ -27,6 +35,7 @@ ClientManager::~ClientManager( void )
         GetControlManager()->UnRegisterClient( this->m_clientId );
         this->m_isRegistered = IsNotRegistered;
     }
+    ClientNumberManager::GetClientNumberManager().RemoveConnection();
     LOG_FUNCTION_END();
 }
 
@@ -37,11 +46,28 @@ ClientManager::Initialize( const SmartPointer<ClientManager> & myself )
     this->m_client->SetNotificationCallback( CreateFunctionPointer( ( SmartPointer<ClientManager> )this->m_myself, &ClientManager::MessageReceived ) );
 }
 
+void
+ClientManager::Initialize( const SmartPointer<ClientManager> & myself, void* firstMessage, const size_t firstMessageSize )
+{
+    this->m_myself = myself;
+    this->MessageReceived( firstMessage, firstMessageSize );
+    if ( !this->m_client.IsNull() )
+    {
+        this->m_client->SetNotificationCallback( CreateFunctionPointer( ( SmartPointer<ClientManager> )this->m_myself, &ClientManager::MessageReceived ) );
+    }
+}
+
 void
 ClientManager::ConnectionBroken( void )
 {
     LOG_FUNCTION_START();
     WarningPrint( "Client Connection broken for: ", this->m_clientId );
+    if ( this->m_sequenceCounter.GetMissingMessages() > 0 || this->m_sequenceCounter.GetReorderedMessages() > 0 )
+    {
+        WarningPrint( "Client ", this->m_clientId, " received: ", this->m_sequenceCounter.GetReceivedMessages(),
+                      " missing: ", this->m_sequenceCounter.GetMissingMessages(),
+                      " reordered: ", this->m_sequenceCounter.GetReorderedMessages() );
+    }
     this->m_client->StopThread( this->m_client );
     this->m_client.NullifyPointer();
     
@@ -51,7 +77,14 @@ ClientManager::ConnectionBroken( void )
         this->m_isRegistered = IsNotRegistered;
         GetControlManager()->UnRegisterClient( this->m_clientId );
         WarningPrint( "Deregistered Client, deleting..." );
-        ClientNumberManager::GetClientNumberManager().RemoveSynchronousClient();
+        if ( this->IsAsynchronous() )
+        {
+            ClientNumberManager::GetClientNumberManager().RemoveAsynchronousClient();
+        }
+        else
+        {
+            GetSystemManager().RemoveSynchronousClient();
+        }
     }
     
     WarningPrint( "Client deleted" );
@@ -59,6 +92,69 @@ ClientManager::ConnectionBroken( void )
     LOG_FUNCTION_END();
 }
 
+ThreadedTCPConnectedClient::TNumberOfBytes
+ClientManager::SendMessage( void* message, const TDataSize messageSize )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_sendLock );
+    this->m_sequenceCounter.Stamp( message );
+    return ( this->m_client->SendData( message, messageSize ) );
+}
+
+ClientManager::TDataPointView
+ClientManager::DecodeScaledDataPoints( const void* payload, const TDataPointView::TNumberOfElements numberOfDataPoints, SmartPointer<char> & decodedPayload ) const
+{
+    if ( this->m_payloadEncoding.GetEncoding() == PayloadEncoding::IntegerEncoding )
+    {
+        return ( TDataPointView( payload, numberOfDataPoints ) );
+    }
+    decodedPayload = CreateObjectArray<char>( numberOfDataPoints * sizeof( PayloadEncoding::TScaledValue ) );
+    this->m_payloadEncoding.DecodeToScaledPayload( payload, numberOfDataPoints, decodedPayload );
+    return ( TDataPointView( ( char* )decodedPayload, numberOfDataPoints ) );
+}
+
+ClientManager::TDataPointView
+ClientManager::DecodeDataPoints( const void* payload, const TDataPointView::TNumberOfElements numberOfDataPoints, SmartPointer<char> & decodedPayload ) const
+{
+    TDataPointView dataPoints = this->DecodeScaledDataPoints( payload, numberOfDataPoints, decodedPayload );
+    PayloadEncoding::TFractionalBits fractionalBits = this->m_payloadEncoding.GetFractionalBits();
+    if ( fractionalBits > 0 )
+    {
+        PayloadEncoding::TScaledValue* values = ( PayloadEncoding::TScaledValue* )( char* )decodedPayload;
+        for ( TDataPointView::TNumberOfElements index = 0; index < numberOfDataPoints; ++index )
+        {
+            values[index] = htonl( PayloadEncoding::ToInteger( ntohl( values[index] ), fractionalBits ) );
+        }
+    }
+    return ( dataPoints );
+}
+
+void
+ClientManager::CountReport( void )
+{
+    ClientNumberManager::TSystemTime systemTime = GetSystemManager().GetSystemTime();
+    if ( this->m_reportTime.exchange( systemTime + 1 ) != systemTime + 1 )
+    {
+        ClientNumberManager::GetClientNumberManager().AddReport( this->IsSynchronous() ? ClientNumberManager::SynchronousType : ClientNumberManager::AsynchronousType, systemTime );
+    }
+}
+
+bool
+ClientManager::AssignClientId( const TId previousClientId, const TClientName & clientName )
+{
+    if ( GetControlManager()->ReclaimClient( previousClientId, clientName ) )
+    {
+        LogPrint( "Client ", clientName, " reconnected with its previous id ", previousClientId );
+        this->m_clientId = previousClientId;
+        return ( true );
+    }
+    if ( !GetMatlabManager()->IsClientPresent( clientName ) )
+    {
+        return ( false );
+    }
+    this->m_clientId = this->nextClientId++;
+    return ( true );
+}
+
 void
 ClientManager::MessageReceived( void* data, const size_t dataSize )
 {
@@ -70,6 +166,11 @@ ClientManager::MessageReceived( void* data, const size_t dataSize )
     }
     
     LogPrint( "Client Message Received of size: ", dataSize );
+    if ( dataSize >= MessageHeader::MessageHeaderSize && this->m_sequenceCounter.CheckIncoming( data ) > 0 )
+    {
+        WarningPrint( "Client ", this->m_clientId, " skipped sequence numbers, missing messages: ", this->m_sequenceCounter.GetMissingMessages() );
+    }
+    
     if ( ( ( Asynchronous::ClientConnectionRequest* )data )->CheckMessage() )
     {
         LogPrint( "Asynchronous Client Connection Request Received. Processing..." );
@@ -80,6 +181,11 @@ ClientManager::MessageReceived( void* data, const size_t dataSize )
         LogPrint( "Asynchronous Client Data Received. Processing..." );
         this->ProcessClientData( ( Asynchronous::ClientData* )data );
     }
+    else if ( ( ( Asynchronous::ClientCompressedData* )data )->CheckMessage() )
+    {
+        LogPrint( "Asynchronous Client Compressed Data Received. Processing..." );
+        this->ProcessClientCompressedData( ( Asynchronous::ClientCompressedData* )data );
+    }
     else if ( ( ( Synchronous::ClientConnectionRequest* )data )->CheckMessage() )
     {
         LogPrint( "Synchronous Client Connection Request Received. Processing..." );
@@ -103,6 +209,7 @@ ClientManager::MessageReceived( void* data, const size_t dataSize )
     else if ( ( ( Synchronous::ClientExtendedData* )data )->CheckMessage() )
     {
         LogPrint( "Synchronous Client Extended Data Received. Processing..." );
+        this->ProcessClientExtendedData( ( Synchronous::ClientExtendedData* )data );
     }
     else if ( ( ( SystemTimePrompt* )data )->CheckMessage() )
     {
@@ -117,18 +224,62 @@ ClientManager::MessageReceived( void* data, const size_t dataSize )
     LOG_FUNCTION_END();
 }
 
+ClientManager::TDatagramResult
+ClientManager::DatagramReceived( const void* data, const size_t dataSize, const IPAddress & sourceAddress )
+{
+    LOG_FUNCTION_START();
+    const MessageHeader* header = ( const MessageHeader* )data;
+    if ( !this->IsSynchronous() ||
+         this->m_isRegistered != IsRegistered ||
+         dataSize != MessageHeader::MessageHeaderSize + sizeof( Synchronous::ClientData::TDataPoint ) + MessageEnder::EndOfMessageSize ||
+         header->GetDataSize() != sizeof( Synchronous::ClientData::TDataPoint ) ||
+         !( ( const Synchronous::ClientData* )data )->CheckMessage() ||
+         !( ( const MessageEnder* )data )->CheckEndOfMessageField() )
+    {
+        LOG_FUNCTION_END();
+        return ( DatagramRejected );
+    }
+    const IPAddress & clientAddress = this->m_clientAddress;
+    if ( clientAddress.GetAddress() == INADDR_ANY || clientAddress.GetAddress() != sourceAddress.GetAddress() )
+    {
+        LOG_FUNCTION_END();
+        return ( DatagramRejected );
+    }
+    SequenceCounter::TSequenceNumber sequenceNumber = header->GetSequenceNumber();
+    if ( this->m_datagramReceived && ( int )( sequenceNumber - this->m_datagramSequenceNumber ) < 0 )
+    {
+        LOG_FUNCTION_END();
+        return ( DatagramOutdated );
+    }
+    this->m_datagramReceived = true;
+    this->m_datagramSequenceNumber = sequenceNumber;
+
+    SmartPointer<char> decodedPayload;
+    Synchronous::ClientData::TDataPoint dataPoint = this->DecodeScaledDataPoints( ( ( const Synchronous::ClientData* )data )->GetPayload(), 1, decodedPayload )[0];
+    GetSystemManager().RegisterData( this->m_clientId, dataPoint, this->m_payloadEncoding.GetFractionalBits() );
+    this->CountReport();
+    LOG_FUNCTION_END();
+    return ( DatagramAccepted );
+}
+
 void
 ClientManager::ProcessClientConnectionRequest( Asynchronous::ClientConnectionRequest* data )
 {
     LOG_FUNCTION_START();
     LogPrint( "Asynchronous Client Connection Request received" );
     Asynchronous::ClientConnectionResponse::TRequestResult requestResult;
-    if ( GetMatlabManager()->IsClientPresent( data->GetClientName() ) )
+    PayloadEncoding payloadEncoding = data->GetPayloadEncoding();
+    if ( !payloadEncoding.IsSupported() )
+    {
+        WarningPrint( "Payload encoding ", payloadEncoding.GetEncoding(), " is not supported, rejecting connection request" );
+        requestResult = Asynchronous::ClientConnectionResponse::RequestEncodingNotSupported;
+    }
+    else if ( this->AssignClientId( ( ( MessageHeader* )data )->GetSenderId(), data->GetClientName() ) )
     {
         LogPrint( "Client is present, accepting connection request" );
         requestResult = Asynchronous::ClientConnectionResponse::RequestAccepted;
         this->m_clientType = AsynchronousClient;
-        this->m_clientId = this->nextClientId;
+        this->m_payloadEncoding = payloadEncoding;
         this->m_clientName = data->GetClientName();
         
         ClientHistoryManager::GetClientHistoryManager().AddAsyncConnect( this->m_clientName );
@@ -137,7 +288,6 @@ ClientManager::ProcessClientConnectionRequest( Asynchronous::ClientConnectionReq
         LogPrint( "Registering client to the control manager" );
         GetControlManager()->RegisterClient( this->m_clientId, data->GetClientName(), this->m_myself );
         this->m_isRegistered = IsRegistered;
-        ++this->nextClientId;
     }
     else
     {
@@ -155,8 +305,8 @@ ClientManager::ProcessClientConnectionRequest( Asynchronous::ClientConnectionReq
                                                                                                 systemTime,
                                                                                                 numberOfClients,
                                                                                                 systemMode );
-    this->m_client->SendData( responseData, ( int )Asynchronous::ClientConnectionResponse::GetSize() );
-    if ( requestResult == Asynchronous::ClientConnectionResponse::RequestObjectIdNotFound )
+    this->SendMessage( responseData, Asynchronous::ClientConnectionResponse::GetSize() );
+    if ( requestResult != Asynchronous::ClientConnectionResponse::RequestAccepted )
     {
         WarningPrint( "Deleting  temporarily constructed client information for rejected request" );
         this->ConnectionBroken();
@@ -173,30 +323,60 @@ ClientManager::ProcessClientData( Asynchronous::ClientData* data )
     Asynchronous::ClientData::TTimeResolution timeResolution = data->GetTimeResolution();
     Asynchronous::ClientData::TNumberOfDataPoints numberOfDataPoints = data->GetNumberOfDataPoints();
     LogPrint( "Client ", this->m_clientId, " sent ", numberOfDataPoints, " starting at time: ", startTime, " with resolution: ", timeResolution );
-    GetSystemManager().RegisterData( this->m_clientId, startTime, timeResolution, numberOfDataPoints, data->GetDataPoints() );
+    if ( !data->CheckPayloadSize( this->m_payloadEncoding ) )
+    {
+        WarningPrint( "Client ", this->m_clientId, " sent data that does not match its payload encoding, dropping the data" );
+        LOG_FUNCTION_END();
+        return;
+    }
+    SmartPointer<char> decodedPayload;
+    GetSystemManager().RegisterData( this->m_clientId, startTime, timeResolution, this->DecodeDataPoints( data->GetPayload(), numberOfDataPoints, decodedPayload ) );
+    this->CountReport();
     LOG_FUNCTION_END();
 }
 
 void
-ClientManager::ProcessSystemTimePrompt( SystemTimePrompt *data )
+ClientManager::ProcessClientCompressedData( Asynchronous::ClientCompressedData* data )
+{
+    LOG_FUNCTION_START();
+    LogPrint( "Processing asynchronous client compressed data" );
+    if ( !data->CheckEncodedSize() ||
+         !GetSystemManager().RegisterCompressedData( this->m_clientId,
+                                                     data->GetStartTime(),
+                                                     data->GetTimeResolution(),
+                                                     data->GetNumberOfDataPoints(),
+                                                     data->GetEncodedData(),
+                                                     data->GetEncodedSize() ) )
+    {
+        WarningPrint( "Client ", this->m_clientId, " sent malformed compressed data, dropping the data" );
+    }
+    else
+    {
+        this->CountReport();
+    }
+    LOG_FUNCTION_END();
+}
+
+void
+ClientManager::ProcessSystemTimePrompt( SystemTimePrompt* /* data */ )
 {
     LOG_FUNCTION_START();
     LogPrint( "Processing System Time Prompt" );
     SystemTimeResponse::TSystemTime systemTime = GetSystemManager().GetSystemTime();
     auto responseData = SystemTimeResponse::GetNewSystemTimeResponse( 0x0000, 0xFFFF, systemTime );
-    this->m_client->SendData( responseData, responseData->GetSize() );
+    this->SendMessage( responseData, responseData->GetSize() );
     LogPrint( "Deleting this temporary time asking client");
     this->ConnectionBroken();
     LOG_FUNCTION_END();
 }
 
 void
-ClientManager::ProcessSystemVersionPrompt( SystemVersionPrompt *data )
+ClientManager::ProcessSystemVersionPrompt( SystemVersionPrompt* /* data */ )
 {
     LOG_FUNCTION_START();
     LogPrint( "Processing System Version Prompt" );
     auto responseData = SystemVersionResponse::GetNewSystemVersionResponse( 0x0000, 0xFFFF, 1, 4 );
-    this->m_client->SendData( responseData, responseData->GetSize() );
+    this->SendMessage( responseData, responseData->GetSize() );
     LogPrint( "Deleting this temporary version asking client");
     this->ConnectionBroken();
     LOG_FUNCTION_END();
@@ -208,12 +388,18 @@ ClientManager::ProcessClientConnectionRequest( Synchronous::ClientConnectionRequ
     LOG_FUNCTION_START();
     LogPrint( "Synchronous Client Connection Request received" );
     Synchronous::ClientConnectionResponse::TRequestResult requestResult;
-    if ( GetMatlabManager()->IsClientPresent( data->GetClientName() ) )
+    PayloadEncoding payloadEncoding = data->GetPayloadEncoding();
+    if ( !payloadEncoding.IsSupported() )
+    {
+        WarningPrint( "Payload encoding ", payloadEncoding.GetEncoding(), " is not supported, rejecting connection request" );
+        requestResult = Synchronous::ClientConnectionResponse::RequestEncodingNotSupported;
+    }
+    else if ( this->AssignClientId( ( ( MessageHeader* )data )->GetSenderId(), data->GetClientName() ) )
     {
         LogPrint( "Client is present, accepting request" );
         requestResult = Synchronous::ClientConnectionResponse::RequestAccepted;
         this->m_clientType = SynchronousClient;
-        this->m_clientId = this->nextClientId++;
+        this->m_payloadEncoding = payloadEncoding;
         this->m_clientName = data->GetClientName();
         
         ClientHistoryManager::GetClientHistoryManager().AddSyncConnect( this->m_clientName );
@@ -241,11 +427,11 @@ ClientManager::ProcessClientConnectionRequest( Synchronous::ClientConnectionRequ
                                                                                                systemMode,
                                                                                                systemTimeStep );
     
-    if ( this->m_client->SendData( responseData, ( int )Synchronous::ClientConnectionResponse::GetSize() ) <= 0 )
+    if ( this->SendMessage( responseData, Synchronous::ClientConnectionResponse::GetSize() ) == 0 )
     {
         this->ConnectionBroken();
     }
-    else if ( requestResult == Synchronous::ClientConnectionResponse::RequestObjectIdNotFound )
+    else if ( requestResult != Synchronous::ClientConnectionResponse::RequestAccepted )
     {
         WarningPrint( "Deleting  temporarily constructed client information for rejected request" );
         this->ConnectionBroken();
@@ -258,8 +444,10 @@ ClientManager::ProcessClientData( Synchronous::ClientData* data )
 {
     LOG_FUNCTION_START();
     LogPrint( "Synchronous Client Data received from: ", this->m_clientId );
-    Synchronous::ClientData::TDataPoint dataPoint = data->GetDataPoint();
-    GetSystemManager().RegisterData( this->m_clientId, dataPoint );
+    SmartPointer<char> decodedPayload;
+    Synchronous::ClientData::TDataPoint dataPoint = this->DecodeScaledDataPoints( data->GetPayload(), 1, decodedPayload )[0];
+    GetSystemManager().RegisterData( this->m_clientId, dataPoint, this->m_payloadEncoding.GetFractionalBits() );
+    this->CountReport();
     LOG_FUNCTION_END();
 }
 
@@ -268,13 +456,20 @@ ClientManager::ProcessClientExtendedData( Synchronous::ClientExtendedData* data
 {
     LOG_FUNCTION_START();
     LogPrint( "Synchronous Client Data received from: ", this->m_clientId );
-    Synchronous::ClientExtendedData::TNumberOfDataPoints numberOfDataPoints = data->GetNumberOfDataPoints();
-    GetSystemManager().RegisterData( this->m_clientId, numberOfDataPoints, data->GetDataPoints() );
+    if ( !data->CheckPayloadSize( this->m_payloadEncoding ) )
+    {
+        WarningPrint( "Client ", this->m_clientId, " sent data that does not match its payload encoding, dropping the data" );
+        LOG_FUNCTION_END();
+        return;
+    }
+    SmartPointer<char> decodedPayload;
+    GetSystemManager().RegisterData( this->m_clientId, this->DecodeScaledDataPoints( data->GetPayload(), data->GetNumberOfDataPoints(), decodedPayload ), this->m_payloadEncoding.GetFractionalBits() );
+    this->CountReport();
     LOG_FUNCTION_END();
 }
 
 void
-ClientManager::ProcessGetPrice( Synchronous::GetPrice* data )
+ClientManager::ProcessGetPrice( Synchronous::GetPrice* /* data */ )
 {
     LOG_FUNCTION_START();
     LogPrint( "Client ", this->m_clientId, " requests the price. Sending request to External Control." );
@@ -287,26 +482,30 @@ ClientManager::ProcessDemandNegotiation( Synchronous::DemandNegotiation* data )
 {
     LOG_FUNCTION_START();
     LogPrint( "Client ", this->m_clientId, " sends demand negotiation result. Sending result to External Control." );
-    GetControlManager()->ClientDemandNegotiation( this->m_clientId,
-                                                 data->GetNumberOfDataPoints(),
-                                                 data->GetDataPoints() );
+    if ( !data->CheckPayloadSize( this->m_payloadEncoding ) )
+    {
+        WarningPrint( "Client ", this->m_clientId, " sent a demand negotiation that does not match its payload encoding, dropping the message" );
+        LOG_FUNCTION_END();
+        return;
+    }
+    SmartPointer<char> decodedPayload;
+    GetControlManager()->ClientDemandNegotiation( this->m_clientId, this->DecodeDataPoints( data->GetPayload(), data->GetNumberOfDataPoints(), decodedPayload ) );
     LOG_FUNCTION_END();
 }
 
 void
-ClientManager::SetCurrentPrice( const TInterval beginInterval, const TNumberOfPriceValues numberOfPriceValues, TPrice* priceValues )
+ClientManager::SetCurrentPrice( const TInterval beginInterval, const TPriceView & priceValues )
 {
     LOG_FUNCTION_START();
-    LogPrint( "Price for client ", this->m_clientId, " is set to: ", ntohl( priceValues[0] ), " from time: ", beginInterval, ". Number of: ", numberOfPriceValues );
+    LogPrint( "Price for client ", this->m_clientId, " is set to: ", priceValues[0], " from time: ", beginInterval, ". Number of: ", priceValues.GetNumberOfElements() );
     auto message = Synchronous::SetCurrentPrice::GetNewSetCurrentPrice( 0x0000,
                                                                         this->m_clientId,
                                                                         beginInterval,
-                                                                        numberOfPriceValues,
                                                                         priceValues );
 
-    if ( this->m_client->SendData( message, message->GetSize() ) <= 0 )
+    if ( this->SendMessage( message, message->GetSize() ) == 0 )
     {
-        this->ConnectionBroken();
+        WarningPrint( "Price could not be sent to client ", this->m_clientId, ", the connection is closed by its reception" );
     }
     LOG_FUNCTION_END();
 }
@@ -322,9 +521,9 @@ ClientManager::PriceProposal( const TPrice price, const TInterval beginInterval,
                                                                     beginInterval,
                                                                     endInterval );
 
-    if ( this->m_client->SendData( message, Synchronous::PriceProposal::GetSize() ) )
+    if ( this->SendMessage( message, Synchronous::PriceProposal::GetSize() ) == 0 )
     {
-        this->ConnectionBroken();
+        WarningPrint( "Price proposal could not be sent to client ", this->m_clientId, ", the connection is closed by its reception" );
     }
     LOG_FUNCTION_END();
 }
@@ -10,8 +10,11 @@
 
 #include <fstream>
 #include <thread>
+#include <atomic>
+#include <mutex>
 
 #include "MessageHeader.h"
+#include "SequenceCounter.h"
 #include "ClientConnectionRequest.h"
 #include "ClientConnectionResponse.h"
 #include "SetCurrentPrice.h"
@@ -94,6 +97,16 @@ class ClientManager
      */
         typedef Synchronous::SetCurrentPrice::TInterval TInterval;
     
+    /**
+     *  Type used to represent price values read in place from a received message.
+     */
+        typedef Synchronous::SetCurrentPrice::TPriceView TPriceView;
+    
+    /**
+     *  Type used to represent data points read in place from a received message.
+     */
+        typedef Asynchronous::ClientData::TDataPointView TDataPointView;
+    
     /**
      *  Redefines the type for object name for rapid development.
      */
@@ -104,12 +117,32 @@ class ClientManager
      */
         typedef unsigned char TKeepAliveCounter;
 
+    /**
+     *  Defines the type of the result of a received datagram.
+     */
+        typedef unsigned char TDatagramResult;
+
+    /**
+     *  Defines the values for the TDatagramResult type.
+     */
+        enum DatagramResultValues
+        {
+            DatagramAccepted = ( TDatagramResult )0x00, /**< The data point is registered. */
+            DatagramRejected = ( TDatagramResult )0x01, /**< Not a synchronous client data message of this client, or not sent from the address of its connection. */
+            DatagramOutdated = ( TDatagramResult )0x02 /**< Older than the last accepted datagram of the client, e.g. reordered by the network. */
+        };
+
     private:
     /**
      *  Static variable that holds the next Unique ID. Incremented at each new connection. Returns to 0 if all values have been used.
      */
         static TId nextClientId;
     
+    /**
+     *  Gap detection setting of the connections created from now on.
+     */
+        static SequenceCounter::TGapDetection gapDetection;
+    
     /**
      *  States whether the client is registered at the Control Manager.
      */
@@ -135,21 +168,111 @@ class ClientManager
         SmartPointer<char> m_myself;
     
         TKeepAliveCounter m_keepAliveCounter;
+    
+    /**
+     *  Sequence numbers of the messages sent over and received from this connection.
+     */
+        SequenceCounter m_sequenceCounter;
+
+    /**
+     *  Serializes stamping and sending, so the sequence numbers leave the connection in order.
+     */
+        std::mutex m_sendLock;
+    
+    /**
+     *  Encoding of the data points and their number of fractional bits, negotiated in the connection request. Encoded data points are expanded to scaled integers when they are received.
+     */
+        PayloadEncoding m_payloadEncoding;
+
+    /**
+     *  IP address of the client connection, the only address the datagrams of the client are accepted from. INADDR_ANY if the connection has no IP address, the datagrams of the client are then rejected. Copied, as the connection is released when it breaks.
+     */
+        IPAddress m_clientAddress;
+
+    /**
+     *  Indicates whether a datagram of the client was accepted, the first one sets the sequence number.
+     */
+        bool m_datagramReceived;
+
+    /**
+     *  Sequence number of the last accepted datagram. Used only by the thread receiving the datagrams.
+     */
+        SequenceCounter::TSequenceNumber m_datagramSequenceNumber;
+
+    /**
+     *  Time step of the last counted data plus one, 0 if no data is counted yet. Data may arrive on the connection and as a datagram at the same time.
+     */
+        std::atomic<ClientNumberManager::TSystemTime> m_reportTime;
 
     private:
+    /**
+     *  Assigns the next sequence number of the connection to a message and sends it under m_sendLock.
+     *
+     *  @param message     Message starting with a MessageHeader.
+     *  @param messageSize Size of the complete message.
+     *
+     *  @return Number of bytes sent or queued, 0 if the connection is broken or the client is evicted as a slow consumer.
+     */
+        ThreadedTCPConnectedClient::TNumberOfBytes
+        SendMessage( void* message, const TDataSize messageSize );
+    
     /**
      *  @brief Nullifies moved client manager.
      */
         void
         NullifyMovedObject( void );
     
+    /**
+     *  Returns a view of received data points as scaled integers in units of 2^-fractionalBits watts. Integer encoded data points are read in place, the other encodings are expanded into the given buffer.
+     *
+     *  @param payload            Data points as they are encoded in the message.
+     *  @param numberOfDataPoints Number of data points.
+     *  @param decodedPayload     Buffer for the converted data points, must be kept as long as the view is used.
+     *
+     *  @return View of the scaled data points.
+     */
+        TDataPointView
+        DecodeScaledDataPoints( const void* payload, const TDataPointView::TNumberOfElements numberOfDataPoints, SmartPointer<char> & decodedPayload ) const;
+
+    /**
+     *  Returns a view of received data points rounded to watts, for the consumers that do not keep the fractional part.
+     *
+     *  @param payload            Data points as they are encoded in the message.
+     *  @param numberOfDataPoints Number of data points.
+     *  @param decodedPayload     Buffer for the converted data points, must be kept as long as the view is used.
+     *
+     *  @return View of the integer data points.
+     */
+        TDataPointView
+        DecodeDataPoints( const void* payload, const TDataPointView::TNumberOfElements numberOfDataPoints, SmartPointer<char> & decodedPayload ) const;
+
+    /**
+     *  Counts the client as reporting in the current time step, once per time step.
+     */
+        void
+        CountReport( void );
+
+    /**
+     *  @brief Assigns the client id of a connecting client.
+     *
+     *  A client restored from a checkpoint sends its previous id as the sender id of the connection request and gets it back without an OpenDSS query. Other clients get the next client id if the object exists in OpenDSS.
+     *
+     *  @param previousClientId Sender id of the connection request.
+     *  @param clientName       Object name of the client.
+     *
+     *  @return false if the object does not exist.
+     */
+        bool
+        AssignClientId( const TId previousClientId, const TClientName & clientName );
+    
     /**
      *  @brief Processes an asynchronous client connection request.
      *
      * This function processes a received asynchronous client connection request. There are multiple steps in the acceptance procedure:
-     *  - Checking with OpenDSS whether the object actually exists.
+     *  - Checking whether the requested payload encoding is supported.
+     *  - Reclaiming the previous client id, if the client was restored from a checkpoint.
+     *  - Otherwise checking with OpenDSS whether the object actually exists and incrementing the next client id.
      *  - If the object exists, an acceptance message is sent back.
-     *  - Next client id is incremented.
      *  - The client is registered to the ControlManager.
      *
      *  @param data Received message structure in TerraSwarm::Asynchronous::ClientConnectionRequest.
@@ -161,9 +284,10 @@ class ClientManager
      *  @brief Processes an synchronous client connection request.
      *
      * This function processes a received synchronous client connection request. There are multiple steps in the acceptance procedure:
-     *  - Checking with OpenDSS whether the object actually exists.
+     *  - Checking whether the requested payload encoding is supported.
+     *  - Reclaiming the previous client id, if the client was restored from a checkpoint.
+     *  - Otherwise checking with OpenDSS whether the object actually exists and incrementing the next client id.
      *  - If the object exists, an acceptance message is sent back.
-     *  - Next client id is incremented.
      *  - The client is registered to the ControlManager.
      *
      *  @param data Received message structure in TerraSwarm::Synchronous::ClientConnectionRequest.
@@ -181,6 +305,16 @@ class ClientManager
         void
         ProcessClientData( Asynchronous::ClientData* data );
 
+    /**
+     *  @brief Processes the compressed consumption information.
+     *
+     *  This function processes the received compressed consumption trace of the asynchronous client. The trace is registered to the SystemManager without decompressing it.
+     *
+     *  @param data Received message structure in TerraSwarm::Asynchronous::ClientCompressedData.
+     */
+        void
+        ProcessClientCompressedData( Asynchronous::ClientCompressedData* data );
+
     /**
      *  @brief Processes the consumption information.
      *
@@ -282,6 +416,16 @@ class ClientManager
         void
         Initialize( const SmartPointer<ClientManager> & myself );
 
+    /**
+     *  Processes the first message of the client, received before the reception thread is started, and starts the reception thread if the connection is kept.
+     *
+     *  @param myself           Pointer to this instance, kept until the connection is broken.
+     *  @param firstMessage     First received data.
+     *  @param firstMessageSize Size of the first received data.
+     */
+        void
+        Initialize( const SmartPointer<ClientManager> & myself, void* firstMessage, const size_t firstMessageSize );
+
     /**
      *  @brief Copies the contents of another client manager.
      *
@@ -321,15 +465,28 @@ class ClientManager
         void
         MessageReceived( void* data, const size_t dataSize );
 
+    /**
+     *  @brief Called when a synchronous client data message of the client is received as a datagram.
+     *
+     *  The datagram is accepted only from the IP address of the client connection, and its sequence number may not be older than the last accepted datagram. A client connected without an IP address, e.g. through the Unix domain socket, sends its data on the connection only. The sequence numbers of the datagrams are independent of the connection. Must be called from a single receiving thread.
+     *
+     *  @param data          Pointer to the received datagram.
+     *  @param dataSize      Size of the received datagram.
+     *  @param sourceAddress IP address the datagram was sent from.
+     *
+     *  @return Result of the datagram. @see{ClientManager::DatagramResultValues}
+     */
+        TDatagramResult
+        DatagramReceived( const void* data, const size_t dataSize, const IPAddress & sourceAddress );
+
     /**
      *  Sends a price signal to the client.
      *
-     *  @param priceValues   Indicates the price values for the intervals.
      *  @param beginInterval Indicates the beginning time for the price.
-     *  @param numberOfPriceValues   Indicates the number of price values.
+     *  @param priceValues   View of the price values for the intervals in network byte order, copied into the message without conversion.
      */
         void
-        SetCurrentPrice( const TInterval beginInterval, const TNumberOfPriceValues numberOfPriceValues, TPrice* priceValues );
+        SetCurrentPrice( const TInterval beginInterval, const TPriceView & priceValues );
 
     /**
      *  Sends a price proposal to the client.
@@ -373,6 +530,40 @@ class ClientManager
         {
             return ( this->m_clientId );
         }
+    
+    /**
+     *  @brief Enables the sequence gap detection of new connections.
+     *
+     *  The sample MATLAB clients send 0 as the sequence number of every message, therefore the gap detection is disabled by default.
+     *  @param newGapDetection Gap detection setting of the connections created from now on.
+     */
+        static void
+        SetGapDetection( const SequenceCounter::TGapDetection newGapDetection )
+        {
+            gapDetection = newGapDetection;
+        }
+
+    /**
+     *  Returns the id the next new client gets, to be saved in a checkpoint.
+     *
+     *  @return Next unique client id.
+     */
+        static TId
+        GetNextClientId( void )
+        {
+            return ( nextClientId );
+        }
+
+    /**
+     *  Sets the id the next new client gets, when a checkpoint is restored.
+     *
+     *  @param newNextClientId Next unique client id.
+     */
+        static void
+        SetNextClientId( const TId newNextClientId )
+        {
+            nextClientId = newNextClientId;
+        }
 };
 
 #endif /* CLIENTMANAGER_H_ */
@@ -8,8 +8,22 @@
 
 #include "ClientNumberManager.h"
 
-ClientNumberManager::ClientNumberManager( void ) : m_synchronousClientNumber( 0 ), m_asynchronousClientNumber( 0 )
+ClientNumberManager::ClientNumberManager( void ) : m_connectedClientNumber( 0 ),
+                                                   m_substitutedClients( 0 ),
+                                                   m_substitutions( 0 ),
+                                                   m_connections( 0 ),
+                                                   m_disconnections( 0 ),
+                                                   m_churnRate( 0 ),
+                                                   m_systemTime( 0 ),
+                                                   m_lastChurn( 0 ),
+                                                   m_lastTimeStep( TClock::now() )
 {
+    for ( int clientType = SynchronousType; clientType < NumberOfClientTypes; ++clientType )
+    {
+        this->m_registeredClientNumbers[clientType] = 0;
+        this->m_reports[clientType] = 0;
+        this->m_previousReports[clientType] = 0;
+    }
 }
 
 ClientNumberManager::~ClientNumberManager( void )
@@ -19,29 +33,90 @@ ClientNumberManager::~ClientNumberManager( void )
 void
 ClientNumberManager::AddSynchronousClient( void )
 {
-    std::lock_guard<std::mutex> lockGuard( this->m_clientNumberMutex );
-    ++this->m_synchronousClientNumber;
+    ++this->m_registeredClientNumbers[SynchronousType];
 }
 
 void
 ClientNumberManager::AddAsynchronousClient( void )
 {
-    std::lock_guard<std::mutex> lockGuard( this->m_clientNumberMutex );
-    ++this->m_asynchronousClientNumber;
+    ++this->m_registeredClientNumbers[AsynchronousType];
 }
 
 void
 ClientNumberManager::RemoveSynchronousClient( void )
 {
-    std::lock_guard<std::mutex> lockGuard( this->m_clientNumberMutex );
-    --this->m_synchronousClientNumber;
+    --this->m_registeredClientNumbers[SynchronousType];
 }
 
 void
 ClientNumberManager::RemoveAsynchronousClient( void )
 {
-    std::lock_guard<std::mutex> lockGuard( this->m_clientNumberMutex );
-    --this->m_asynchronousClientNumber;
+    --this->m_registeredClientNumbers[AsynchronousType];
+}
+
+void
+ClientNumberManager::AddConnection( void )
+{
+    ++this->m_connectedClientNumber;
+    ++this->m_connections;
+}
+
+void
+ClientNumberManager::RemoveConnection( void )
+{
+    --this->m_connectedClientNumber;
+    ++this->m_disconnections;
+}
+
+void
+ClientNumberManager::AddReport( const ClientTypeValues clientType, const TSystemTime systemTime )
+{
+    std::atomic<uint64_t> & reports = this->m_reports[clientType];
+    uint64_t currentReports = reports.load();
+    uint64_t newReports;
+    do
+    {
+        TSystemTime reportTime = ( TSystemTime )( currentReports >> 32 );
+        if ( reportTime == systemTime )
+        {
+            newReports = currentReports + 1;
+        }
+        else if ( ( int )( systemTime - reportTime ) > 0 )
+        {
+            newReports = PackReports( systemTime, 1 );
+        }
+        else
+        {
+            return;
+        }
+    }
+    while ( !reports.compare_exchange_weak( currentReports, newReports ) );
+}
+
+void
+ClientNumberManager::StartTimeStep( const TSystemTime systemTime )
+{
+    TClock::time_point now = TClock::now();
+    TCounter churn = this->m_connections.load() + this->m_disconnections.load();
+    double elapsedSeconds = std::chrono::duration<double>( now - this->m_lastTimeStep ).count();
+    if ( elapsedSeconds > 0 )
+    {
+        this->m_churnRate = ( TRate )( churn - this->m_lastChurn ) / elapsedSeconds;
+    }
+    this->m_lastChurn = churn;
+    this->m_lastTimeStep = now;
+    for ( int clientType = SynchronousType; clientType < NumberOfClientTypes; ++clientType )
+    {
+        this->m_previousReports[clientType] = this->GetReportingClientNumber( ( ClientTypeValues )clientType, this->m_systemTime.load() );
+    }
+    this->m_systemTime = systemTime;
+}
+
+void
+ClientNumberManager::SetSubstitutedClients( const TClientNumber numberOfClients )
+{
+    this->m_substitutedClients = numberOfClients;
+    this->m_substitutions += numberOfClients;
 }
 
 ClientNumberManager&
@@ -54,17 +129,48 @@ ClientNumberManager::GetClientNumberManager( void )
 ClientNumberManager::TClientNumber
 ClientNumberManager::GetSynchronousClientNumber( void ) const
 {
-    return ( this->m_synchronousClientNumber );
+    return ( this->m_registeredClientNumbers[SynchronousType].load() );
 }
 
 ClientNumberManager::TClientNumber
 ClientNumberManager::GetAsynchronousClientNumber ( void ) const
 {
-    return ( this->m_asynchronousClientNumber );
+    return ( this->m_registeredClientNumbers[AsynchronousType].load() );
 }
 
 ClientNumberManager::TClientNumber
 ClientNumberManager::GetClientNumber( void ) const
 {
-    return ( this->m_synchronousClientNumber + this->m_asynchronousClientNumber );
-}
\ No newline at end of file
+    return ( this->GetSynchronousClientNumber() + this->GetAsynchronousClientNumber() );
+}
+
+ClientNumberManager::TClientNumber
+ClientNumberManager::GetReportingClientNumber( const ClientTypeValues clientType, const TSystemTime systemTime ) const
+{
+    uint64_t reports = this->m_reports[clientType].load();
+    if ( ( TSystemTime )( reports >> 32 ) != systemTime )
+    {
+        return ( 0 );
+    }
+    return ( ( TClientNumber )( reports & 0xFFFFFFFF ) );
+}
+
+ClientNumberManager::Metrics
+ClientNumberManager::GetMetrics( void ) const
+{
+    Metrics metrics;
+    TSystemTime systemTime = this->m_systemTime.load();
+    metrics.connectedClients = this->m_connectedClientNumber.load();
+    for ( int clientType = SynchronousType; clientType < NumberOfClientTypes; ++clientType )
+    {
+        metrics.registeredClients[clientType] = this->m_registeredClientNumbers[clientType].load();
+        metrics.reportingClients[clientType] = this->GetReportingClientNumber( ( ClientTypeValues )clientType, systemTime );
+        metrics.reportedClients[clientType] = this->m_previousReports[clientType].load();
+    }
+    metrics.substitutedClients = this->m_substitutedClients.load();
+    metrics.substitutions = this->m_substitutions.load();
+    metrics.connections = this->m_connections.load();
+    metrics.disconnections = this->m_disconnections.load();
+    metrics.churnRate = this->m_churnRate.load();
+    return ( metrics );
+}
@@ -9,7 +9,9 @@
 #ifndef __S2Sim__ClientNumberManager__
 #define __S2Sim__ClientNumberManager__
 
-#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
 #include "MessageHeader.h"
 
 class ClientNumberManager
@@ -17,9 +19,51 @@ class ClientNumberManager
     public:
         typedef TerraSwarm::MessageHeader::TId TClientNumber;
     
+        typedef unsigned int TSystemTime;
+    
+        typedef unsigned long long TCounter;
+    
+        typedef double TRate;
+    
+        enum ClientTypeValues
+        {
+            SynchronousType = 0,
+            AsynchronousType = 1,
+            NumberOfClientTypes = 2
+        };
+    
+        struct Metrics
+        {
+            TClientNumber connectedClients;
+    
+            TClientNumber registeredClients[NumberOfClientTypes];
+    
+            TClientNumber reportingClients[NumberOfClientTypes];
+    
+            TClientNumber reportedClients[NumberOfClientTypes];
+    
+            TClientNumber substitutedClients;
+    
+            TCounter substitutions;
+    
+            TCounter connections;
+    
+            TCounter disconnections;
+    
+            TRate churnRate;
+        };
+    
     private:
+        typedef std::chrono::steady_clock TClock;
+    
         ClientNumberManager( void );
     
+        static uint64_t
+        PackReports( const TSystemTime systemTime, const TClientNumber numberOfClients )
+        {
+            return ( ( ( uint64_t )systemTime << 32 ) | numberOfClients );
+        }
+    
     public:
         ~ClientNumberManager( void );
     
@@ -35,6 +79,21 @@ class ClientNumberManager
         void
         RemoveAsynchronousClient( void );
     
+        void
+        AddConnection( void );
+    
+        void
+        RemoveConnection( void );
+    
+        void
+        AddReport( const ClientTypeValues clientType, const TSystemTime systemTime );
+    
+        void
+        StartTimeStep( const TSystemTime systemTime );
+    
+        void
+        SetSubstitutedClients( const TClientNumber numberOfClients );
+    
         static ClientNumberManager&
         GetClientNumberManager( void );
     
@@ -47,12 +106,36 @@ class ClientNumberManager
         TClientNumber
         GetClientNumber( void ) const;
     
+        TClientNumber
+        GetReportingClientNumber( const ClientTypeValues clientType, const TSystemTime systemTime ) const;
+    
+        Metrics
+        GetMetrics( void ) const;
+    
     private:
-        std::mutex m_clientNumberMutex;
+        std::atomic<TClientNumber> m_registeredClientNumbers[NumberOfClientTypes];
+    
+        std::atomic<uint64_t> m_reports[NumberOfClientTypes];
+    
+        std::atomic<TClientNumber> m_previousReports[NumberOfClientTypes];
+    
+        std::atomic<TClientNumber> m_connectedClientNumber;
+    
+        std::atomic<TClientNumber> m_substitutedClients;
+    
+        std::atomic<TCounter> m_substitutions;
+    
+        std::atomic<TCounter> m_connections;
+    
+        std::atomic<TCounter> m_disconnections;
+    
+        std::atomic<TRate> m_churnRate;
+    
+        std::atomic<TSystemTime> m_systemTime;
     
-        TClientNumber m_synchronousClientNumber;
+        TCounter m_lastChurn;
     
-        TClientNumber m_asynchronousClientNumber;
+        TClock::time_point m_lastTimeStep;
 };
 
 #endif /* defined(__S2Sim__ClientNumberManager__) */
@@ -0,0 +1,65 @@
+/**
+ * @file ClientRegistry.cpp
+ * Implements the ClientRegistry class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "ClientRegistry.h"
+#include "ClientManager.h"
+
+void
+ClientRegistry::Register( const TClientId clientId, const TClientName & clientName, const SmartPointer<ClientManager> & manager )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_lock );
+    if ( this->m_clients.insert( std::make_pair( clientId, TClient( clientName, manager ) ) ).second )
+    {
+        this->m_snapshot.reset();
+    }
+}
+
+void
+ClientRegistry::UnRegister( const TClientId clientId )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_lock );
+    if ( this->m_clients.erase( clientId ) > 0 )
+    {
+        this->m_snapshot.reset();
+    }
+}
+
+bool
+ClientRegistry::GetClientName( const TClientId clientId, TClientName & clientName ) const
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_lock );
+    TClientMap::const_iterator client = this->m_clients.find( clientId );
+    if ( client == this->m_clients.end() )
+    {
+        return ( false );
+    }
+    clientName = client->second.first;
+    return ( true );
+}
+
+SmartPointer<ClientManager>
+ClientRegistry::GetClientManager( const TClientId clientId ) const
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_lock );
+    TClientMap::const_iterator client = this->m_clients.find( clientId );
+    if ( client == this->m_clients.end() )
+    {
+        return ( SmartPointer<ClientManager>() );
+    }
+    return ( client->second.second );
+}
+
+ClientRegistry::TSnapshot
+ClientRegistry::GetSnapshot( void )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_lock );
+    if ( !this->m_snapshot )
+    {
+        this->m_snapshot = std::make_shared<const TClientMap>( this->m_clients );
+    }
+    return ( this->m_snapshot );
+}
@@ -0,0 +1,120 @@
+/**
+ * @file ClientRegistry.h
+ * Defines the ClientRegistry class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef CLIENTREGISTRY_H_
+#define CLIENTREGISTRY_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include "SmartPointer.hpp"
+#include "MessageHeader.h"
+#include "ClientConnectionRequest.h"
+
+using namespace TerraSwarm;
+
+class ClientManager;
+
+/**
+ *  @brief Registry of the connected clients with snapshot iteration.
+
+    Registering and unregistering a client changes the registry under a short lock. Iterating the clients, e.g. for a decision, takes a snapshot, an immutable copy of the registry shared until the next change. The snapshot is iterated without a lock, so the registry can change during the iteration, and the iteration still sees a consistent set of clients. The snapshot keeps its client managers alive until it is released.
+ */
+class ClientRegistry
+{
+    public:
+    /**
+     *  Defines the type for the unique client id.
+     */
+        typedef MessageHeader::TId TClientId;
+
+    /**
+     *  Defines the type for the object name.
+     */
+        typedef Asynchronous::ClientConnectionRequest::TClientName TClientName;
+
+    /**
+     *  Defines the object name and the connection manager of a registered client. A pair is used, as ClientManager is not complete where the registry is declared.
+     */
+        typedef std::pair<TClientName, SmartPointer<ClientManager>> TClient;
+
+    /**
+     *  Defines the type holding the clients ordered by their ids.
+     */
+        typedef std::map<TClientId, TClient> TClientMap;
+
+    /**
+     *  Defines the type of a snapshot.
+     */
+        typedef std::shared_ptr<const TClientMap> TSnapshot;
+
+    private:
+    /**
+     *  Registered clients.
+     */
+        TClientMap m_clients;
+
+    /**
+     *  Copy of the registered clients, null if the registry changed after it was taken.
+     */
+        TSnapshot m_snapshot;
+
+    /**
+     *  Protects the registered clients and the snapshot.
+     */
+        mutable std::mutex m_lock;
+
+    public:
+    /**
+     *  Adds a client, an already registered id is kept.
+     *
+     *  @param clientId   Unique client id.
+     *  @param clientName Object name of the client.
+     *  @param manager    Manager of the client connection.
+     */
+        void
+        Register( const TClientId clientId, const TClientName & clientName, const SmartPointer<ClientManager> & manager );
+
+    /**
+     *  Removes a client if it is registered.
+     *
+     *  @param clientId Unique client id.
+     */
+        void
+        UnRegister( const TClientId clientId );
+
+    /**
+     *  Looks up the object name of a client.
+     *
+     *  @param clientId   Unique client id.
+     *  @param clientName Object name of the client.
+     *
+     *  @return false if the client is not registered.
+     */
+        bool
+        GetClientName( const TClientId clientId, TClientName & clientName ) const;
+
+    /**
+     *  Looks up the manager of a client.
+     *
+     *  @param clientId Unique client id.
+     *
+     *  @return Manager of the client connection, null if the client is not registered.
+     */
+        SmartPointer<ClientManager>
+        GetClientManager( const TClientId clientId ) const;
+
+    /**
+     *  Returns the registered clients. The copy is made only if the registry changed after the previous snapshot.
+     *
+     *  @return Immutable copy of the registered clients.
+     */
+        TSnapshot
+        GetSnapshot( void );
+};
+
+#endif /* CLIENTREGISTRY_H_ */
@@ -6,6 +6,7 @@
  */
 
 #include "ConnectionManager.h"
+#include "ControlManager.h"
 
 static SmartPointer<ConnectionManager> connectionManager = CreateObject<ConnectionManager>();
 
@@ -15,27 +16,278 @@ GetConnectionManager( void )
     return ( connectionManager );
 }
 
-ConnectionManager::ConnectionManager( void )
+ConnectionManager::ConnectionManager( void ) : m_acceptTokens( 0 ),
+                                               m_numberOfAccepted( 0 ),
+                                               m_numberOfRateLimited( 0 ),
+                                               m_numberOfQueueRejected( 0 ),
+                                               m_numberOfSilent( 0 ),
+                                               m_numberOfHandshakes( 0 ),
+                                               m_maximumQueueLength( 0 ),
+                                               m_numberOfDatagrams( 0 ),
+                                               m_numberOfAcceptedDatagrams( 0 ),
+                                               m_numberOfUnknownDatagrams( 0 ),
+                                               m_numberOfRejectedDatagrams( 0 ),
+                                               m_numberOfOutdatedDatagrams( 0 )
 {
     LOG_FUNCTION_START();
-    this->m_server.SetPort( 26999 );
     LOG_FUNCTION_END();
 }
 
 void
-ConnectionManager::Initialize( void )
+ConnectionManager::Initialize( const Configuration & configuration )
 {
     LOG_FUNCTION_START();
-    this->m_server.SetNotificationCallback( CreateFunctionPointer( GetConnectionManager(), &ConnectionManager::IncomingConnection ) );
+    this->m_configuration = configuration;
+    this->m_configuration.numberOfAcceptors = std::max<TNumber>( this->m_configuration.numberOfAcceptors, 1 );
+    this->m_configuration.numberOfWorkers = std::max<TNumber>( this->m_configuration.numberOfWorkers, 1 );
+    this->m_acceptTokens = std::max<TConnectionRate>( this->m_configuration.acceptRate, 1 );
+    this->m_lastRefill = TClock::now();
+
+    for ( TNumber workerIndex = 0; workerIndex < this->m_configuration.numberOfWorkers; ++workerIndex )
+    {
+        std::thread( &ConnectionManager::HandshakeWorker, this ).detach();
+    }
+    for ( TNumber acceptorIndex = 0; this->m_configuration.usePort && acceptorIndex < this->m_configuration.numberOfAcceptors; ++acceptorIndex )
+    {
+        auto acceptor = CreateObject<ThreadedTCPServer>();
+        if ( this->m_configuration.numberOfAcceptors > 1 )
+        {
+            acceptor->SetReusePort();
+        }
+        acceptor->SetBacklog( this->m_configuration.listenBacklog );
+        acceptor->SetConnectionOptions( this->m_configuration.socketOptions );
+        acceptor->SetPort( 26999 );
+        acceptor->SetNotificationCallback( CreateFunctionPointer( GetConnectionManager(), &ConnectionManager::IncomingConnection ) );
+        this->m_acceptors.push_back( acceptor );
+    }
+    if ( !this->m_configuration.localPath.empty() )
+    {
+        auto acceptor = CreateObject<ThreadedTCPServer>();
+        if ( acceptor->SetLocalPath( this->m_configuration.localPath ) )
+        {
+            acceptor->SetBacklog( this->m_configuration.listenBacklog );
+            acceptor->SetConnectionOptions( this->m_configuration.socketOptions );
+            acceptor->SetNotificationCallback( CreateFunctionPointer( GetConnectionManager(), &ConnectionManager::IncomingConnection ) );
+            this->m_acceptors.push_back( acceptor );
+        }
+    }
+    if ( this->m_configuration.datagramPort != 0 )
+    {
+        this->m_configuration.datagramBatchSize = std::max<TNumber>( this->m_configuration.datagramBatchSize, 1 );
+        this->m_datagramSocket = CreateObject<UDPSocket>();
+        this->m_datagramSocket->SetReceiveBufferSize( DatagramReceiveBufferSize );
+        this->m_datagramSocket->SetPort( this->m_configuration.datagramPort );
+        std::thread( &ConnectionManager::DatagramReceiver, this ).detach();
+    }
     LOG_FUNCTION_END();
 }
 
+void
+ConnectionManager::DatagramReceiver( void )
+{
+    const UDPSocket::TNumberOfMessages batchSize = this->m_configuration.datagramBatchSize;
+    std::vector<char> buffer( batchSize * DatagramSlotSize );
+    std::vector<UDPSocket::TNumberOfBytes> lengths( batchSize );
+    std::vector<IPAddress> sourceAddresses( batchSize );
+    while ( true )
+    {
+        UDPSocket::TNumberOfMessages numberOfMessages = this->m_datagramSocket->ReceiveMessages( buffer.data(), DatagramSlotSize, lengths.data(), sourceAddresses.data(), batchSize );
+        this->m_numberOfDatagrams += numberOfMessages;
+        for ( UDPSocket::TNumberOfMessages messageIndex = 0; messageIndex < numberOfMessages; ++messageIndex )
+        {
+            const char* datagram = buffer.data() + messageIndex * DatagramSlotSize;
+            if ( lengths[messageIndex] < MessageHeader::MessageHeaderSize )
+            {
+                ++this->m_numberOfRejectedDatagrams;
+                continue;
+            }
+            SmartPointer<ClientManager> clientManager = GetControlManager()->GetClientManager( ( ( const MessageHeader* )datagram )->GetSenderId() );
+            if ( clientManager.IsNull() )
+            {
+                ++this->m_numberOfUnknownDatagrams;
+                continue;
+            }
+            switch ( clientManager->DatagramReceived( datagram, lengths[messageIndex], sourceAddresses[messageIndex] ) )
+            {
+                case ClientManager::DatagramAccepted:
+                    ++this->m_numberOfAcceptedDatagrams;
+                    break;
+                case ClientManager::DatagramOutdated:
+                    ++this->m_numberOfOutdatedDatagrams;
+                    break;
+                default:
+                    ++this->m_numberOfRejectedDatagrams;
+                    break;
+            }
+        }
+    }
+}
+
+bool
+ConnectionManager::TakeAcceptToken( void )
+{
+    if ( this->m_configuration.acceptRate <= 0 )
+    {
+        return ( true );
+    }
+    TClock::time_point now = TClock::now();
+    this->m_acceptTokens = std::min( std::max<TConnectionRate>( this->m_configuration.acceptRate, 1 ),
+                                     this->m_acceptTokens + this->m_configuration.acceptRate * std::chrono::duration<TConnectionRate>( now - this->m_lastRefill ).count() );
+    this->m_lastRefill = now;
+    if ( this->m_acceptTokens < 1 )
+    {
+        return ( false );
+    }
+    this->m_acceptTokens -= 1;
+    return ( true );
+}
+
 void
 ConnectionManager::IncomingConnection( const SmartPointer<ThreadedTCPConnectedClient> & newClient )
 {
     LOG_FUNCTION_START();
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lockGuard( this->m_queueLock );
+        if ( !this->TakeAcceptToken() )
+        {
+            ++this->m_numberOfRateLimited;
+        }
+        else if ( this->m_queue.size() >= this->m_configuration.maximumQueueLength )
+        {
+            ++this->m_numberOfQueueRejected;
+        }
+        else
+        {
+            this->m_queue.push_back( newClient );
+            ++this->m_numberOfAccepted;
+            this->m_maximumQueueLength = std::max( this->m_maximumQueueLength, ( TNumber )this->m_queue.size() );
+            queued = true;
+        }
+    }
+    if ( queued )
+    {
+        LogPrint( "Queued the new connection for a handshake" );
+        this->m_queueCondition.notify_one();
+    }
+    else
+    {
+        LogPrint( "Connection limit exceeded, closing the new connection" );
+        newClient->StopThread( newClient );
+    }
+    LOG_FUNCTION_END();
+}
+
+void
+ConnectionManager::HandshakeWorker( void )
+{
+    while ( true )
+    {
+        SmartPointer<ThreadedTCPConnectedClient> newClient;
+        {
+            std::unique_lock<std::mutex> queueLock( this->m_queueLock );
+            while ( this->m_queue.empty() )
+            {
+                this->m_queueCondition.wait( queueLock );
+            }
+            newClient = this->m_queue.front();
+            this->m_queue.pop_front();
+        }
+        this->Handshake( newClient );
+    }
+}
+
+void
+ConnectionManager::Handshake( const SmartPointer<ThreadedTCPConnectedClient> & newClient )
+{
+    LOG_FUNCTION_START();
+    char firstMessage[FirstMessageBufferSize];
+    memset( firstMessage, 0x00, FirstMessageBufferSize );
+    newClient->SetMaximumQueuedBytes( this->m_configuration.maximumQueuedBytes );
+    newClient->SetReceiveTimeout( this->m_configuration.handshakeTimeout );
+    ThreadedTCPConnectedClient::TNumberOfBytes receivedBytes = newClient->ReceiveData( firstMessage, FirstMessageBufferSize );
+    newClient->SetReceiveTimeout( 0 );
+    if ( receivedBytes == 0 || receivedBytes > FirstMessageBufferSize )
+    {
+        LogPrint( "No message received from the new connection, closing it" );
+        {
+            std::lock_guard<std::mutex> lockGuard( this->m_queueLock );
+            ++this->m_numberOfSilent;
+        }
+        newClient->StopThread( newClient );
+        LOG_FUNCTION_END();
+        return;
+    }
+
     LogPrint( "Creating a client manager for the new connection" );
     auto newClientManager = CreateObject<ClientManager>( newClient );
-    newClientManager->Initialize( newClientManager );
+    newClientManager->Initialize( newClientManager, firstMessage, receivedBytes );
+    {
+        std::lock_guard<std::mutex> lockGuard( this->m_queueLock );
+        ++this->m_numberOfHandshakes;
+    }
     LOG_FUNCTION_END();
 }
+
+void
+ConnectionManager::PrintStatistics( void )
+{
+    TCounter numberOfAccepted, numberOfRateLimited, numberOfQueueRejected, numberOfSilent, numberOfHandshakes;
+    TNumber queueLength, maximumQueueLength;
+    {
+        std::lock_guard<std::mutex> lockGuard( this->m_queueLock );
+        numberOfAccepted = this->m_numberOfAccepted;
+        numberOfRateLimited = this->m_numberOfRateLimited;
+        numberOfQueueRejected = this->m_numberOfQueueRejected;
+        numberOfSilent = this->m_numberOfSilent;
+        numberOfHandshakes = this->m_numberOfHandshakes;
+        queueLength = ( TNumber )this->m_queue.size();
+        maximumQueueLength = this->m_maximumQueueLength;
+    }
+    LogPrint( "Connections accepted: ", numberOfAccepted,
+              " handshakes: ", numberOfHandshakes,
+              " without message: ", numberOfSilent,
+              " rate limited: ", numberOfRateLimited,
+              " queue full: ", numberOfQueueRejected,
+              " queue length: ", queueLength, " (maximum ", maximumQueueLength, ")" );
+    ClientNumberManager::Metrics clientMetrics = ClientNumberManager::GetClientNumberManager().GetMetrics();
+    LogPrint( "Clients connected: ", clientMetrics.connectedClients,
+              " registered synchronous: ", clientMetrics.registeredClients[ClientNumberManager::SynchronousType],
+              " asynchronous: ", clientMetrics.registeredClients[ClientNumberManager::AsynchronousType],
+              " reported last step synchronous: ", clientMetrics.reportedClients[ClientNumberManager::SynchronousType],
+              " asynchronous: ", clientMetrics.reportedClients[ClientNumberManager::AsynchronousType],
+              " substituted last step: ", clientMetrics.substitutedClients,
+              " total: ", clientMetrics.substitutions,
+              " connections: ", clientMetrics.connections,
+              " disconnections: ", clientMetrics.disconnections,
+              " churn: ", clientMetrics.churnRate, "/s" );
+    SystemManager::DeadlineStatistics deadlineStatistics = GetSystemManager().GetDeadlineStatistics();
+    LogPrint( "Deadline last step: ", deadlineStatistics.deadline.count(), " ms",
+              " on time: ", 100 * deadlineStatistics.onTimeFraction, "%",
+              " arrival percentile: ", deadlineStatistics.arrivalPercentile.count(), " ms",
+              " next deadline: ", deadlineStatistics.nextDeadline.count(), " ms" );
+    if ( !this->m_datagramSocket.IsNull() )
+    {
+        LogPrint( "Datagrams received: ", this->m_numberOfDatagrams.load(),
+                  " accepted: ", this->m_numberOfAcceptedDatagrams.load(),
+                  " unknown client: ", this->m_numberOfUnknownDatagrams.load(),
+                  " rejected: ", this->m_numberOfRejectedDatagrams.load(),
+                  " outdated: ", this->m_numberOfOutdatedDatagrams.load() );
+    }
+    for ( TNumber acceptorIndex = 0; acceptorIndex < this->m_acceptors.size(); ++acceptorIndex )
+    {
+        unsigned int backlogLength, backlogLimit;
+        if ( this->m_acceptors[acceptorIndex]->GetAcceptBacklog( backlogLength, backlogLimit ) )
+        {
+            LogPrint( "Acceptor ", acceptorIndex, " accept queue: ", backlogLength, " of ", backlogLimit );
+        }
+    }
+#if defined( __linux__ )
+    SendReactor::Statistics sendStatistics = SendReactor::GetSendReactor().GetStatistics();
+    LogPrint( "Outbound queued bytes: ", sendStatistics.queuedBytes, " (maximum ", sendStatistics.maximumQueuedBytes, ")",
+              " deferred sends: ", sendStatistics.deferredSends,
+              " flushes: ", sendStatistics.flushes,
+              " slow consumers evicted: ", sendStatistics.evictions,
+              " send failures: ", sendStatistics.failures );
+#endif
+}
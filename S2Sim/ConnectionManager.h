@@ -11,12 +11,18 @@
 #include "ClientManager.h"
 #include "ThreadedTCPServer.h"
 #include "ThreadedTCPConnectedClient.h"
+#include "SendReactor.h"
+#include "UDPSocket.h"
 #include "LogPrint.h"
 
 #include <map>
 #include <algorithm>
 #include <fstream>
 #include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 class ClientManager;
 
@@ -46,6 +52,8 @@ ConnectionNotificationHandler( TCPConnectedClient* acceptedClient );
  *  @brief Manages connections to all clients.
  *
  *  This class manages the connections to all clients. It implements a TCP server and answers any connection attempts. It forwards received data to the correct ClientManager instance for processing.
+ *
+ *  The accepting threads only queue the new connections. A fixed number of handshake workers receive the first message of a connection, e.g. the connection request, and process it before the ClientManager starts receiving. The queue is bounded and the accepted connections can be rate limited, a connection over either limit is closed immediately. A burst of connections therefore waits in the queue instead of running all handshakes at once.
  */
 class ConnectionManager
 {
@@ -56,11 +64,217 @@ class ConnectionManager
      */
     friend class SmartPointer<ConnectionManager>;
 
+    public:
+    /**
+     *  Defines the type for the number of threads and queued connections.
+     */
+        typedef unsigned int TNumber;
+
+    /**
+     *  Defines the type for the connection counters.
+     */
+        typedef unsigned long long TCounter;
+
+    /**
+     *  Defines the type for the accepted connections per second.
+     */
+        typedef double TConnectionRate;
+
+    /**
+     *  Parameters of the connection handling, set before ConnectionManager::Initialize().
+     */
+        struct Configuration
+        {
+            /**
+             *  Number of threads accepting connections, each with its own socket listening to the same port. More than one requires SO_REUSEPORT.
+             */
+            TNumber numberOfAcceptors;
+
+            /**
+             *  Length of the accept queue of each listening socket in the OS.
+             */
+            TNumber listenBacklog;
+
+            /**
+             *  Number of threads processing the handshakes.
+             */
+            TNumber numberOfWorkers;
+
+            /**
+             *  Maximum number of connections waiting for a handshake worker.
+             */
+            TNumber maximumQueueLength;
+
+            /**
+             *  Maximum accepted connections per second, 0 for no limit. Bursts of up to a second worth of connections are accepted.
+             */
+            TConnectionRate acceptRate;
+
+            /**
+             *  Longest wait for the first message of a connection in milliseconds.
+             */
+            TNumber handshakeTimeout;
+
+            /**
+             *  Limit of the outbound queue of a client in bytes. A client that does not read its messages fast enough to stay below it is disconnected.
+             */
+            ThreadedTCPConnectedClient::TNumberOfBytes maximumQueuedBytes;
+
+            /**
+             *  Socket options of the client connections.
+             */
+            SocketOptions socketOptions;
+
+            /**
+             *  Path of a Unix domain socket accepting the clients on the same host next to the port, empty for none.
+             */
+            std::string localPath;
+
+            /**
+             *  Indicates whether the clients are accepted on the TCP port.
+             */
+            bool usePort;
+
+            /**
+             *  UDP port receiving the synchronous client data as datagrams, 0 for none. The other messages stay on the connections.
+             */
+            IPAddress::TPort datagramPort;
+
+            /**
+             *  Maximum number of datagrams received with a single system call.
+             */
+            TNumber datagramBatchSize;
+
+            /**
+             *  Sets the default parameters.
+             */
+            Configuration( void ) : numberOfAcceptors( 1 ),
+                                    listenBacklog( 1024 ),
+                                    numberOfWorkers( 4 ),
+                                    maximumQueueLength( 1024 ),
+                                    acceptRate( 0 ),
+                                    handshakeTimeout( 5000 ),
+                                    maximumQueuedBytes( 0x100000 ),
+                                    socketOptions( SocketOptions::GetClientProfile() ),
+                                    localPath(),
+                                    usePort( true ),
+                                    datagramPort( 0 ),
+                                    datagramBatchSize( 64 )
+            {
+            }
+        };
+
     private:
     /**
-     *  Instance of the TCP server.
+     *  Defines the clock used for the rate limit.
+     */
+        typedef std::chrono::steady_clock TClock;
+
+    /**
+     *  Size of the buffer receiving the first message, same as the reception buffer of ThreadedTCPConnectedClient.
      */
-        ThreadedTCPServer m_server;
+        enum BufferValues
+        {
+            FirstMessageBufferSize = 10000,
+            DatagramSlotSize = 64, /**< Reception slot of a datagram, longer than a synchronous client data message. */
+            DatagramReceiveBufferSize = 0x400000 /**< Receive buffer of the datagram socket, holding the datagrams of a burst. */
+        };
+
+    private:
+    /**
+     *  Parameters of the connection handling.
+     */
+        Configuration m_configuration;
+
+    /**
+     *  TCP servers listening to the client port, followed by the Unix domain socket server if there is one.
+     */
+        std::vector<SmartPointer<ThreadedTCPServer>> m_acceptors;
+
+    /**
+     *  Connections waiting for a handshake worker.
+     */
+        std::deque<SmartPointer<ThreadedTCPConnectedClient>> m_queue;
+
+    /**
+     *  Protects the queue, the rate limit and the counters.
+     */
+        std::mutex m_queueLock;
+
+    /**
+     *  Signals the handshake workers that a connection is queued.
+     */
+        std::condition_variable m_queueCondition;
+
+    /**
+     *  Connections that can be accepted without exceeding the rate limit.
+     */
+        TConnectionRate m_acceptTokens;
+
+    /**
+     *  Time the accept tokens were last refilled.
+     */
+        TClock::time_point m_lastRefill;
+
+    /**
+     *  Number of connections accepted into the queue.
+     */
+        TCounter m_numberOfAccepted;
+
+    /**
+     *  Number of connections closed because of the rate limit.
+     */
+        TCounter m_numberOfRateLimited;
+
+    /**
+     *  Number of connections closed because the queue was full.
+     */
+        TCounter m_numberOfQueueRejected;
+
+    /**
+     *  Number of connections closed or timed out before their first message.
+     */
+        TCounter m_numberOfSilent;
+
+    /**
+     *  Number of processed handshakes.
+     */
+        TCounter m_numberOfHandshakes;
+
+    /**
+     *  Longest queue since the start.
+     */
+        TNumber m_maximumQueueLength;
+
+    /**
+     *  Socket receiving the synchronous client data, null if the datagrams are not enabled.
+     */
+        SmartPointer<UDPSocket> m_datagramSocket;
+
+    /**
+     *  Number of received datagrams.
+     */
+        std::atomic<TCounter> m_numberOfDatagrams;
+
+    /**
+     *  Number of datagrams registered as client data.
+     */
+        std::atomic<TCounter> m_numberOfAcceptedDatagrams;
+
+    /**
+     *  Number of datagrams from a client id that is not connected.
+     */
+        std::atomic<TCounter> m_numberOfUnknownDatagrams;
+
+    /**
+     *  Number of datagrams that are not synchronous client data, or not sent from the address of the client connection.
+     */
+        std::atomic<TCounter> m_numberOfRejectedDatagrams;
+
+    /**
+     *  Number of datagrams older than the last accepted datagram of their client.
+     */
+        std::atomic<TCounter> m_numberOfOutdatedDatagrams;
 
     private:
     /**
@@ -68,19 +282,58 @@ class ConnectionManager
      */
         ConnectionManager( void );
 
+    /**
+     *  Takes an accept token if the rate limit allows another connection. Must be called with m_queueLock taken.
+     *
+     *  @return false if the connection exceeds the rate limit.
+     */
+        bool
+        TakeAcceptToken( void );
+
+    /**
+     *  Execution body of a handshake worker, processing the queued connections one by one.
+     */
+        void
+        HandshakeWorker( void );
+
+    /**
+     *  Receives and processes the first message of a connection and hands the connection to a new ClientManager.
+     *
+     *  @param newClient Queued connection.
+     */
+        void
+        Handshake( const SmartPointer<ThreadedTCPConnectedClient> & newClient );
+
+    /**
+     *  Execution body of the datagram receiver. Receives the datagrams in batches and hands each one to the ClientManager of its sender id.
+     */
+        void
+        DatagramReceiver( void );
+
     public:
+    /**
+     *  Starts the handshake workers and the accepting threads.
+     *
+     *  @param configuration Parameters of the connection handling.
+     */
         void
-        Initialize( void );
+        Initialize( const Configuration & configuration = Configuration() );
     
     /**
      *  @brief Incoming connection handler.
      *
-     *  This method handles a new connection from a new client. A new ClientManager is created and the information is added to the lists for book-keeping.
+     *  This method handles a new connection from a new client. The connection is queued for a handshake worker, or closed if it exceeds the rate limit or the queue is full.
      *
      *  @param newClient TCP Information of the new connection.
      */
         void
         IncomingConnection( const SmartPointer<ThreadedTCPConnectedClient> & newClient  );
+
+    /**
+     *  Prints the connection counters, the queue length, the accept queue lengths in the OS and the outbound queue statistics.
+     */
+        void
+        PrintStatistics( void );
 };
 
 SmartPointer<ConnectionManager> &
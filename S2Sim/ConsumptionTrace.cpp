@@ -0,0 +1,114 @@
+/**
+ * @file ConsumptionTrace.cpp
+ * Implements the ConsumptionTrace class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <algorithm>
+#include "ConsumptionTrace.h"
+
+ConsumptionTrace::ConsumptionTrace( const TTime startTime, const TTime resolution ) : m_startTime( startTime ),
+                                                                                       m_resolution( resolution ),
+                                                                                       m_numberOfDataPoints( 0 ),
+                                                                                       m_cursorIndex( 0 )
+{
+    this->m_cursor.offset = 0;
+    this->m_cursor.previousValue = 0;
+}
+
+bool
+ConsumptionTrace::Load( const void* encodedData, const TDataSize encodedSize, const TNumberOfDataPoints numberOfDataPoints )
+{
+    const unsigned char* data = ( const unsigned char* )encodedData;
+    TraceCodec::Decoder decoder( data, encodedSize );
+    std::vector<Checkpoint> checkpoints;
+    checkpoints.reserve( numberOfDataPoints / CheckpointInterval + 1 );
+    for ( TNumberOfDataPoints index = 0; index < numberOfDataPoints; ++index )
+    {
+        if ( index % CheckpointInterval == 0 )
+        {
+            Checkpoint checkpoint;
+            checkpoint.offset = ( TDataSize )( ( const unsigned char* )decoder.GetPosition() - data );
+            checkpoint.previousValue = decoder.GetValue();
+            checkpoints.push_back( checkpoint );
+        }
+        TDataPoint value;
+        if ( !decoder.Next( value ) )
+        {
+            return ( false );
+        }
+    }
+    if ( decoder.GetPosition() != data + encodedSize )
+    {
+        return ( false );
+    }
+
+    this->m_encodedData.assign( data, data + encodedSize );
+    this->m_checkpoints.swap( checkpoints );
+    this->m_numberOfDataPoints = numberOfDataPoints;
+    this->m_cursorIndex = 0;
+    this->m_cursor.offset = 0;
+    this->m_cursor.previousValue = 0;
+    return ( true );
+}
+
+void
+ConsumptionTrace::Store( const TDataPoint* dataPoints, const TNumberOfDataPoints numberOfDataPoints )
+{
+    this->m_encodedData.resize( TraceCodec::GetMaximumEncodedSize( numberOfDataPoints ) );
+    this->m_checkpoints.clear();
+    this->m_checkpoints.reserve( numberOfDataPoints / CheckpointInterval + 1 );
+    TDataSize encodedSize = 0;
+    for ( TNumberOfDataPoints index = 0; index < numberOfDataPoints; index += CheckpointInterval )
+    {
+        Checkpoint checkpoint;
+        checkpoint.offset = encodedSize;
+        checkpoint.previousValue = ( index == 0 ) ? 0 : dataPoints[index - 1];
+        this->m_checkpoints.push_back( checkpoint );
+        encodedSize += TraceCodec::Encode( dataPoints + index,
+                                           std::min( ( TNumberOfDataPoints )CheckpointInterval, numberOfDataPoints - index ),
+                                           this->m_encodedData.data() + encodedSize,
+                                           checkpoint.previousValue );
+    }
+    this->m_encodedData.resize( encodedSize );
+    this->m_encodedData.shrink_to_fit();
+    this->m_numberOfDataPoints = numberOfDataPoints;
+    this->m_cursorIndex = 0;
+    this->m_cursor.offset = 0;
+    this->m_cursor.previousValue = 0;
+}
+
+ConsumptionTrace::TDataPoint
+ConsumptionTrace::GetDataPoint( const TTime time )
+{
+    TNumberOfDataPoints index = ( time - this->m_startTime ) / this->m_resolution;
+    if ( index + 1 == this->m_cursorIndex )
+    {
+        return ( this->m_cursor.previousValue );
+    }
+    if ( index < this->m_cursorIndex || index - this->m_cursorIndex >= CheckpointInterval )
+    {
+        this->m_cursorIndex = index - index % CheckpointInterval;
+        this->m_cursor = this->m_checkpoints[index / CheckpointInterval];
+    }
+
+    TraceCodec::Decoder decoder( this->m_encodedData.data() + this->m_cursor.offset,
+                                 ( TDataSize )this->m_encodedData.size() - this->m_cursor.offset,
+                                 this->m_cursor.previousValue );
+    TDataPoint value = this->m_cursor.previousValue;
+    while ( this->m_cursorIndex <= index )
+    {
+        decoder.Next( value );
+        ++this->m_cursorIndex;
+    }
+    this->m_cursor.offset = ( TDataSize )( ( const unsigned char* )decoder.GetPosition() - this->m_encodedData.data() );
+    this->m_cursor.previousValue = value;
+    return ( value );
+}
+
+TDataSize
+ConsumptionTrace::GetMemorySize( void ) const
+{
+    return ( ( TDataSize )( sizeof( ConsumptionTrace ) + this->m_encodedData.capacity() + this->m_checkpoints.capacity() * sizeof( Checkpoint ) ) );
+}
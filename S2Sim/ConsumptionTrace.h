@@ -0,0 +1,227 @@
+/**
+ * @file ConsumptionTrace.h
+ * Defines the ConsumptionTrace class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef CONSUMPTIONTRACE_H_
+#define CONSUMPTIONTRACE_H_
+
+#include <vector>
+#include "TraceCodec.h"
+
+using namespace TerraSwarm;
+
+/**
+ *  @brief Consumption trace of an asynchronous client, stored compressed at its own time resolution.
+
+    The trace keeps the TraceCodec encoding received from the client, or encodes the data points received uncompressed. A data point covers resolution seconds of system time but is stored once. The consumption at a system time is decoded when it is needed. A cursor remembers the last decoded position, so advancing the time by a step decodes a single value. Checkpoints every CheckpointInterval data points bound the cost of going back, e.g. after the predictions of a decision.
+ */
+class ConsumptionTrace
+{
+    public:
+    /**
+     *  Defines the time type, same as the system time.
+     */
+        typedef unsigned int TTime;
+
+    /**
+     *  Defines the data point type.
+     */
+        typedef TraceCodec::TValue TDataPoint;
+
+    /**
+     *  Defines the number of data points type.
+     */
+        typedef TraceCodec::TNumberOfValues TNumberOfDataPoints;
+
+    private:
+    /**
+     *  Number of data points between two checkpoints.
+     */
+        enum CheckpointValues
+        {
+            CheckpointInterval = 64
+        };
+
+    /**
+     *  Decoder state at the start of a data point.
+     */
+        struct Checkpoint
+        {
+            /**
+             *  Offset of the data point in the encoded data.
+             */
+            TDataSize offset;
+
+            /**
+             *  Value of the data point before it.
+             */
+            TDataPoint previousValue;
+        };
+
+    /**
+     *  Time of the first data point.
+     */
+        TTime m_startTime;
+
+    /**
+     *  Time between two data points.
+     */
+        TTime m_resolution;
+
+    /**
+     *  Number of data points in the trace.
+     */
+        TNumberOfDataPoints m_numberOfDataPoints;
+
+    /**
+     *  Encoded data points.
+     */
+        std::vector<unsigned char> m_encodedData;
+
+    /**
+     *  Decoder state at every CheckpointInterval data points.
+     */
+        std::vector<Checkpoint> m_checkpoints;
+
+    /**
+     *  Index of the next data point the cursor decodes.
+     */
+        TNumberOfDataPoints m_cursorIndex;
+
+    /**
+     *  Decoder state of the cursor.
+     */
+        Checkpoint m_cursor;
+
+    public:
+    /**
+     *  Creates an empty trace.
+     *
+     *  @param startTime  Time of the first data point.
+     *  @param resolution Time between two data points.
+     */
+        ConsumptionTrace( const TTime startTime, const TTime resolution );
+
+    /**
+     *  Copies and validates the encoded data points. The checkpoints are built during the validation.
+     *
+     *  @param encodedData        Data points encoded with TraceCodec.
+     *  @param encodedSize        Number of bytes of the encoded data points.
+     *  @param numberOfDataPoints Number of encoded data points.
+     *
+     *  @return false if the encoded data does not contain exactly the given number of data points.
+     */
+        bool
+        Load( const void* encodedData, const TDataSize encodedSize, const TNumberOfDataPoints numberOfDataPoints );
+
+    /**
+     *  Encodes and stores data points, e.g. received uncompressed in an Asynchronous::ClientData message.
+     *
+     *  @param dataPoints         Data points in host byte order.
+     *  @param numberOfDataPoints Number of data points.
+     */
+        void
+        Store( const TDataPoint* dataPoints, const TNumberOfDataPoints numberOfDataPoints );
+
+    /**
+     *  Returns the time of the first data point.
+     *
+     *  @return Start of the trace.
+     */
+        TTime
+        GetStartTime( void ) const
+        {
+            return ( this->m_startTime );
+        }
+
+    /**
+     *  Returns the time between two data points.
+     *
+     *  @return Resolution of the trace.
+     */
+        TTime
+        GetResolution( void ) const
+        {
+            return ( this->m_resolution );
+        }
+
+    /**
+     *  Returns the number of data points.
+     *
+     *  @return Number of data points in the trace.
+     */
+        TNumberOfDataPoints
+        GetNumberOfDataPoints( void ) const
+        {
+            return ( this->m_numberOfDataPoints );
+        }
+
+    /**
+     *  Returns the encoded data points, which can be loaded into another trace with Load().
+     *
+     *  @return Data points encoded with TraceCodec.
+     */
+        const void*
+        GetEncodedData( void ) const
+        {
+            return ( this->m_encodedData.data() );
+        }
+
+    /**
+     *  Returns the size of the encoded data points.
+     *
+     *  @return Number of bytes of the encoded data points.
+     */
+        TDataSize
+        GetEncodedSize( void ) const
+        {
+            return ( ( TDataSize )this->m_encodedData.size() );
+        }
+
+    /**
+     *  Returns the time after the last data point.
+     *
+     *  @return End of the trace.
+     */
+        TTime
+        GetEndTime( void ) const
+        {
+            return ( this->m_startTime + this->m_resolution * this->m_numberOfDataPoints );
+        }
+
+    /**
+     *  Checks whether the trace has a data point for the given time.
+     *
+     *  @param time Time to be checked.
+     *
+     *  @return true if the time is within the trace.
+     */
+        bool
+        Covers( const TTime time ) const
+        {
+            return ( time >= this->m_startTime && time < this->GetEndTime() );
+        }
+
+    /**
+     *  Returns the consumption at the given time. The time must be covered by the trace.
+     *
+     *  @param time Time of the consumption.
+     *
+     *  @return Data point covering the time.
+     */
+        TDataPoint
+        GetDataPoint( const TTime time );
+
+    /**
+     *  Returns the memory used by the trace.
+     *
+     *  @return Number of bytes used for the encoded data and the checkpoints.
+     */
+        TDataSize
+        GetMemorySize( void ) const;
+};
+
+#endif /* CONSUMPTIONTRACE_H_ */
@@ -6,6 +6,7 @@
  */
 
 #include "ControlManager.h"
+#include "ByteOrderConverter.h"
 
 static SmartPointer<ControlManager> controlManager = CreateObject<ControlManager>();
 
@@ -21,6 +22,13 @@ ControlManager::ControlManager( void )
     this->m_readyMutex.lock();
     this->m_clientThreadMutex.lock();
     this->m_server.SetPort( 26997 );
+    this->m_useLocalServer = false;
+    this->m_usePort = true;
+    this->m_decisionTime = 0;
+    this->m_decisionTimeAdvanced = true;
+#if defined( __linux__ )
+    this->m_useSharedMemory = false;
+#endif
     LOG_FUNCTION_END();
 }
 
@@ -28,7 +36,22 @@ void
 ControlManager::Initialize( void )
 {
     LOG_FUNCTION_START();
-    this->m_server.SetNotificationCallback( std::move( CreateFunctionPointer( GetControlManager(), &ControlManager::SetClient ) ) );
+#if defined( __linux__ )
+    if ( this->m_useSharedMemory )
+    {
+        this->m_sharedMemoryServer.SetNotificationCallback( std::move( CreateFunctionPointer( GetControlManager(), &ControlManager::SetClient ) ) );
+        LOG_FUNCTION_END();
+        return;
+    }
+#endif
+    if ( this->m_useLocalServer )
+    {
+        this->m_localServer.SetNotificationCallback( std::move( CreateFunctionPointer( GetControlManager(), &ControlManager::SetClient ) ) );
+    }
+    if ( this->m_usePort )
+    {
+        this->m_server.SetNotificationCallback( std::move( CreateFunctionPointer( GetControlManager(), &ControlManager::SetClient ) ) );
+    }
     LOG_FUNCTION_END();
 }
 
@@ -136,21 +159,41 @@ ControlManager::ProcessData( void* data, const size_t size )
             currentAddress += sizeof( TNumberOfPricePoints );
             TNumberOfPricePoints convertedNumberOfPricePoints = ntohl( numberOfPricePoints );
 
-            SmartPointer<TPrice> priceData = CreateObjectArray<TPrice>( convertedNumberOfPricePoints );
-            memcpy( priceData, currentAddress, sizeof( TPrice ) * convertedNumberOfPricePoints );
+            TPriceView priceData( currentAddress, convertedNumberOfPricePoints );
+            char* priceStart = currentAddress;
             currentAddress += sizeof( TPrice ) * convertedNumberOfPricePoints;
             remainingSize -= sizeof( TPrice ) * convertedNumberOfPricePoints;
             
-            LogPrint( convertedNumberOfPricePoints, " number of prices for Client ", convertedClientId, " set starting with ", ntohl( priceData[0] ) );
-            if ( this->m_clientManagerMap.find( convertedClientId ) == this->m_clientManagerMap.end() )
+            LogPrint( convertedNumberOfPricePoints, " number of prices for Client ", convertedClientId, " set starting with ", priceData[0] );
+            SmartPointer<ClientManager> clientManager = this->m_clients.GetClientManager( convertedClientId );
+            if ( clientManager.IsNull() )
             {
                 ErrorPrint( "Client Id ", convertedClientId, " not found!" );
                 LOG_FUNCTION_END();
                 return;
             }
-            this->m_clientManagerMap[convertedClientId]->SetCurrentPrice( GetSystemManager().GetSystemTime(),
-                                                                          convertedNumberOfPricePoints,
-                                                                          priceData );
+            bool priceHeld = false;
+            this->m_heldPricesLock.lock();
+            if ( !this->m_decisionTimeAdvanced )
+            {
+                HeldPrice heldPrice;
+                heldPrice.clientId = convertedClientId;
+                heldPrice.systemTime = this->m_decisionTime + 1;
+                heldPrice.numberOfPricePoints = convertedNumberOfPricePoints;
+                heldPrice.prices.assign( priceStart, currentAddress );
+                this->m_heldPrices.push_back( heldPrice );
+                priceHeld = true;
+            }
+            this->m_heldPricesLock.unlock();
+            if ( !priceHeld )
+            {
+                clientManager->SetCurrentPrice( GetSystemManager().GetSystemTime(),
+                                                priceData );
+            }
+            if ( convertedNumberOfPricePoints > 0 )
+            {
+                GetSystemManager().ArchiveValue( GridArchive::PriceColumn, convertedClientId, priceData[0] );
+            }
         }
         else if ( messageType == SendPriceProposalType )
         {
@@ -168,11 +211,16 @@ ControlManager::ProcessData( void* data, const size_t size )
 
             LogPrint( "Price of ", convertedPrice, " proposed to Client ", convertedClientId );
 
-            this->m_clientMapLock.lock();
-            this->m_clientManagerMap[convertedClientId]->PriceProposal( convertedPrice,
-                                                                        GetSystemManager().GetSystemTime(),
-                                                                        GetSystemManager().GetSystemTime() + 1 );
-            this->m_clientMapLock.unlock();
+            SmartPointer<ClientManager> clientManager = this->m_clients.GetClientManager( convertedClientId );
+            if ( clientManager.IsNull() )
+            {
+                ErrorPrint( "Client Id ", convertedClientId, " not found!" );
+                LOG_FUNCTION_END();
+                return;
+            }
+            clientManager->PriceProposal( convertedPrice,
+                                          GetSystemManager().GetSystemTime(),
+                                          GetSystemManager().GetSystemTime() + 1 );
         }
         else
         {
@@ -188,17 +236,85 @@ ControlManager::MakeDecision( void )
 {
     LOG_FUNCTION_START();
     LogPrint( "Staring Decision process" );
-    TNumberOfClients numberOfClients = 0;
+    ClientRegistry::TSnapshot clients = this->m_clients.GetSnapshot();
+    TDecisionClientList decisionClients;
+
+    for ( ClientRegistry::TClientMap::const_iterator i = clients->begin(); i != clients->end(); i++ )
+    {
+        if ( i->second.second->IsSynchronous() && this->m_decidedClients.find( i->first ) == this->m_decidedClients.end() )
+        {
+            decisionClients.push_back( std::make_pair( i->first, i->second.first ) );
+        }
+    }
+
+    LogPrint( "Total number of synchronous clients: ", decisionClients.size(), " without the partially decided: ", this->m_decidedClients.size() );
+    this->m_decidedClients.clear();
+    this->SendDecision( MakeDecisionType, decisionClients );
+    LOG_FUNCTION_END();
+}
 
-    for ( TClientManagerMap::iterator i = this->m_clientManagerMap.begin(); i != this->m_clientManagerMap.end(); i++ )
+void
+ControlManager::MakePartialDecision( const std::vector<TClientId> & clientIds )
+{
+    LOG_FUNCTION_START();
+    ClientRegistry::TSnapshot clients = this->m_clients.GetSnapshot();
+    TDecisionClientList decisionClients;
+
+    for ( std::vector<TClientId>::const_iterator clientId = clientIds.begin(); clientId != clientIds.end(); ++clientId )
     {
-        if ( i->second->IsSynchronous() )
+        ClientRegistry::TClientMap::const_iterator client = clients->find( *clientId );
+        if ( client != clients->end() && client->second.second->IsSynchronous() && this->m_decidedClients.insert( *clientId ).second )
         {
-            ++numberOfClients;
+            decisionClients.push_back( std::make_pair( client->first, client->second.first ) );
         }
     }
 
-    LogPrint( "Total number of synchronous clients: ", numberOfClients );
+    if ( !decisionClients.empty() )
+    {
+        LogPrint( "Partial decision for ", decisionClients.size(), " clients" );
+        this->SendDecision( PartialDecisionType, decisionClients );
+    }
+    LOG_FUNCTION_END();
+}
+
+void
+ControlManager::AdvanceDecisionTime( void )
+{
+    LOG_FUNCTION_START();
+    std::lock_guard<std::mutex> lockGuard( this->m_heldPricesLock );
+    this->m_decisionTimeAdvanced = true;
+    for ( std::vector<HeldPrice>::iterator heldPrice = this->m_heldPrices.begin(); heldPrice != this->m_heldPrices.end(); ++heldPrice )
+    {
+        SmartPointer<ClientManager> clientManager = this->m_clients.GetClientManager( heldPrice->clientId );
+        if ( !clientManager.IsNull() )
+        {
+            clientManager->SetCurrentPrice( heldPrice->systemTime, TPriceView( heldPrice->prices.data(), heldPrice->numberOfPricePoints ) );
+        }
+    }
+    this->m_heldPrices.clear();
+    LOG_FUNCTION_END();
+}
+
+void
+ControlManager::SendDecision( const TMessageType messageType, const TDecisionClientList & clients )
+{
+    LOG_FUNCTION_START();
+    TNumberOfClients numberOfClients = ( TNumberOfClients )clients.size();
+    this->m_decisionTime = GetSystemManager().GetSystemTime();
+    std::vector<TClientId> clientIds;
+    for ( TDecisionClientList::const_iterator i = clients.begin(); i != clients.end(); i++ )
+    {
+        clientIds.push_back( i->first );
+    }
+    std::vector<SystemManager::DecisionInformation> decisionInformation = GetSystemManager().GetDecisionInformation( clientIds );
+    std::vector<TClientId> substitutedClients;
+    for ( size_t informationIndex = 0; informationIndex < decisionInformation.size(); ++informationIndex )
+    {
+        if ( decisionInformation[informationIndex].substituted )
+        {
+            substitutedClients.push_back( clientIds[informationIndex] );
+        }
+    }
 
     TDataSize dataSize = sizeof( TDataSize ) +
                          sizeof( TMessageType ) +
@@ -208,16 +324,15 @@ ControlManager::MakeDecision( void )
                          numberOfClients * sizeof( TClientId ) +
                          numberOfClients * sizeof( TClientId ) +
                          numberOfClients * sizeof( TNumberOfDataPoints );
+    if ( GetSystemManager().GetStragglerSubstitution() )
+    {
+        dataSize += sizeof( TNumberOfClients ) + substitutedClients.size() * sizeof( TClientId );
+    }
 
-    this->m_clientMapLock.lock();
-    for ( TClientManagerMap::iterator i = this->m_clientManagerMap.begin(); i != this->m_clientManagerMap.end(); i++ )
+    for ( std::vector<SystemManager::DecisionInformation>::const_iterator i = decisionInformation.begin(); i != decisionInformation.end(); i++ )
     {
-        if ( i->second->IsSynchronous() )
-        {
-            dataSize += GetSystemManager().GetNumberOfConsumptions( i->first ) * ( sizeof( TDataPoint ) + sizeof( TVoltage ) );
-        }
+        dataSize += i->numberOfDataPoints * ( sizeof( TDataPoint ) + sizeof( TVoltage ) );
     }
-    this->m_clientMapLock.unlock();
     
     auto buffer = CreateObjectArray<char>( dataSize );
     char* currentPointer = buffer;
@@ -226,8 +341,8 @@ ControlManager::MakeDecision( void )
     memcpy( currentPointer, &convertedSize, sizeof( TDataSize ) );
     currentPointer += sizeof( TDataSize );
 
-    TMessageType messageType = htonl( MakeDecisionType );
-    memcpy( currentPointer, &messageType, sizeof( TMessageType ) );
+    TMessageType convertedMessageType = htonl( messageType );
+    memcpy( currentPointer, &convertedMessageType, sizeof( TMessageType ) );
     currentPointer += sizeof( TMessageType );
 
     TNumberOfClients convertedNumberOfClients = htons( numberOfClients );
@@ -256,27 +371,23 @@ ControlManager::MakeDecision( void )
     TNumberOfDataPoints maximumNumberOfPoints = 0;
     TNumberOfDataPoints clientIndex = 0;
     
-    this->m_clientMapLock.lock();
-    for ( TClientManagerMap::iterator i = this->m_clientManagerMap.begin(); i != this->m_clientManagerMap.end(); i++ )
+    for ( TDecisionClientList::const_iterator i = clients.begin(); i != clients.end(); i++ )
     {
-        if ( i->second->IsSynchronous() )
+        TNumberOfDataPoints numberOfDataPoints = decisionInformation[clientIndex].numberOfDataPoints;
+        
+        LogPrint( "Number of data points for ", i->first, " is ", numberOfDataPoints );
+        
+        if ( numberOfDataPoints > 0 )
         {
-            TNumberOfDataPoints numberOfDataPoints = GetSystemManager().GetNumberOfConsumptions( i->first );
-            
-            LogPrint( "Number of data points for ", i->first, " is ", numberOfDataPoints );
-            
-            if ( numberOfDataPoints > 0 )
-            {
-                voltageValues[clientIndex] = new TVoltage[numberOfDataPoints];
-                consumptionValues[clientIndex] = new TDataPoint[numberOfDataPoints];
-            }
-            numberOfDataPointValues[clientIndex] = numberOfDataPoints;
-            ++clientIndex;
-            
-            if ( maximumNumberOfPoints < numberOfDataPoints )
-            {
-                maximumNumberOfPoints = numberOfDataPoints;
-            }
+            voltageValues[clientIndex] = new TVoltage[numberOfDataPoints];
+            consumptionValues[clientIndex] = new TDataPoint[numberOfDataPoints];
+        }
+        numberOfDataPointValues[clientIndex] = numberOfDataPoints;
+        ++clientIndex;
+        
+        if ( maximumNumberOfPoints < numberOfDataPoints )
+        {
+            maximumNumberOfPoints = numberOfDataPoints;
         }
     }
     
@@ -286,63 +397,59 @@ ControlManager::MakeDecision( void )
         GetSystemManager().SetConsumptionsToPredictionTime( GetSystemManager().GetSystemTime() + dataIndex );
         
         clientIndex = 0;
-        for ( TClientManagerMap::iterator i = this->m_clientManagerMap.begin(); i != this->m_clientManagerMap.end(); i++ )
+        for ( TDecisionClientList::const_iterator i = clients.begin(); i != clients.end(); i++ )
         {
-            if ( i->second->IsSynchronous() )
+            if ( numberOfDataPointValues[clientIndex] > dataIndex )
             {
-                if ( numberOfDataPointValues[clientIndex] > dataIndex )
-                {
-                    std::pair<TVoltage, TDataPoint> result = GetMatlabManager()->GetVoltageDeviationAndConsumption( this->m_clientIdMap[i->first] );
+                std::pair<TVoltage, TDataPoint> result = GetMatlabManager()->GetVoltageDeviationAndConsumption( i->second );
+            
+                voltageValues[clientIndex][dataIndex] = result.first;
+                consumptionValues[clientIndex][dataIndex] = result.second;
                 
-                    voltageValues[clientIndex][dataIndex] = result.first;
-                    consumptionValues[clientIndex][dataIndex] = result.second;
-                    
-                    LogPrint( "Client ", i->first, "'s predicted deviation: ", voltageValues[clientIndex][dataIndex], ", consumption: ", consumptionValues[clientIndex][dataIndex] );
+                LogPrint( "Client ", i->first, "'s predicted deviation: ", voltageValues[clientIndex][dataIndex], ", consumption: ", consumptionValues[clientIndex][dataIndex] );
+                if ( dataIndex == 0 )
+                {
+                    GetSystemManager().ArchiveValue( GridArchive::VoltageDeviationColumn, i->first, result.first );
                 }
-                ++clientIndex;
             }
+            ++clientIndex;
         }
     }
     
     clientIndex = 0;
-    for ( TClientManagerMap::iterator i = this->m_clientManagerMap.begin(); i != this->m_clientManagerMap.end(); i++ )
+    for ( TDecisionClientList::const_iterator i = clients.begin(); i != clients.end(); i++ )
     {
-        if ( i->second->IsSynchronous() )
+        TClientId clientId =  i->first;
+        TClientId convertedClientId = htons( clientId );
+        
+        TNumberOfDataPoints numberOfDataPoints = numberOfDataPointValues[clientIndex];
+        TNumberOfDataPoints convertedNumberOfDataPoints = htonl( numberOfDataPoints );
+        memcpy( currentPointer, &convertedNumberOfDataPoints, sizeof( TNumberOfDataPoints ) );
+        currentPointer += sizeof( TNumberOfDataPoints );
+        
+        char* dataStart = currentPointer;
+        for ( TNumberOfDataPoints dataIndex = 0; dataIndex < numberOfDataPoints; ++dataIndex )
         {
-            TClientId clientId =  i->first;
-            TClientId convertedClientId = htons( clientId );
-            
-            TNumberOfDataPoints numberOfDataPoints = numberOfDataPointValues[clientIndex];
-            TNumberOfDataPoints convertedNumberOfDataPoints = htonl( numberOfDataPoints );
-            memcpy( currentPointer, &convertedNumberOfDataPoints, sizeof( TNumberOfDataPoints ) );
-            currentPointer += sizeof( TNumberOfDataPoints );
+            memcpy( currentPointer, &consumptionValues[clientIndex][dataIndex], sizeof( TDataPoint ) );
+            currentPointer += sizeof( TDataPoint );
             
-            for ( TNumberOfDataPoints dataIndex = 0; dataIndex < numberOfDataPoints; ++dataIndex )
-            {
-                TDataPoint currentConsumption = consumptionValues[clientIndex][dataIndex];
-                TDataPoint convertedCurrentConsumption = htonl( currentConsumption );
-                memcpy( currentPointer, &convertedCurrentConsumption, sizeof( TDataPoint ) );
-                currentPointer += sizeof( TDataPoint );
-                
-                TVoltage voltage = voltageValues[clientIndex][dataIndex];
-                TVoltage convertedVoltage = htonl( voltage );
-                memcpy( currentPointer, &convertedVoltage, sizeof( TVoltage ) );
-                currentPointer += sizeof( TVoltage );
-            }
-            
-            memcpy( currentPointer, &convertedClientId, sizeof( TClientId ) );
-            currentPointer += sizeof( TClientId );
-            
-            memcpy( currentPointer, &convertedClientId, sizeof( TClientId ) );
-            currentPointer += sizeof( TClientId );
-            
-            if ( numberOfDataPointValues[clientIndex] > 0 )
-            {
-                delete [] consumptionValues[clientIndex];
-                delete [] voltageValues[clientIndex];
-            }
-            ++clientIndex;
+            memcpy( currentPointer, &voltageValues[clientIndex][dataIndex], sizeof( TVoltage ) );
+            currentPointer += sizeof( TVoltage );
+        }
+        ByteOrderConverter::HostToNetwork( dataStart, ( TDataPoint* )dataStart, 2 * numberOfDataPoints );
+        
+        memcpy( currentPointer, &convertedClientId, sizeof( TClientId ) );
+        currentPointer += sizeof( TClientId );
+        
+        memcpy( currentPointer, &convertedClientId, sizeof( TClientId ) );
+        currentPointer += sizeof( TClientId );
+        
+        if ( numberOfDataPointValues[clientIndex] > 0 )
+        {
+            delete [] consumptionValues[clientIndex];
+            delete [] voltageValues[clientIndex];
         }
+        ++clientIndex;
     }
     
     if ( numberOfClients > 0 )
@@ -352,10 +459,25 @@ ControlManager::MakeDecision( void )
         delete [] numberOfDataPointValues;
     }
     
+    if ( GetSystemManager().GetStragglerSubstitution() )
+    {
+        TNumberOfClients convertedNumberOfSubstitutedClients = htons( ( TNumberOfClients )substitutedClients.size() );
+        memcpy( currentPointer, &convertedNumberOfSubstitutedClients, sizeof( TNumberOfClients ) );
+        currentPointer += sizeof( TNumberOfClients );
+        for ( std::vector<TClientId>::const_iterator clientId = substitutedClients.begin(); clientId != substitutedClients.end(); ++clientId )
+        {
+            TClientId convertedClientId = htons( *clientId );
+            memcpy( currentPointer, &convertedClientId, sizeof( TClientId ) );
+            currentPointer += sizeof( TClientId );
+        }
+    }
+    
     GetSystemManager().SetConsumptionsToPredictionTime( GetSystemManager().GetSystemTime() );
     
-    this->m_clientMapLock.unlock();
     LogPrint( "Send Voltage and Consumption Information of synchronous clients to External Controller" );
+    this->m_heldPricesLock.lock();
+    this->m_decisionTimeAdvanced = false;
+    this->m_heldPricesLock.unlock();
     this->m_clientThreadMutex.lock();
     if ( this->m_client->SendData( buffer, dataSize ) <= 0 )
     {
@@ -387,7 +509,7 @@ ControlManager::ClientPriceRequest( const TClientId clientId )
     memcpy( currentPointer, &messageType, sizeof( TMessageType ) );
     currentPointer += sizeof( TMessageType );
 
-    TClientId convertedClientId = htonl( clientId );
+    TClientId convertedClientId = htons( clientId );
     memcpy( currentPointer, &convertedClientId, sizeof( TClientId ) );
     currentPointer += sizeof( TClientId );
 
@@ -405,10 +527,10 @@ ControlManager::ClientPriceRequest( const TClientId clientId )
 
 void
 ControlManager::ClientDemandNegotiation( const TClientId clientId,
-                                         const TNumberOfDataPoints numberOfDataPoints,
-                                         TDataPoint* dataPoints )
+                                         const TDataPointView & dataPoints )
 {
     LOG_FUNCTION_START();
+    TNumberOfDataPoints numberOfDataPoints = dataPoints.GetNumberOfElements();
     LogPrint( "Forward Demand Negotiation response of Client ", clientId, " with ", numberOfDataPoints, " data points to  the External Controller" );
     TDataSize dataSize = sizeof( TDataSize ) +
                          sizeof( TMessageType ) +
@@ -427,7 +549,7 @@ ControlManager::ClientDemandNegotiation( const TClientId clientId,
     memcpy( currentPointer, &messageType, sizeof( TMessageType ) );
     currentPointer += sizeof( TMessageType );
 
-    TClientId convertedClientId = htonl( clientId );
+    TClientId convertedClientId = htons( clientId );
     memcpy( currentPointer, &convertedClientId, sizeof( TClientId ) );
     currentPointer += sizeof( TClientId );
 
@@ -435,12 +557,8 @@ ControlManager::ClientDemandNegotiation( const TClientId clientId,
     memcpy( currentPointer, &convertedNumberOfDataPoints, sizeof( TNumberOfDataPoints ) );
     currentPointer += sizeof( TNumberOfDataPoints );
 
-    for ( TNumberOfDataPoints index = 0; index < numberOfDataPoints; ++index )
-    {
-        TDataPoint convertedDataPoint = htonl( dataPoints[index] );
-        memcpy( currentPointer, &convertedDataPoint, sizeof( TDataPoint ) );
-        currentPointer += sizeof( TDataPoint );
-    }
+    dataPoints.CopyToNetwork( currentPointer );
+    currentPointer += numberOfDataPoints * sizeof( TDataPoint );
 
     this->m_clientThreadMutex.lock();
     if ( this->m_client->SendData( buffer, dataSize ) <= 0 )
@@ -458,27 +576,91 @@ ControlManager::RegisterClient( const TClientId clientId, const TClientName & cl
 {
     LOG_FUNCTION_START();
     LogPrint( "Client ", clientName, " registered on Id: ", clientId );
-    this->m_clientMapLock.lock();
-    this->m_clientIdMap.insert( std::make_pair( clientId, clientName ) );
-    this->m_clientManagerMap.insert( std::make_pair( clientId, clientManager ) );
-    this->m_clientMapLock.unlock();
+    this->m_clients.Register( clientId, clientName, clientManager );
     LOG_FUNCTION_END();
 }
 
+SmartPointer<ClientManager>
+ControlManager::GetClientManager( const TClientId clientId ) const
+{
+    return ( this->m_clients.GetClientManager( clientId ) );
+}
+
+std::vector<ControlManager::TClientId>
+ControlManager::GetSynchronousClientIds( void )
+{
+    ClientRegistry::TSnapshot clients = this->m_clients.GetSnapshot();
+    std::vector<TClientId> clientIds;
+    for ( ClientRegistry::TClientMap::const_iterator client = clients->begin(); client != clients->end(); ++client )
+    {
+        if ( client->second.second->IsSynchronous() )
+        {
+            clientIds.push_back( client->first );
+        }
+    }
+    return ( clientIds );
+}
+
 void
-ControlManager::UnRegisterClient( const TClientId clientId )
+ControlManager::SaveClients( CheckpointWriter & checkpoint )
 {
-    LOG_FUNCTION_START();
-    LogPrint( "Unregistering client ", clientId );
-    this->m_clientMapLock.lock();
-    if ( this->m_clientIdMap.find( clientId ) != this->m_clientIdMap.end() )
+    ClientRegistry::TSnapshot clients = this->m_clients.GetSnapshot();
+    std::lock_guard<std::mutex> lockGuard( this->m_reservedClientLock );
+    checkpoint.Write( ( TNumberOfClients )( clients->size() + this->m_reservedClientMap.size() ) );
+    for ( ClientRegistry::TClientMap::const_iterator client = clients->begin(); client != clients->end(); ++client )
     {
-        this->m_clientIdMap.erase( clientId );
+        checkpoint.Write( client->first );
+        checkpoint.WriteString( client->second.first );
     }
-    if ( this->m_clientManagerMap.find( clientId ) != this->m_clientManagerMap.end() )
+    for ( TClientIdMap::const_iterator client = this->m_reservedClientMap.begin(); client != this->m_reservedClientMap.end(); ++client )
     {
-        this->m_clientManagerMap.erase( clientId );
+        checkpoint.Write( client->first );
+        checkpoint.WriteString( client->second );
     }
-    this->m_clientMapLock.unlock();
+}
+
+bool
+ControlManager::RestoreClients( CheckpointReader & checkpoint )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_reservedClientLock );
+    TNumberOfClients numberOfClients;
+    if ( !checkpoint.Read( numberOfClients ) )
+    {
+        return ( false );
+    }
+    for ( TNumberOfClients clientIndex = 0; clientIndex < numberOfClients; ++clientIndex )
+    {
+        TClientId clientId;
+        TClientName clientName;
+        if ( !checkpoint.Read( clientId ) || !checkpoint.ReadString( clientName ) )
+        {
+            this->m_reservedClientMap.clear();
+            return ( false );
+        }
+        this->m_reservedClientMap[clientId] = clientName;
+    }
+    LogPrint( numberOfClients, " client ids reserved for reconnecting clients" );
+    return ( true );
+}
+
+bool
+ControlManager::ReclaimClient( const TClientId clientId, const TClientName & clientName )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_reservedClientLock );
+    TClientIdMap::iterator client = this->m_reservedClientMap.find( clientId );
+    if ( client == this->m_reservedClientMap.end() || client->second != clientName )
+    {
+        return ( false );
+    }
+    this->m_reservedClientMap.erase( client );
+    return ( true );
+}
+
+void
+ControlManager::UnRegisterClient( const TClientId clientId )
+{
+    LOG_FUNCTION_START();
+    LogPrint( "Unregistering client ", clientId );
+    this->m_clients.UnRegister( clientId );
     LOG_FUNCTION_END();
 }
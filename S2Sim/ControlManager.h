@@ -10,6 +10,7 @@
 
 #include "SystemManager.h"
 #include "ThreadedTCPServer.h"
+#include "ThreadedSharedMemoryServer.h"
 #include "MatlabManager.h"
 #include "ThreadedTCPConnectedClient.h"
 #include "ConnectionManager.h"
@@ -17,8 +18,13 @@
 #include "ClientManager.h"
 #include "LogPrint.h"
 #include "FunctionPointer.hpp"
+#include "CheckpointFile.h"
+#include "ClientRegistry.h"
 
 #include <mutex>
+#include <set>
+#include <vector>
+#include <atomic>
 
 using namespace TerraSwarm;
 
@@ -118,11 +124,26 @@ class ControlManager
      */
         typedef Asynchronous::ClientData::TNumberOfDataPoints TNumberOfDataPoints;
 
+    /**
+     *  Redefines the view of received data points for rapid development.
+     */
+        typedef Synchronous::DemandNegotiation::TDataPointView TDataPointView;
+
+    /**
+     *  Redefines the view of received price points for rapid development.
+     */
+        typedef Synchronous::SetCurrentPrice::TPriceView TPriceView;
+
     private:
     /**
      *  Defines the type for size of a data chunk.
      */
         typedef unsigned int TDataSize;
+
+    /**
+     *  Defines the time step type, must match SystemManager::TSystemTime.
+     */
+        typedef unsigned int TSystemTime;
     
     /**
      *  Defines the message type field used in the communication for message processing.
@@ -139,24 +160,79 @@ class ControlManager
             SetPriceType = 0x00000003, /**< Sent by external controller to send a price signal to a client. */
             SendPriceProposalType = 0x00000004, /**< Sent by external controller to send a price proposal to a client. */
             PriceRequestType = 0x00000005, /**< Sent to external controller to indicate a price request by a client. */
-            DemandNegotiationType = 0x00000006 /**< Sent to external controller to indicate a price proposal response by a client. */
+            DemandNegotiationType = 0x00000006, /**< Sent to external controller to indicate a price proposal response by a client. */
+            PartialDecisionType = 0x00000007 /**< Sent to external controller with the clients that reported before the others, in the layout of a MakeDecisionType message. Sent only if decision quorums are set. */
         };
 
     /**
      *  Defines the type holding a ClientId->ClientName mapping.
      */
         typedef std::map<TClientId, TClientName> TClientIdMap;
-    
+
     /**
-     *  Defines the type holding a ClientId->ClientManager mapping.
+     *  Defines the list of clients in a decision message with their object names.
      */
-        typedef std::map<TClientId,SmartPointer<ClientManager>> TClientManagerMap;
+        typedef std::vector<std::pair<TClientId, TClientName>> TDecisionClientList;
+
+    private:
+    /**
+     *  Price signal of the External Controller held until the decision is finished.
+     */
+        struct HeldPrice
+        {
+            /**
+             *  Id of the priced client.
+             */
+            TClientId clientId;
+
+            /**
+             *  First interval of the price signal, the one after the decision.
+             */
+            TSystemTime systemTime;
+
+            /**
+             *  Number of price points.
+             */
+            TNumberOfPricePoints numberOfPricePoints;
+
+            /**
+             *  Price points as received, in network byte order.
+             */
+            std::vector<char> prices;
+        };
 
     private:
     /**
      *  Implements the TCP server for external controller communication.
      */
         ThreadedTCPServer m_server;
+
+    /**
+     *  Unix domain socket server for the External Controller on the same host.
+     */
+        ThreadedTCPServer m_localServer;
+
+    /**
+     *  Indicates whether the Unix domain socket server listens.
+     */
+        bool m_useLocalServer;
+
+    /**
+     *  Indicates whether the TCP server listens.
+     */
+        bool m_usePort;
+
+#if defined( __linux__ )
+    /**
+     *  Shared memory server replacing the TCP server if a segment name is set.
+     */
+        ThreadedSharedMemoryServer m_sharedMemoryServer;
+
+    /**
+     *  Indicates whether the External Controller connects through shared memory.
+     */
+        bool m_useSharedMemory;
+#endif
     
     /**
      *  Pointer to the currently accepted external controller communication handler.
@@ -169,19 +245,19 @@ class ControlManager
         std::timed_mutex m_readyMutex;
     
     /**
-     *  Map containing the unique id to object name mapping.
+     *  Registry of the connected clients, iterated through snapshots during a decision.
      */
-        TClientIdMap m_clientIdMap;
+        ClientRegistry m_clients;
     
     /**
-     *  Map containing the unique id to ClientManager mapping.
+     *  Map containing the unique id to object name mapping of the clients restored from a checkpoint that have not reconnected yet.
      */
-        TClientManagerMap m_clientManagerMap;
+        TClientIdMap m_reservedClientMap;
     
     /**
-     *  Mutex protecting the m_clientIdMap and m_clientManagerMap members.
+     *  Mutex protecting the m_reservedClientMap member.
      */
-        std::mutex m_clientMapLock;
+        std::mutex m_reservedClientLock;
     
     /**
      *  Mutex protecting the client thread object from deletion.
@@ -190,6 +266,31 @@ class ControlManager
     
         std::mutex m_deleteProcessFinishedMutex;
 
+    /**
+     *  Clients sent in a partial decision of the current time step, left out of its final decision.
+     */
+        std::set<TClientId> m_decidedClients;
+
+    /**
+     *  Time step of the last decision message.
+     */
+        std::atomic<TSystemTime> m_decisionTime;
+
+    /**
+     *  Price signals received during the last decision before the system time advanced.
+     */
+        std::vector<HeldPrice> m_heldPrices;
+
+    /**
+     *  Indicates whether the system time advanced past the last decision, its price signals are not held anymore. Protected by m_heldPricesLock.
+     */
+        bool m_decisionTimeAdvanced;
+
+    /**
+     *  Mutex protecting the m_heldPrices and m_decisionTimeAdvanced members.
+     */
+        std::mutex m_heldPricesLock;
+
     private:
     /**
      *  Private constructor for singleton implementation.
@@ -202,6 +303,15 @@ class ControlManager
         void
         DeleteClientThread( void );
 
+    /**
+     *  Queries the voltage deviations and consumptions of the clients over their horizons and sends them to the External Controller.
+     *
+     *  @param messageType MakeDecisionType or PartialDecisionType.
+     *  @param clients     Synchronous clients in the message.
+     */
+        void
+        SendDecision( const TMessageType messageType, const TDecisionClientList & clients );
+
     public:
     /**
      *  Sets the connection information to the accepted External Controller.
@@ -217,6 +327,57 @@ class ControlManager
         void
         ConnectionBroken( void );
 
+    /**
+     *  Sets the options of the External Controller connection. Must be called before Initialize(), the OS defaults are kept otherwise.
+     *
+     *  @param options Socket options of the connection.
+     */
+        void
+        SetSocketOptions( const SocketOptions & options )
+        {
+            this->m_server.SetConnectionOptions( options );
+            this->m_localServer.SetConnectionOptions( options );
+        }
+
+    /**
+     *  Accepts the External Controller on a Unix domain socket as well. Must be called before Initialize().
+     *
+     *  @param path File system path of the socket.
+     *
+     *  @return Success of the binding.
+     */
+        bool
+        SetLocalPath( const std::string & path )
+        {
+            this->m_useLocalServer = this->m_localServer.SetLocalPath( path );
+            return ( this->m_useLocalServer );
+        }
+
+    /**
+     *  Enables or disables the TCP port 26997, so the External Controller can be accepted only on the Unix domain socket. Must be called before Initialize().
+     *
+     *  @param enabled Indicates whether the TCP server listens.
+     */
+        void
+        SetPortEnabled( const bool enabled )
+        {
+            this->m_usePort = enabled;
+        }
+
+#if defined( __linux__ )
+    /**
+     *  Accepts the External Controller through a shared memory segment instead of the TCP port. Must be called before Initialize().
+     *
+     *  @param name Name of the segment, starting with '/'.
+     */
+        void
+        SetSharedMemory( const std::string & name )
+        {
+            this->m_sharedMemoryServer.SetName( name );
+            this->m_useSharedMemory = true;
+        }
+#endif
+
     /**
      *  @brief Processes the received message from the External Controller.
      *
@@ -235,18 +396,39 @@ class ControlManager
     /**
      *  @brief Starts the decision process by sending necessary information to External Controller.
      
-        This function starts the synchronous client decision process by sending the required information for each client. The information contains:
-        - Message Size for easier processing.
-        - Total number of synchronous clients.
-        - System mode.
-        - System time.
+        This function starts the synchronous client decision process by sending the required information for each client. All fields are in network byte order:
+        - Message size (4 bytes) for easier processing.
+        - Message type (4 bytes).
+        - Total number of synchronous clients (2 bytes).
+        - System mode (2 bytes).
+        - System time (4 bytes).
         - For each client:
-           - Client unique id
-           - Client terminal voltage
+           - Number of data points (4 bytes).
+           - For each data point, the consumption (4 bytes) and the terminal voltage deviation (4 bytes).
+           - Client unique id (2 bytes), twice.
+        - Only if the straggler substitution is enabled:
+           - Number of substituted clients (2 bytes).
+           - Unique id (2 bytes) of each client whose consumption was substituted at the deadline.
      */
         void
         MakeDecision( void );
 
+    /**
+     *  Sends the clients that reported before the others to the External Controller, so it can decide on them while the others are awaited. The voltage deviations come from the solution with the consumptions known so far. The clients are left out of the final MakeDecision() of the time step.
+     *
+     *  @param clientIds Clients that reported in the current time step, the ones already sent are skipped.
+     */
+        void
+        MakePartialDecision( const std::vector<TClientId> & clientIds );
+
+    /**
+     *  @brief Signals that the system time advanced past the last decision.
+     
+        The price signals of a decision are held until the system time advanced, as a client answers its price signal with its next consumption, which must not be counted in the time step of the decision. The held price signals of the decision are sent to the clients, and the later ones are sent as they are received until the next decision message. A client answering its price signal is then always counted in the next time step. The External Controller sends DecisionFinished after its price signals, so the price signals of a decision are sent before the next decision message.
+     */
+        void
+        AdvanceDecisionTime( void );
+
     /**
      *  Stops the calling thread until a ready signal is received from the External Controller. @todo This doesn't need to be inline.
      */
@@ -286,17 +468,66 @@ class ControlManager
     /**
      *  Relays the demand negotiation response of the client to the External Controller.
      *
-     *  @param clientId           Unique client id of the responding client.
-     *  @param numberOfDataPoints Number of consumption points sent.
-     *  @param dataPoints         Buffer for the consumption points.
+     *  @param clientId   Unique client id of the responding client.
+     *  @param dataPoints View of the consumption points in the received message, forwarded without conversion.
      */
         void
         ClientDemandNegotiation( const TClientId clientId,
-                                 const TNumberOfDataPoints numberOfDataPoints,
-                                 TDataPoint* dataPoints );
+                                 const TDataPointView & dataPoints );
+
+    /**
+     *  @brief Writes the id and object name of all clients to a checkpoint.
+     *
+     *  The clients restored from an earlier checkpoint that have not reconnected yet are written as well.
+     *
+     *  @param checkpoint Checkpoint being written.
+     */
+        void
+        SaveClients( CheckpointWriter & checkpoint );
+
+    /**
+     *  @brief Reserves the client ids of a checkpoint for the reconnecting clients.
+     *
+     *  @param checkpoint Checkpoint being read.
+     *
+     *  @return false if the checkpoint is malformed.
+     */
+        bool
+        RestoreClients( CheckpointReader & checkpoint );
+
+    /**
+     *  @brief Gives a reserved client id back to its reconnecting client.
+     *
+     *  A client restored from a checkpoint reconnects with its previous id. The object was already found in OpenDSS before the checkpoint, so it is not checked again.
+     *
+     *  @param clientId   Previous unique client id sent by the client.
+     *  @param clientName Object name sent by the client.
+     *
+     *  @return true if the id was reserved for the object name, and is not reserved anymore.
+     */
+        bool
+        ReclaimClient( const TClientId clientId, const TClientName & clientName );
 
     /**
-     *  Returns the name of the object. @todo Let's make this not inline for debugging.
+     *  Returns the manager of a connected client.
+     *
+     *  @param clientId Unique client id.
+     *
+     *  @return Manager of the client connection, null if the client is not registered.
+     */
+        SmartPointer<ClientManager>
+        GetClientManager( const TClientId clientId ) const;
+
+    /**
+     *  Returns the ids of the connected synchronous clients.
+     *
+     *  @return Unique ids of the synchronous clients.
+     */
+        std::vector<TClientId>
+        GetSynchronousClientIds( void );
+
+    /**
+     *  Returns the name of the object. The reserved clients of a checkpoint keep their names until they reconnect, so their registered consumption still reaches OpenDSS. @todo Let's make this not inline for debugging.
      *
      *  @param clientId Unique client id for the requested object.
      *
@@ -305,11 +536,19 @@ class ControlManager
         TClientName
         GetClientName( const TClientId clientId )
         {
-            if ( this->m_clientIdMap.find( clientId ) == this->m_clientIdMap.end() )
+            TClientName clientName;
+            if ( this->m_clients.GetClientName( clientId, clientName ) )
+            {
+                return ( clientName );
+            }
+            std::lock_guard<std::mutex> lockGuard( this->m_reservedClientLock );
+            TClientIdMap::iterator client = this->m_reservedClientMap.find( clientId );
+            if ( client != this->m_reservedClientMap.end() )
             {
-                ErrorPrint( "Client ", clientId, " not found!" );
+                return ( client->second );
             }
-            return ( this->m_clientIdMap[clientId] );
+            ErrorPrint( "Client ", clientId, " not found!" );
+            return ( TClientName() );
         }
 };
 
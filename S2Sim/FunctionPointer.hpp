@@ -13,7 +13,7 @@
 
 template <class ...TArgs>
 void
-Scream( TArgs... args )
+Scream( TArgs... )
 {
     std::cerr << __PRETTY_FUNCTION__ << std::endl;
 }
@@ -22,8 +22,13 @@ template <class ...TArgs>
 class FunctionPointer
 {
     public:
+        virtual
+        ~FunctionPointer( void )
+        {
+        }
+    
         virtual void
-        operator () ( TArgs... args )
+        operator () ( TArgs... )
         {
             ::Scream();
         }
@@ -33,6 +38,11 @@ template <>
 class FunctionPointer<>
 {
     public:
+        virtual
+        ~FunctionPointer( void )
+        {
+        }
+    
         virtual void
         operator () ( void )
         {
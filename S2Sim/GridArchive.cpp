@@ -0,0 +1,93 @@
+/**
+ * @file GridArchive.cpp
+ * Implements the GridArchive class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include "GridArchive.h"
+
+namespace TerraSwarm
+{
+    GridArchive::GridArchive( void )
+    {
+        this->m_headerFile = { -1, nullptr, 0 };
+        this->m_timeFile = { -1, nullptr, 0 };
+        for ( TColumn column = 0; column < NumberOfColumns; ++column )
+        {
+            this->m_columnFiles[column] = { -1, nullptr, 0 };
+        }
+    }
+
+    GridArchive::~GridArchive( void )
+    {
+        this->CloseAll();
+    }
+
+    std::string
+    GridArchive::GetHeaderPath( const std::string & directory )
+    {
+        return ( directory + "/header" );
+    }
+
+    std::string
+    GridArchive::GetTimePath( const std::string & directory )
+    {
+        return ( directory + "/time" );
+    }
+
+    std::string
+    GridArchive::GetColumnPath( const std::string & directory, const TColumn column )
+    {
+        static const char* columnNames[NumberOfColumns] = { "consumption", "predicted_consumption", "voltage_deviation", "price" };
+        return ( directory + "/" + columnNames[column] );
+    }
+
+    bool
+    GridArchive::Map( MappedFile & file, const TFileSize size, const bool writable )
+    {
+        if ( file.address != nullptr )
+        {
+            munmap( file.address, file.size );
+            file.address = nullptr;
+            file.size = 0;
+        }
+        if ( size == 0 )
+        {
+            return ( true );
+        }
+
+        void* address = mmap( nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, file.descriptor, 0 );
+        if ( address == MAP_FAILED )
+        {
+            return ( false );
+        }
+        file.address = address;
+        file.size = size;
+        return ( true );
+    }
+
+    void
+    GridArchive::Close( MappedFile & file )
+    {
+        Map( file, 0, false );
+        if ( file.descriptor != -1 )
+        {
+            close( file.descriptor );
+            file.descriptor = -1;
+        }
+    }
+
+    void
+    GridArchive::CloseAll( void )
+    {
+        Close( this->m_headerFile );
+        Close( this->m_timeFile );
+        for ( TColumn column = 0; column < NumberOfColumns; ++column )
+        {
+            Close( this->m_columnFiles[column] );
+        }
+    }
+} /* namespace TerraSwarm */
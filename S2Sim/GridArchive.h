@@ -0,0 +1,337 @@
+/**
+ * @file GridArchive.h
+ * Defines the GridArchive class, the file layout of the grid state archive.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef GRIDARCHIVE_H_
+#define GRIDARCHIVE_H_
+
+#include <string>
+#include "MessageHeader.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Memory mapped, append-only archive of the grid state of every tick.
+
+        The archive is a directory with one file per column and a header file. A data column holds a fixed number of values per tick, one for each client index, so the value of a client at a tick is at ( tick * clientCapacity + clientIndex ). The time column holds a single value per tick. Client indices are assigned in the order the clients first appear and never change within an archive. The header file holds the Header structure followed by the client id of each client index and then the number of fractional bits of each client index. The consumption columns of a client hold its consumptions in units of 2^-fractionalBits watts, so the precision negotiated in its payload encoding is kept.
+
+        Values are stored in host byte order, as the archive is read back on the machine that wrote it. A value that was not recorded is MissingValue. The number of ticks in the header is increased only after a tick is completely written, so a reader never sees a partial tick.
+
+        This class holds the mappings shared by GridArchiveWriter and GridArchiveReader.
+     */
+    class GridArchive
+    {
+        public:
+        /**
+         *  Defines the type of an archived value.
+         */
+            typedef unsigned int TValue;
+
+        /**
+         *  Defines the type of a tick index.
+         */
+            typedef unsigned int TTickIndex;
+
+        /**
+         *  Defines the type of a client index.
+         */
+            typedef unsigned int TClientIndex;
+
+        /**
+         *  Redefines the unique client id type for rapid development.
+         */
+            typedef MessageHeader::TId TClientId;
+
+        /**
+         *  Defines the type of the number of fractional bits of the consumption columns.
+         */
+            typedef unsigned short TFractionalBits;
+
+        /**
+         *  Defines the data columns of the archive.
+         */
+            enum ColumnValues
+            {
+                ConsumptionColumn = 0, /**< Real consumption of the client. */
+                PredictedConsumptionColumn = 1, /**< Predicted consumption of the client. */
+                VoltageDeviationColumn = 2, /**< Voltage deviation of the client computed for the decision. */
+                PriceColumn = 3, /**< Current price set to the client by the controller. */
+                NumberOfColumns = 4
+            };
+
+        /**
+         *  Defines the type of a data column.
+         */
+            typedef unsigned int TColumn;
+
+        /**
+         *  Defines the special archived values.
+         */
+            enum ArchivedValues
+            {
+                MissingValue = 0xFFFFFFFF /**< Marks a value that was not recorded. */
+            };
+
+        protected:
+        /**
+         *  Defines the type of a size in bytes.
+         */
+            typedef unsigned long long TFileSize;
+
+        /**
+         *  Defines the identification values of the header.
+         */
+            enum HeaderValues
+            {
+                Magic = 0x53324741, /**< Identifies an archive, read back differently on a machine with a different byte order. */
+                Version = 0x00000002 /**< Version of the layout. */
+            };
+
+        /**
+         *  Start of the header file.
+         */
+            struct Header
+            {
+                /**
+                 *  Always Magic.
+                 */
+                unsigned int magic;
+
+                /**
+                 *  Always Version.
+                 */
+                unsigned int version;
+
+                /**
+                 *  Number of values of a tick in a data column.
+                 */
+                TClientIndex clientCapacity;
+
+                /**
+                 *  Number of assigned client indices.
+                 */
+                TClientIndex numberOfClients;
+
+                /**
+                 *  Number of completely written ticks.
+                 */
+                TTickIndex numberOfTicks;
+            };
+
+        /**
+         *  A memory mapped file.
+         */
+            struct MappedFile
+            {
+                /**
+                 *  File descriptor, -1 if not open.
+                 */
+                int descriptor;
+
+                /**
+                 *  Start of the mapping, nullptr if not mapped.
+                 */
+                void* address;
+
+                /**
+                 *  Size of the mapping.
+                 */
+                TFileSize size;
+            };
+
+        protected:
+        /**
+         *  Header file.
+         */
+            MappedFile m_headerFile;
+
+        /**
+         *  Time column file.
+         */
+            MappedFile m_timeFile;
+
+        /**
+         *  Data column files.
+         */
+            MappedFile m_columnFiles[NumberOfColumns];
+
+        protected:
+        /**
+         *  Creates an archive without open files.
+         */
+            GridArchive( void );
+
+        /**
+         *  Unmaps and closes all files.
+         */
+            ~GridArchive( void );
+
+        /**
+         *  Returns the path of the header file.
+         *
+         *  @param directory Archive directory.
+         *
+         *  @return Path of the file.
+         */
+            static std::string
+            GetHeaderPath( const std::string & directory );
+
+        /**
+         *  Returns the path of the time column file.
+         *
+         *  @param directory Archive directory.
+         *
+         *  @return Path of the file.
+         */
+            static std::string
+            GetTimePath( const std::string & directory );
+
+        /**
+         *  Returns the path of a data column file.
+         *
+         *  @param directory Archive directory.
+         *  @param column    Data column.
+         *
+         *  @return Path of the file.
+         */
+            static std::string
+            GetColumnPath( const std::string & directory, const TColumn column );
+
+        /**
+         *  Returns the size of the header file.
+         *
+         *  @param clientCapacity Number of client indices.
+         *
+         *  @return Size of the Header, the client id table and the fractional bits table.
+         */
+            static TFileSize
+            GetHeaderSize( const TClientIndex clientCapacity )
+            {
+                return ( sizeof( Header ) + clientCapacity * ( sizeof( TClientId ) + sizeof( TFractionalBits ) ) );
+            }
+
+        /**
+         *  Maps an open file, replacing a previous mapping of it. An empty size leaves the file unmapped.
+         *
+         *  @param file     File to be mapped.
+         *  @param size     Size of the mapping.
+         *  @param writable Maps the file for writing if true.
+         *
+         *  @return false if the file cannot be mapped.
+         */
+            static bool
+            Map( MappedFile & file, const TFileSize size, const bool writable );
+
+        /**
+         *  Unmaps and closes a file.
+         *
+         *  @param file File to be closed.
+         */
+            static void
+            Close( MappedFile & file );
+
+        /**
+         *  Unmaps and closes all files.
+         */
+            void
+            CloseAll( void );
+
+        /**
+         *  Returns the header.
+         *
+         *  @return Header at the start of the header file.
+         */
+            Header*
+            GetHeader( void ) const
+            {
+                return ( ( Header* )this->m_headerFile.address );
+            }
+
+        /**
+         *  Returns the client id table.
+         *
+         *  @return Client id of each client index.
+         */
+            TClientId*
+            GetClientIds( void ) const
+            {
+                return ( ( TClientId* )( ( char* )this->m_headerFile.address + sizeof( Header ) ) );
+            }
+
+        /**
+         *  Returns the fractional bits table.
+         *
+         *  @return Number of fractional bits of the consumption columns of each client index.
+         */
+            TFractionalBits*
+            GetFractionalBitsTable( void ) const
+            {
+                return ( ( TFractionalBits* )( this->GetClientIds() + this->GetHeader()->clientCapacity ) );
+            }
+
+        public:
+        /**
+         *  Checks whether the archive is open.
+         *
+         *  @return true if the archive is open.
+         */
+            bool
+            IsOpen( void ) const
+            {
+                return ( this->m_headerFile.address != nullptr );
+            }
+
+        /**
+         *  Returns the number of values of a tick in a data column.
+         *
+         *  @return Maximum number of clients.
+         */
+            TClientIndex
+            GetClientCapacity( void ) const
+            {
+                return ( this->GetHeader()->clientCapacity );
+            }
+
+        /**
+         *  Returns the number of clients in the archive.
+         *
+         *  @return Number of assigned client indices.
+         */
+            TClientIndex
+            GetNumberOfClients( void ) const
+            {
+                return ( this->GetHeader()->numberOfClients );
+            }
+
+        /**
+         *  Returns the client id of a client index.
+         *
+         *  @param clientIndex Index smaller than GetNumberOfClients().
+         *
+         *  @return Unique client id.
+         */
+            TClientId
+            GetClientId( const TClientIndex clientIndex ) const
+            {
+                return ( this->GetClientIds()[clientIndex] );
+            }
+
+        /**
+         *  Returns the number of fractional bits of the consumption columns of a client index.
+         *
+         *  @param clientIndex Index smaller than GetNumberOfClients().
+         *
+         *  @return Number of fractional bits, 0 for consumptions in watts.
+         */
+            TFractionalBits
+            GetFractionalBits( const TClientIndex clientIndex ) const
+            {
+                return ( this->GetFractionalBitsTable()[clientIndex] );
+            }
+    };
+} /* namespace TerraSwarm */
+
+#endif /* GRIDARCHIVE_H_ */
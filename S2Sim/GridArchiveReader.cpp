@@ -0,0 +1,102 @@
+/**
+ * @file GridArchiveReader.cpp
+ * Implements the GridArchiveReader class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <algorithm>
+#include "GridArchiveReader.h"
+
+namespace TerraSwarm
+{
+    GridArchiveReader::GridArchiveReader( void ) : m_numberOfTicks( 0 )
+    {
+    }
+
+    bool
+    GridArchiveReader::OpenFile( const std::string & path, MappedFile & file )
+    {
+        file.descriptor = open( path.c_str(), O_RDONLY );
+        struct stat fileStatus;
+        if ( file.descriptor == -1 || fstat( file.descriptor, &fileStatus ) != 0 )
+        {
+            return ( false );
+        }
+        return ( Map( file, ( TFileSize )fileStatus.st_size, false ) );
+    }
+
+    bool
+    GridArchiveReader::Open( const std::string & directory )
+    {
+        this->Close();
+        if ( !OpenFile( GetHeaderPath( directory ), this->m_headerFile ) ||
+             this->m_headerFile.size < sizeof( Header ) )
+        {
+            this->Close();
+            return ( false );
+        }
+        const Header* header = this->GetHeader();
+        if ( header->magic != Magic ||
+             header->version != Version ||
+             header->clientCapacity == 0 ||
+             header->numberOfClients > header->clientCapacity ||
+             this->m_headerFile.size < GetHeaderSize( header->clientCapacity ) )
+        {
+            this->Close();
+            return ( false );
+        }
+
+        TFileSize numberOfTicks = __atomic_load_n( &header->numberOfTicks, __ATOMIC_ACQUIRE );
+        bool opened = OpenFile( GetTimePath( directory ), this->m_timeFile );
+        numberOfTicks = std::min( numberOfTicks, this->m_timeFile.size / sizeof( TValue ) );
+        for ( TColumn column = 0; column < NumberOfColumns; ++column )
+        {
+            opened = opened && OpenFile( GetColumnPath( directory, column ), this->m_columnFiles[column] );
+            numberOfTicks = std::min( numberOfTicks, this->m_columnFiles[column].size / ( header->clientCapacity * sizeof( TValue ) ) );
+        }
+        if ( !opened )
+        {
+            this->Close();
+            return ( false );
+        }
+        this->m_numberOfTicks = ( TTickIndex )numberOfTicks;
+        return ( true );
+    }
+
+    void
+    GridArchiveReader::Close( void )
+    {
+        this->CloseAll();
+        this->m_numberOfTicks = 0;
+    }
+
+    bool
+    GridArchiveReader::FindClientIndex( const TClientId clientId, TClientIndex & clientIndex ) const
+    {
+        const TClientId* clientIds = this->GetClientIds();
+        const TClientId* client = std::find( clientIds, clientIds + this->GetNumberOfClients(), clientId );
+        if ( client == clientIds + this->GetNumberOfClients() )
+        {
+            return ( false );
+        }
+        clientIndex = ( TClientIndex )( client - clientIds );
+        return ( true );
+    }
+
+    GridArchiveReader::ColumnRange
+    GridArchiveReader::GetRange( const TColumn column, const TTickIndex firstTick, const TTickIndex numberOfTicks ) const
+    {
+        if ( column >= NumberOfColumns || firstTick >= this->m_numberOfTicks )
+        {
+            return ( ColumnRange( nullptr, 0, firstTick, 0 ) );
+        }
+        const TValue* values = ( const TValue* )this->m_columnFiles[column].address + ( TFileSize )firstTick * this->GetClientCapacity();
+        return ( ColumnRange( values,
+                              this->GetClientCapacity(),
+                              firstTick,
+                              std::min( numberOfTicks, this->m_numberOfTicks - firstTick ) ) );
+    }
+} /* namespace TerraSwarm */
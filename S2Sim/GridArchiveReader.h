@@ -0,0 +1,206 @@
+/**
+ * @file GridArchiveReader.h
+ * Defines the GridArchiveReader class reading a grid state archive in place.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef GRIDARCHIVEREADER_H_
+#define GRIDARCHIVEREADER_H_
+
+#include "GridArchive.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Reads a grid state archive for post-run analysis.
+
+        The files are mapped read-only and the values are read in place, without copying. The ticks committed when the archive is opened are visible; an archive that is still written can be opened again to see newer ticks.
+     */
+    class GridArchiveReader : public GridArchive
+    {
+        public:
+        /**
+         *  @brief Consecutive ticks of a data column, pointing into the mapped file.
+
+            The values of a tick are contiguous, one for each client index, so a scan over the clients of a tick reads memory in order. The range is valid while the reader is open.
+         */
+            class ColumnRange
+            {
+                private:
+                /**
+                 *  First value of the first tick.
+                 */
+                    const TValue* m_values;
+
+                /**
+                 *  Number of values of a tick.
+                 */
+                    TClientIndex m_clientCapacity;
+
+                /**
+                 *  Archive index of the first tick.
+                 */
+                    TTickIndex m_firstTick;
+
+                /**
+                 *  Number of ticks in the range.
+                 */
+                    TTickIndex m_numberOfTicks;
+
+                public:
+                /**
+                 *  Creates a range over mapped values.
+                 *
+                 *  @param values         First value of the first tick.
+                 *  @param clientCapacity Number of values of a tick.
+                 *  @param firstTick      Archive index of the first tick.
+                 *  @param numberOfTicks  Number of ticks in the range.
+                 */
+                    ColumnRange( const TValue* values, const TClientIndex clientCapacity, const TTickIndex firstTick, const TTickIndex numberOfTicks ) : m_values( values ),
+                                                                                                                                                      m_clientCapacity( clientCapacity ),
+                                                                                                                                                      m_firstTick( firstTick ),
+                                                                                                                                                      m_numberOfTicks( numberOfTicks )
+                    {
+                    }
+
+                /**
+                 *  Returns the archive index of the first tick.
+                 *
+                 *  @return Index of the first tick.
+                 */
+                    TTickIndex
+                    GetFirstTick( void ) const
+                    {
+                        return ( this->m_firstTick );
+                    }
+
+                /**
+                 *  Returns the number of ticks in the range.
+                 *
+                 *  @return Number of ticks, 0 for an empty range.
+                 */
+                    TTickIndex
+                    GetNumberOfTicks( void ) const
+                    {
+                        return ( this->m_numberOfTicks );
+                    }
+
+                /**
+                 *  Returns the values of a tick.
+                 *
+                 *  @param tick Tick index relative to the start of the range.
+                 *
+                 *  @return Value of each client index at the tick.
+                 */
+                    const TValue*
+                    GetTick( const TTickIndex tick ) const
+                    {
+                        return ( this->m_values + ( unsigned long long )tick * this->m_clientCapacity );
+                    }
+
+                /**
+                 *  Returns the value of a client at a tick.
+                 *
+                 *  @param tick        Tick index relative to the start of the range.
+                 *  @param clientIndex Client index.
+                 *
+                 *  @return Archived value, MissingValue if it was not recorded.
+                 */
+                    TValue
+                    GetValue( const TTickIndex tick, const TClientIndex clientIndex ) const
+                    {
+                        return ( this->GetTick( tick )[clientIndex] );
+                    }
+            };
+
+        private:
+        /**
+         *  Number of ticks visible to the reader.
+         */
+            TTickIndex m_numberOfTicks;
+
+        private:
+        /**
+         *  Opens and maps a file read-only with its current size.
+         *
+         *  @param path Path of the file.
+         *  @param file Mapped file.
+         *
+         *  @return false if the file cannot be opened or mapped.
+         */
+            static bool
+            OpenFile( const std::string & path, MappedFile & file );
+
+        public:
+        /**
+         *  Creates a reader without an archive.
+         */
+            GridArchiveReader( void );
+
+        /**
+         *  Opens an archive.
+         *
+         *  @param directory Archive directory.
+         *
+         *  @return false if the directory does not contain a valid archive.
+         */
+            bool
+            Open( const std::string & directory );
+
+        /**
+         *  Closes the archive. Ranges of the archive become invalid.
+         */
+            void
+            Close( void );
+
+        /**
+         *  Returns the number of ticks in the archive.
+         *
+         *  @return Number of ticks committed when the archive was opened.
+         */
+            TTickIndex
+            GetNumberOfTicks( void ) const
+            {
+                return ( this->m_numberOfTicks );
+            }
+
+        /**
+         *  Returns the system time of a tick.
+         *
+         *  @param tick Tick index smaller than GetNumberOfTicks().
+         *
+         *  @return System time of the tick.
+         */
+            TValue
+            GetTime( const TTickIndex tick ) const
+            {
+                return ( ( ( const TValue* )this->m_timeFile.address )[tick] );
+            }
+
+        /**
+         *  Finds the client index of a client.
+         *
+         *  @param clientId    Unique client id.
+         *  @param clientIndex Client index, if found.
+         *
+         *  @return false if the client is not in the archive.
+         */
+            bool
+            FindClientIndex( const TClientId clientId, TClientIndex & clientIndex ) const;
+
+        /**
+         *  Returns consecutive ticks of a data column without copying them.
+         *
+         *  @param column        Data column.
+         *  @param firstTick     Index of the first tick.
+         *  @param numberOfTicks Number of ticks, limited to the ticks in the archive.
+         *
+         *  @return Range over the ticks, empty if the column or the first tick is invalid.
+         */
+            ColumnRange
+            GetRange( const TColumn column, const TTickIndex firstTick, const TTickIndex numberOfTicks ) const;
+    };
+} /* namespace TerraSwarm */
+
+#endif /* GRIDARCHIVEREADER_H_ */
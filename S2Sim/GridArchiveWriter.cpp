@@ -0,0 +1,203 @@
+/**
+ * @file GridArchiveWriter.cpp
+ * Implements the GridArchiveWriter class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <algorithm>
+#include <limits>
+#include "GridArchiveWriter.h"
+#include "PayloadEncoding.h"
+
+namespace TerraSwarm
+{
+    GridArchiveWriter::GridArchiveWriter( void ) : m_tickCapacity( 0 ),
+                                                   m_tickStarted( false )
+    {
+    }
+
+    GridArchiveWriter::~GridArchiveWriter( void )
+    {
+        this->Close();
+    }
+
+    bool
+    GridArchiveWriter::Create( const std::string & directory, const TClientIndex clientCapacity )
+    {
+        this->Close();
+        if ( clientCapacity == 0 || ( mkdir( directory.c_str(), 0755 ) != 0 && errno != EEXIST ) )
+        {
+            return ( false );
+        }
+
+        this->m_headerFile.descriptor = open( GetHeaderPath( directory ).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+        this->m_timeFile.descriptor = open( GetTimePath( directory ).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+        bool opened = ( this->m_headerFile.descriptor != -1 && this->m_timeFile.descriptor != -1 );
+        for ( TColumn column = 0; column < NumberOfColumns; ++column )
+        {
+            this->m_columnFiles[column].descriptor = open( GetColumnPath( directory, column ).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+            opened = opened && this->m_columnFiles[column].descriptor != -1;
+        }
+        TFileSize headerSize = GetHeaderSize( clientCapacity );
+        if ( !opened ||
+             ftruncate( this->m_headerFile.descriptor, headerSize ) != 0 ||
+             !Map( this->m_headerFile, headerSize, true ) )
+        {
+            this->CloseAll();
+            return ( false );
+        }
+
+        Header* header = this->GetHeader();
+        header->magic = Magic;
+        header->version = Version;
+        header->clientCapacity = clientCapacity;
+        header->numberOfClients = 0;
+        header->numberOfTicks = 0;
+        this->m_tickCapacity = 0;
+        this->m_tickStarted = false;
+        this->m_clientIndices.assign( ( size_t )std::numeric_limits<TClientId>::max() + 1, NoClientIndex );
+        this->m_consumptionArchived.assign( clientCapacity, false );
+        return ( true );
+    }
+
+    bool
+    GridArchiveWriter::Close( void )
+    {
+        if ( !this->IsOpen() )
+        {
+            return ( true );
+        }
+
+        TFileSize numberOfTicks = this->GetNumberOfTicks();
+        TFileSize rowSize = this->GetClientCapacity() * sizeof( TValue );
+        Map( this->m_timeFile, 0, true );
+        bool truncated = ( ftruncate( this->m_timeFile.descriptor, numberOfTicks * sizeof( TValue ) ) == 0 );
+        for ( TColumn column = 0; column < NumberOfColumns; ++column )
+        {
+            Map( this->m_columnFiles[column], 0, true );
+            truncated = ( ftruncate( this->m_columnFiles[column].descriptor, numberOfTicks * rowSize ) == 0 ) && truncated;
+        }
+        this->CloseAll();
+        this->m_tickCapacity = 0;
+        this->m_tickStarted = false;
+        this->m_clientIndices.clear();
+        this->m_consumptionArchived.clear();
+        return ( truncated );
+    }
+
+    bool
+    GridArchiveWriter::Grow( const TTickIndex tickCapacity )
+    {
+        TFileSize rowSize = this->GetClientCapacity() * sizeof( TValue );
+        this->m_tickCapacity = 0;
+        if ( ftruncate( this->m_timeFile.descriptor, tickCapacity * sizeof( TValue ) ) != 0 ||
+             !Map( this->m_timeFile, tickCapacity * sizeof( TValue ), true ) )
+        {
+            return ( false );
+        }
+        for ( TColumn column = 0; column < NumberOfColumns; ++column )
+        {
+            if ( ftruncate( this->m_columnFiles[column].descriptor, tickCapacity * rowSize ) != 0 ||
+                 !Map( this->m_columnFiles[column], tickCapacity * rowSize, true ) )
+            {
+                return ( false );
+            }
+        }
+        this->m_tickCapacity = tickCapacity;
+        return ( true );
+    }
+
+    bool
+    GridArchiveWriter::BeginTick( const TValue time )
+    {
+        if ( !this->IsOpen() )
+        {
+            return ( false );
+        }
+
+        TTickIndex tick = this->GetNumberOfTicks();
+        if ( tick >= this->m_tickCapacity &&
+             !this->Grow( std::max( ( TTickIndex )MinimumTickCapacity, 2 * this->m_tickCapacity ) ) )
+        {
+            this->m_tickStarted = false;
+            return ( false );
+        }
+
+        ( ( TValue* )this->m_timeFile.address )[tick] = time;
+        TClientIndex clientCapacity = this->GetClientCapacity();
+        for ( TColumn column = 0; column < NumberOfColumns; ++column )
+        {
+            TValue* row = ( TValue* )this->m_columnFiles[column].address + ( TFileSize )tick * clientCapacity;
+            std::fill( row, row + clientCapacity, ( TValue )MissingValue );
+        }
+        this->m_tickStarted = true;
+        return ( true );
+    }
+
+    GridArchiveWriter::TClientIndex
+    GridArchiveWriter::GetClientIndex( const TClientId clientId )
+    {
+        TClientIndex clientIndex = this->m_clientIndices[clientId];
+        if ( clientIndex == NoClientIndex )
+        {
+            Header* header = this->GetHeader();
+            if ( header->numberOfClients == header->clientCapacity )
+            {
+                return ( NoClientIndex );
+            }
+            clientIndex = header->numberOfClients;
+            this->GetClientIds()[clientIndex] = clientId;
+            this->GetFractionalBitsTable()[clientIndex] = 0;
+            ++header->numberOfClients;
+            this->m_clientIndices[clientId] = clientIndex;
+        }
+        return ( clientIndex );
+    }
+
+    bool
+    GridArchiveWriter::SetValue( const TColumn column, const TClientId clientId, const TValue value, const TFractionalBits fractionalBits )
+    {
+        if ( !this->m_tickStarted || column >= NumberOfColumns )
+        {
+            return ( false );
+        }
+        TClientIndex clientIndex = this->GetClientIndex( clientId );
+        if ( clientIndex == NoClientIndex )
+        {
+            return ( false );
+        }
+
+        TValue archivedValue = value;
+        if ( column == ConsumptionColumn || column == PredictedConsumptionColumn )
+        {
+            TFractionalBits & archivedFractionalBits = this->GetFractionalBitsTable()[clientIndex];
+            if ( !this->m_consumptionArchived[clientIndex] )
+            {
+                archivedFractionalBits = fractionalBits;
+                this->m_consumptionArchived[clientIndex] = true;
+            }
+            archivedValue = PayloadEncoding::Rescale( value, fractionalBits, archivedFractionalBits );
+            archivedValue = std::min( archivedValue, ( TValue )MissingValue - 1 );
+        }
+
+        TFileSize tick = this->GetNumberOfTicks();
+        ( ( TValue* )this->m_columnFiles[column].address )[tick * this->GetClientCapacity() + clientIndex] = archivedValue;
+        return ( true );
+    }
+
+    void
+    GridArchiveWriter::CommitTick( void )
+    {
+        if ( !this->m_tickStarted )
+        {
+            return;
+        }
+        __atomic_store_n( &this->GetHeader()->numberOfTicks, this->GetNumberOfTicks() + 1, __ATOMIC_RELEASE );
+        this->m_tickStarted = false;
+    }
+} /* namespace TerraSwarm */
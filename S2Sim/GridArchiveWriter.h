@@ -0,0 +1,158 @@
+/**
+ * @file GridArchiveWriter.h
+ * Defines the GridArchiveWriter class appending ticks to a grid state archive.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef GRIDARCHIVEWRITER_H_
+#define GRIDARCHIVEWRITER_H_
+
+#include <vector>
+#include "GridArchive.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Appends ticks to a new grid state archive.
+
+        A tick is started with BeginTick(), filled with SetValue() and published with CommitTick(). The column files grow by doubling their mapped size, and are truncated to the written ticks when the archive is closed. The writer is not thread safe.
+     */
+    class GridArchiveWriter : public GridArchive
+    {
+        private:
+        /**
+         *  Defines the values used for the client index lookup.
+         */
+            enum ClientIndexValues
+            {
+                NoClientIndex = 0xFFFFFFFF, /**< Marks a client without an index. */
+                MinimumTickCapacity = 1024 /**< Number of ticks mapped when the first tick is started. */
+            };
+
+        private:
+        /**
+         *  Number of ticks the column files are mapped for.
+         */
+            TTickIndex m_tickCapacity;
+
+        /**
+         *  Indicates that a tick is started and not committed.
+         */
+            bool m_tickStarted;
+
+        /**
+         *  Client index of each client id, NoClientIndex if not assigned.
+         */
+            std::vector<TClientIndex> m_clientIndices;
+
+        /**
+         *  Indicates for each client index whether a consumption was archived, which fixes the fractional bits of the client.
+         */
+            std::vector<bool> m_consumptionArchived;
+
+        private:
+        /**
+         *  Grows the time and column files to hold the given number of ticks. The tick capacity is 0 if a file cannot grow, so the next tick tries again.
+         *
+         *  @param tickCapacity New number of ticks.
+         *
+         *  @return false if a file cannot grow.
+         */
+            bool
+            Grow( const TTickIndex tickCapacity );
+
+        /**
+         *  Returns the client index of a client, assigning a new one if needed.
+         *
+         *  @param clientId Unique client id.
+         *
+         *  @return Client index, NoClientIndex if the archive is full.
+         */
+            TClientIndex
+            GetClientIndex( const TClientId clientId );
+
+        public:
+        /**
+         *  Creates a writer without an archive.
+         */
+            GridArchiveWriter( void );
+
+        /**
+         *  Closes the archive.
+         */
+            ~GridArchiveWriter( void );
+
+        /**
+         *  Creates a new archive, replacing the files of an archive in the same directory.
+         *
+         *  @param directory      Archive directory, created if it does not exist.
+         *  @param clientCapacity Maximum number of clients in the archive.
+         *
+         *  @return false if the archive cannot be created.
+         */
+            bool
+            Create( const std::string & directory, const TClientIndex clientCapacity );
+
+        /**
+         *  Truncates the files to the committed ticks and closes the archive.
+         *
+         *  @return false if a file cannot be truncated.
+         */
+            bool
+            Close( void );
+
+        /**
+         *  Starts a new tick with all values missing. A started tick that is not committed is discarded.
+         *
+         *  @param time System time of the tick.
+         *
+         *  @return false if the files cannot grow.
+         */
+            bool
+            BeginTick( const TValue time );
+
+        /**
+         *  Sets a value of a client in the started tick. The first consumption of a client fixes the fractional bits of its consumption columns, later consumptions with other fractional bits are rescaled.
+         *
+         *  @param column         Data column.
+         *  @param clientId       Unique client id.
+         *  @param value          Value to be archived.
+         *  @param fractionalBits Number of fractional bits of a consumption, 0 for the other columns.
+         *
+         *  @return false if no tick is started or the client does not fit into the archive.
+         */
+            bool
+            SetValue( const TColumn column, const TClientId clientId, const TValue value, const TFractionalBits fractionalBits = 0 );
+
+        /**
+         *  Publishes the started tick to the readers.
+         */
+            void
+            CommitTick( void );
+
+        /**
+         *  Returns the number of ticks in the archive.
+         *
+         *  @return Number of committed ticks.
+         */
+            TTickIndex
+            GetNumberOfTicks( void ) const
+            {
+                return ( this->GetHeader()->numberOfTicks );
+            }
+
+        /**
+         *  Returns whether a tick is started and not committed.
+         *
+         *  @return true if values can be set.
+         */
+            bool
+            IsTickStarted( void ) const
+            {
+                return ( this->m_tickStarted );
+            }
+    };
+} /* namespace TerraSwarm */
+
+#endif /* GRIDARCHIVEWRITER_H_ */
@@ -93,6 +93,10 @@ void LogManager::CheckConfigurationFile( void )
         
         std::string lineString = lineBuffer;
         std::string::size_type equalPosition = lineString.find( "=" );
+        if ( equalPosition == std::string::npos )
+        {
+            continue;
+        }
         std::string keyword = lineString.substr( 1, equalPosition - 1 );
         std::string value = lineString.substr( equalPosition + 1, lineString.length() );
         
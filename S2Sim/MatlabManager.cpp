@@ -20,13 +20,20 @@ GetMatlabManager( void )
 MatlabManager::MatlabManager( void ) : m_clientPresentInformation( false ),
                                        m_clientWattageInformation( 0 ),
                                        m_clientVoltageInformation( 0 ),
-                                       m_clientVoltageDeviationInformation( 0 )
+                                       m_clientVoltageDeviationInformation( 0 ),
+                                       m_clientListRefreshInterval( 0 ),
+                                       m_numberOfSteps( 0 )
 {
     LOG_FUNCTION_START();
     LogPrint( "OpenDSS MATLAB Manager alive" );
     this->m_connectionReadyMutex.lock();
 
     this->m_server.SetPort( 26998 );
+    this->m_useLocalServer = false;
+    this->m_usePort = true;
+#if defined( __linux__ )
+    this->m_useSharedMemory = false;
+#endif
     LOG_FUNCTION_END();
 }
 
@@ -45,6 +52,8 @@ MatlabManager::SetClient( const SmartPointer<ThreadedTCPConnectedClient> & clien
         else
         {
             this->m_client = client;
+            this->m_receivedData.clear();
+            this->m_listedClients.clear();
             
             this->m_clientVoltageMutex.lock();
             this->m_clientPresenceMutex.lock();
@@ -69,6 +78,8 @@ MatlabManager::SetClient( const SmartPointer<ThreadedTCPConnectedClient> & clien
             this->m_connectionReadyMutex.lock();
             this->m_client->StopThread( this->m_client );
             this->m_client = client;
+            this->m_receivedData.clear();
+            this->m_listedClients.clear();
             
             this->m_clientVoltageMutex.lock();
             this->m_clientPresenceMutex.lock();
@@ -81,6 +92,10 @@ MatlabManager::SetClient( const SmartPointer<ThreadedTCPConnectedClient> & clien
         }
     }
     this->m_deleteProcessFinishedMutex.unlock();
+    if ( !client.IsNull() )
+    {
+        this->RequestClientList();
+    }
     LOG_FUNCTION_END();
 }
 
@@ -88,7 +103,22 @@ void
 MatlabManager::Initialize( void )
 {
     LOG_FUNCTION_START();
-    this->m_server.SetNotificationCallback( std::move( CreateFunctionPointer( GetMatlabManager(), &MatlabManager::SetClient ) ) );
+#if defined( __linux__ )
+    if ( this->m_useSharedMemory )
+    {
+        this->m_sharedMemoryServer.SetNotificationCallback( std::move( CreateFunctionPointer( GetMatlabManager(), &MatlabManager::SetClient ) ) );
+        LOG_FUNCTION_END();
+        return;
+    }
+#endif
+    if ( this->m_useLocalServer )
+    {
+        this->m_localServer.SetNotificationCallback( std::move( CreateFunctionPointer( GetMatlabManager(), &MatlabManager::SetClient ) ) );
+    }
+    if ( this->m_usePort )
+    {
+        this->m_server.SetNotificationCallback( std::move( CreateFunctionPointer( GetMatlabManager(), &MatlabManager::SetClient ) ) );
+    }
     LOG_FUNCTION_END();
 }
 
@@ -97,6 +127,10 @@ MatlabManager::ConnectionBroken( void )
 {
     LOG_FUNCTION_START();
     WarningPrint( "OpenDSS MATLAB Manager disconnected" );
+    {
+        std::lock_guard<std::mutex> lockGuard( this->m_knownClientsLock );
+        this->m_knownClients.clear();
+    }
     this->m_clientVoltageMutex.unlock();
     this->m_clientPresenceMutex.unlock();
     this->m_clientWattageMutex.unlock();
@@ -124,131 +158,233 @@ MatlabManager::ProcessData( void* buffer, size_t size )
     LOG_FUNCTION_START();
     LogPrint( "Processing data of size: " , size );
     
-    int remainingSize = ( int )size;
-
-    if ( remainingSize <= 0 )
+    if ( ( int )size <= 0 )
     {
         this->ConnectionBroken();
         LOG_FUNCTION_END();
         return;
     }
     
-    while ( remainingSize > 0 )
+    this->m_receivedData.insert( this->m_receivedData.end(), ( char* )buffer, ( char* )buffer + size );
+    size_t processedSize = 0;
+    while ( processedSize < this->m_receivedData.size() )
     {
-        TMessageType messageType;
-        char* currentAddress = ( char* )buffer;
-        memcpy( &messageType, currentAddress, sizeof( TMessageType ) );
-        currentAddress += sizeof( TMessageType );
+        size_t messageSize = this->ProcessMessage( this->m_receivedData.data() + processedSize, this->m_receivedData.size() - processedSize );
+        if ( messageSize == 0 )
+        {
+            LogPrint( "Waiting for the rest of the message" );
+            break;
+        }
+        processedSize += messageSize;
+    }
+    this->m_receivedData.erase( this->m_receivedData.begin(), this->m_receivedData.begin() + processedSize );
+    LOG_FUNCTION_END();
+}
 
-        messageType = ntohl( messageType );
+size_t
+MatlabManager::ProcessMessage( const char* message, const size_t size )
+{
+    LOG_FUNCTION_START();
+    if ( size < sizeof( TMessageType ) )
+    {
+        LOG_FUNCTION_END();
+        return ( 0 );
+    }
+    
+    TMessageType messageType;
+    const char* currentAddress = message;
+    memcpy( &messageType, currentAddress, sizeof( TMessageType ) );
+    currentAddress += sizeof( TMessageType );
 
-        if ( messageType == ClientCheckResultType )
-        {
-            remainingSize -= sizeof( TMessageType ) + sizeof( TClientCheckResult );
-            LogPrint( "Message Type: Client Presence Result" );
-            TClientCheckResult checkResult;
-            memcpy( &checkResult, currentAddress, sizeof( TClientCheckResult ) );
-            currentAddress += sizeof( TClientCheckResult );
+    messageType = ntohl( messageType );
 
-            checkResult = ntohl( checkResult );
-            
-            LogPrint( "OpenDSS says: ", messageType, " ", checkResult );
-            if ( checkResult == ClientExists )
-            {
-                LogPrint( "OpenDSS says: Client Exists" );
-                this->m_clientPresentInformation = true;
-            }
-            else
-            {
-                WarningPrint( "OpenDSS says: Client does not Exist" );
-                this->m_clientPresentInformation = false;
-            }
-            LogPrint( "Releasing Client Presence Semaphore" );
-            this->m_clientPresenceMutex.unlock();
+    if ( messageType == ClientCheckResultType )
+    {
+        if ( size < sizeof( TMessageType ) + sizeof( TClientCheckResult ) )
+        {
+            LOG_FUNCTION_END();
+            return ( 0 );
+        }
+        LogPrint( "Message Type: Client Presence Result" );
+        TClientCheckResult checkResult;
+        memcpy( &checkResult, currentAddress, sizeof( TClientCheckResult ) );
+        currentAddress += sizeof( TClientCheckResult );
+
+        checkResult = ntohl( checkResult );
+        
+        LogPrint( "OpenDSS says: ", messageType, " ", checkResult );
+        if ( checkResult == ClientExists )
+        {
+            LogPrint( "OpenDSS says: Client Exists" );
+            this->m_clientPresentInformation = true;
         }
-        else if ( messageType == ClientWattageResultType )
+        else
+        {
+            WarningPrint( "OpenDSS says: Client does not Exist" );
+            this->m_clientPresentInformation = false;
+        }
+        LogPrint( "Releasing Client Presence Semaphore" );
+        this->m_clientPresenceMutex.unlock();
+    }
+    else if ( messageType == ClientWattageResultType )
+    {
+        if ( size < sizeof( TMessageType ) + sizeof( TWattage ) )
         {
-            remainingSize -= sizeof( TMessageType ) + sizeof( TWattage );
-            LogPrint( "Message Type: Client Wattage Result" );
-            TWattage wattageResult;
-            memcpy( &wattageResult, currentAddress, sizeof( TWattage ) );
-            currentAddress += sizeof( TWattage );
+            LOG_FUNCTION_END();
+            return ( 0 );
+        }
+        LogPrint( "Message Type: Client Wattage Result" );
+        TWattage wattageResult;
+        memcpy( &wattageResult, currentAddress, sizeof( TWattage ) );
+        currentAddress += sizeof( TWattage );
 
-            wattageResult = ntohl( wattageResult );
+        wattageResult = ntohl( wattageResult );
 
-            LogPrint( "OpenDSS says: Client Wattage = ", wattageResult );
-            this->m_clientWattageInformation = wattageResult;
+        LogPrint( "OpenDSS says: Client Wattage = ", wattageResult );
+        this->m_clientWattageInformation = wattageResult;
 
-            LogPrint( "Releasing Client Wattage Semaphore" );
-            this->m_clientWattageMutex.unlock();
+        LogPrint( "Releasing Client Wattage Semaphore" );
+        this->m_clientWattageMutex.unlock();
+    }
+    else if ( messageType == ClientVoltageResultType )
+    {
+        if ( size < sizeof( TMessageType ) + sizeof( TVoltage ) )
+        {
+            LOG_FUNCTION_END();
+            return ( 0 );
         }
-        else if ( messageType == ClientVoltageResultType )
+        LogPrint( "Message Type: Client Voltage Result" );
+        TVoltage voltageResult;
+        memcpy( &voltageResult, currentAddress, sizeof( TVoltage ) );
+        currentAddress += sizeof( TVoltage );
+
+        voltageResult = ntohl( voltageResult );
+        this->m_clientVoltageInformation = voltageResult;
+        LogPrint( "OpenDSS says: Client Voltage = ", this->m_clientVoltageInformation );
+
+        LogPrint( "Releasing Client Voltage Semaphore" );
+        this->m_clientVoltageMutex.unlock();
+    }
+    else if ( messageType == ClientVoltageDeviationResultType )
+    {
+        if ( size < sizeof( TMessageType ) + sizeof( TVoltage ) )
         {
-            remainingSize -= sizeof( TMessageType ) + sizeof( TVoltage );
-            LogPrint( "Message Type: Client Voltage Result" );
-            TVoltage voltageResult;
-            memcpy( &voltageResult, currentAddress, sizeof( TVoltage ) );
-            currentAddress += sizeof( TVoltage );
-
-            voltageResult = ntohl( voltageResult );
-            this->m_clientVoltageInformation = voltageResult;
-            LogPrint( "OpenDSS says: Client Voltage = ", this->m_clientVoltageInformation );
-
-            LogPrint( "Releasing Client Voltage Semaphore" );
-            this->m_clientVoltageMutex.unlock();
+            LOG_FUNCTION_END();
+            return ( 0 );
         }
-        else if ( messageType == ClientVoltageDeviationResultType )
+        LogPrint( "Message Type: Client Voltage Deviation Result" );
+        TVoltage voltageResult;
+        memcpy( &voltageResult, currentAddress, sizeof( TVoltage ) );
+        currentAddress += sizeof( TVoltage );
+        
+        voltageResult = ntohl( voltageResult );
+        this->m_clientVoltageDeviationInformation = voltageResult;
+        LogPrint( "OpenDSS says: Client Voltage Deviation = ", this->m_clientVoltageDeviationInformation );
+        
+        LogPrint( "Releasing Client Voltage Deviation Semaphore" );
+        this->m_clientVoltageDeviationMutex.unlock();
+    }
+    else if ( messageType == ClientVoltageDeviationAndConsumptionResultType )
+    {
+        if ( size < sizeof( TMessageType ) + sizeof( TVoltage ) + sizeof( TWattage ) )
         {
-            remainingSize -= sizeof( TMessageType ) + sizeof( TVoltage );
-            LogPrint( "Message Type: Client Voltage Deviation Result" );
-            TVoltage voltageResult;
-            memcpy( &voltageResult, currentAddress, sizeof( TVoltage ) );
-            currentAddress += sizeof( TVoltage );
-            
-            voltageResult = ntohl( voltageResult );
-            this->m_clientVoltageDeviationInformation = voltageResult;
-            LogPrint( "OpenDSS says: Client Voltage Deviation = ", this->m_clientVoltageDeviationInformation );
-            
-            LogPrint( "Releasing Client Voltage Deviation Semaphore" );
-            this->m_clientVoltageDeviationMutex.unlock();
+            LOG_FUNCTION_END();
+            return ( 0 );
         }
-        else if ( messageType == ClientVoltageDeviationAndConsumptionResultType )
+        LogPrint( "Message Type: Client Voltage Deviation and Consumption Result" );
+        TVoltage voltageResult;
+        memcpy( &voltageResult, currentAddress, sizeof( TVoltage ) );
+        currentAddress += sizeof( TVoltage );
+        
+        voltageResult = ntohl( voltageResult );
+        this->m_clientVoltageDeviationInformation = voltageResult;
+        
+        TWattage wattageResult;
+        memcpy( &wattageResult, currentAddress, sizeof( TWattage ) );
+        currentAddress += sizeof( TWattage );
+        
+        wattageResult = ntohl( wattageResult );
+        this->m_clientWattageInformation = wattageResult;
+        
+        LogPrint( "OpenDSS says: Client Voltage Deviation = ", this->m_clientVoltageDeviationInformation );
+        LogPrint( "OpenDSS says: Client Consumption = ", this->m_clientWattageInformation );
+        
+        LogPrint( "Releasing Client Voltage Deviation and Consumption Semaphore" );
+        this->m_clientVoltageDeviationAndConsumptionMutex.unlock();
+    }
+    else if ( messageType == ClientListEntryType )
+    {
+        if ( size < sizeof( TMessageType ) + sizeof( TClientNameLength ) )
         {
-            remainingSize -= sizeof( TMessageType ) + sizeof( TVoltage ) + sizeof( TWattage );
-            LogPrint( "Message Type: Client Voltage Deviation and Consumption Result" );
-            TVoltage voltageResult;
-            memcpy( &voltageResult, currentAddress, sizeof( TVoltage ) );
-            currentAddress += sizeof( TVoltage );
-            
-            voltageResult = ntohl( voltageResult );
-            this->m_clientVoltageDeviationInformation = voltageResult;
-            
-            TWattage wattageResult;
-            memcpy( &wattageResult, currentAddress, sizeof( TWattage ) );
-            currentAddress += sizeof( TWattage );
-            
-            wattageResult = ntohl( wattageResult );
-            this->m_clientWattageInformation = wattageResult;
-            
-            LogPrint( "OpenDSS says: Client Voltage Deviation = ", this->m_clientVoltageDeviationInformation );
-            LogPrint( "OpenDSS says: Client Consumption = ", this->m_clientWattageInformation );
-            
-            LogPrint( "Releasing Client Voltage Deviation and Consumption Semaphore" );
-            this->m_clientVoltageDeviationAndConsumptionMutex.unlock();
+            LOG_FUNCTION_END();
+            return ( 0 );
+        }
+        TClientNameLength nameLength;
+        memcpy( &nameLength, currentAddress, sizeof( TClientNameLength ) );
+        currentAddress += sizeof( TClientNameLength );
+
+        nameLength = ntohl( nameLength );
+        if ( nameLength > MaximumClientNameLength )
+        {
+            ErrorPrint( "Client name of length ", nameLength, " from OpenDSS, dropping the received data" );
+            LOG_FUNCTION_END();
+            return ( size );
+        }
+        if ( size < sizeof( TMessageType ) + sizeof( TClientNameLength ) + nameLength )
+        {
+            LOG_FUNCTION_END();
+            return ( 0 );
+        }
+        this->m_listedClients.emplace( currentAddress, nameLength );
+        currentAddress += nameLength;
+    }
+    else if ( messageType == ClientListEndType )
+    {
+        if ( size < sizeof( TMessageType ) + sizeof( TNumberOfClientNames ) )
+        {
+            LOG_FUNCTION_END();
+            return ( 0 );
+        }
+        TNumberOfClientNames numberOfNames;
+        memcpy( &numberOfNames, currentAddress, sizeof( TNumberOfClientNames ) );
+        currentAddress += sizeof( TNumberOfClientNames );
+
+        numberOfNames = ntohl( numberOfNames );
+        std::lock_guard<std::mutex> lockGuard( this->m_knownClientsLock );
+        if ( numberOfNames == this->m_listedClients.size() )
+        {
+            LogPrint( "OpenDSS says: ", numberOfNames, " known clients" );
+            this->m_knownClients.swap( this->m_listedClients );
         }
         else
         {
-            ErrorPrint( "Unknwon Message Type from OPENDSS" );
+            WarningPrint( "OpenDSS listed ", this->m_listedClients.size(), " of ", numberOfNames, " clients, keeping the previous list" );
         }
-        buffer = currentAddress;
+        this->m_listedClients.clear();
+    }
+    else
+    {
+        ErrorPrint( "Unknwon Message Type from OPENDSS" );
+        LOG_FUNCTION_END();
+        return ( size );
     }
     LOG_FUNCTION_END();
+    return ( currentAddress - message );
 }
 
 bool
 MatlabManager::IsClientPresent( const std::string & clientName )
 {
     LOG_FUNCTION_START();
+    {
+        std::lock_guard<std::mutex> lockGuard( this->m_knownClientsLock );
+        if ( this->m_knownClients.count( clientName ) > 0 )
+        {
+            LogPrint( "Client \"", clientName, "\" is in the list of OpenDSS" );
+            LOG_FUNCTION_END();
+            return ( true );
+        }
+    }
     LogPrint( "Checking with OpenDSS for client presence of: \"", clientName, "\"" );
 
     this->m_connectionReadyMutex.lock();
@@ -283,9 +419,15 @@ MatlabManager::IsClientPresent( const std::string & clientName )
     LogPrint( "Waiting for Client Presence Mutex" );
     this->m_clientPresenceMutex.lock();
     LogPrint( "Client Presence Mutex taken" );
+    bool clientPresentInformation = this->m_clientPresentInformation;
     this->m_connectionReadyMutex.unlock();
+    if ( clientPresentInformation )
+    {
+        std::lock_guard<std::mutex> lockGuard( this->m_knownClientsLock );
+        this->m_knownClients.insert( clientName );
+    }
     LOG_FUNCTION_END();
-    return ( this->m_clientPresentInformation );
+    return ( clientPresentInformation );
 }
 
 void
@@ -366,10 +508,11 @@ MatlabManager::GetWattage( const TClientName & clientName )
     LogPrint( "Waiting for Client Wattage Mutex" );
     this->m_clientWattageMutex.lock();
     LogPrint( "Client Wattage Mutex taken" );
+    TWattage clientWattageInformation = this->m_clientWattageInformation;
     this->m_connectionReadyMutex.unlock();
 
     LOG_FUNCTION_END();
-    return ( this->m_clientWattageInformation );
+    return ( clientWattageInformation );
 }
 
 MatlabManager::TVoltage
@@ -409,10 +552,11 @@ MatlabManager::GetVoltage( const TClientName & clientName )
     LogPrint( "Waiting for Client Voltage Mutex" );
     this->m_clientVoltageMutex.lock();
     LogPrint( "Client Voltage Mutex taken" );
+    TVoltage clientVoltageInformation = this->m_clientVoltageInformation;
     this->m_connectionReadyMutex.unlock();
 
     LOG_FUNCTION_END();
-    return ( this->m_clientVoltageInformation );
+    return ( clientVoltageInformation );
 }
 
 MatlabManager::TVoltage
@@ -450,12 +594,13 @@ MatlabManager::GetVoltageDeviation( const TClientName & clientName )
     }
     
     LogPrint( "Waiting for Client Voltage Deviation Mutex" );
-    this->m_clientVoltageMutex.lock();
+    this->m_clientVoltageDeviationMutex.lock();
     LogPrint( "Client Voltage Deviation Mutex taken" );
+    TVoltage clientVoltageDeviationInformation = this->m_clientVoltageDeviationInformation;
     this->m_connectionReadyMutex.unlock();
     
     LOG_FUNCTION_END();
-    return ( this->m_clientVoltageDeviationInformation );
+    return ( clientVoltageDeviationInformation );
 }
 
 std::pair<MatlabManager::TVoltage, MatlabManager::TWattage>
@@ -495,10 +640,11 @@ MatlabManager::GetVoltageDeviationAndConsumption( const TClientName & clientName
     LogPrint( "Waiting for Client Voltage Deviation and Consumption Mutex" );
     this->m_clientVoltageDeviationAndConsumptionMutex.lock();
     LogPrint( "Client Voltage Deviation and Consumption Mutex taken" );
+    std::pair<TVoltage, TWattage> result = std::make_pair( this->m_clientVoltageDeviationInformation, this->m_clientWattageInformation );
     this->m_connectionReadyMutex.unlock();
     
     LOG_FUNCTION_END();
-    return ( std::make_pair( this->m_clientVoltageDeviationInformation, this->m_clientWattageInformation ) );
+    return ( result );
 }
 
 void
@@ -531,5 +677,42 @@ MatlabManager::AdvanceTimeStep( void )
         return;
     }
     this->m_connectionReadyMutex.unlock();
+    
+    if ( this->m_clientListRefreshInterval > 0 && ++this->m_numberOfSteps % this->m_clientListRefreshInterval == 0 )
+    {
+        this->RequestClientList();
+    }
+    LOG_FUNCTION_END();
+}
+
+void
+MatlabManager::RequestClientList( void )
+{
+    LOG_FUNCTION_START();
+    this->m_connectionReadyMutex.lock();
+
+    size_t bufferSize = sizeof( int ) + sizeof( TMessageType );
+    auto buffer = CreateObjectArray<char>( bufferSize );
+    char* currentAddress = buffer;
+    int messageLength = htonl( bufferSize );
+
+    memcpy( currentAddress, &messageLength, sizeof( int ) );
+    currentAddress += sizeof( int );
+
+    TMessageType messageType = ClientListRequestType;
+    messageType = htonl( messageType );
+    memcpy( currentAddress, &messageType, sizeof( TMessageType ) );
+    currentAddress += sizeof( TMessageType );
+
+    LogPrint( "Requesting the Client List from OpenDSS" );
+    if ( this->m_client->SendData( buffer, bufferSize ) <= 0 )
+    {
+        ErrorPrint( "Send failed! OpenDSS MATLAB Connection is broken" );
+        this->m_connectionReadyMutex.unlock();
+        this->ConnectionBroken();
+        LOG_FUNCTION_END();
+        return;
+    }
+    this->m_connectionReadyMutex.unlock();
     LOG_FUNCTION_END();
 }
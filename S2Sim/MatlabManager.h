@@ -10,8 +10,11 @@
 
 #include <iostream>
 #include <mutex>
+#include <vector>
+#include <unordered_set>
 
 #include "ThreadedTCPServer.h"
+#include "ThreadedSharedMemoryServer.h"
 #include "ThreadedTCPConnectedClient.h"
 #include "SystemManager.h"
 #include "FunctionPointer.hpp"
@@ -78,6 +81,27 @@ class MatlabManager
             ClientVoltageDeviationResultType = ( TMessageType )0x0000000A, /**< Response of the OpenDSS controller to the voltage deviation get request. */
             ClientGetVoltageDeviationAndConsumptionType = ( TMessageType )0x0000000B, /**< Sent to OpenDSS controller to get the deviation and consumption of an object. */
             ClientVoltageDeviationAndConsumptionResultType = ( TMessageType )0x0000000C, /**< Response of the OpenDSS controller to the deviation and consumption of an object. */
+            ClientListRequestType = ( TMessageType )0x0000000D, /**< Sent to the OpenDSS controller to get the names of all objects. */
+            ClientListEntryType = ( TMessageType )0x0000000E, /**< Response of the OpenDSS controller carrying the name of a single object. */
+            ClientListEndType = ( TMessageType )0x0000000F, /**< Response of the OpenDSS controller after the last object name, carrying the number of names. */
+        };
+
+    /**
+     *  Defines the type of the name length in a ClientListEntryType message.
+     */
+        typedef unsigned int TClientNameLength;
+
+    /**
+     *  Defines the type of the number of names in a ClientListEndType message.
+     */
+        typedef unsigned int TNumberOfClientNames;
+
+    /**
+     *  Defines the limits of the client list messages.
+     */
+        enum ClientListLimitValues
+        {
+            MaximumClientNameLength = 0x00001000 /**< Longest accepted object name, protects against a corrupted stream. */
         };
 
     /**
@@ -110,11 +134,43 @@ class MatlabManager
      */
         typedef Asynchronous::ClientData::TDataPoint TVoltage;
 
+    /**
+     *  Defines the type for a number of time steps.
+     */
+        typedef unsigned int TNumberOfSteps;
+
     private:
     /**
      *  Implements the TCP server managing the connection to OpenDSS controller.
      */
         ThreadedTCPServer m_server;
+
+    /**
+     *  Unix domain socket server for the OpenDSS controller on the same host.
+     */
+        ThreadedTCPServer m_localServer;
+
+    /**
+     *  Indicates whether the Unix domain socket server listens.
+     */
+        bool m_useLocalServer;
+
+    /**
+     *  Indicates whether the TCP server listens.
+     */
+        bool m_usePort;
+
+#if defined( __linux__ )
+    /**
+     *  Shared memory server replacing the TCP server if a segment name is set.
+     */
+        ThreadedSharedMemoryServer m_sharedMemoryServer;
+
+    /**
+     *  Indicates whether the OpenDSS controller connects through shared memory.
+     */
+        bool m_useSharedMemory;
+#endif
     
     /**
      *  Pointer to the connection management with the OpenDSS controller.
@@ -173,6 +229,36 @@ class MatlabManager
     
         std::mutex m_deleteProcessFinishedMutex;
 
+    /**
+     *  Received data that does not yet form a complete message.
+     */
+        std::vector<char> m_receivedData;
+
+    /**
+     *  Names of the objects known to OpenDSS, used to admit clients without a round trip.
+     */
+        std::unordered_set<TClientName> m_knownClients;
+
+    /**
+     *  Names received so far in a client list, which replace the known objects when the list is complete.
+     */
+        std::unordered_set<TClientName> m_listedClients;
+
+    /**
+     *  Protects the known object names.
+     */
+        std::mutex m_knownClientsLock;
+
+    /**
+     *  Number of time steps between two client list requests, 0 requests the list only on connection.
+     */
+        TNumberOfSteps m_clientListRefreshInterval;
+
+    /**
+     *  Number of time steps since the start.
+     */
+        TNumberOfSteps m_numberOfSteps;
+
     private:
     /**
      *  Private constructor to implement the singleton.
@@ -185,6 +271,23 @@ class MatlabManager
         void
         DeleteClientThread( void );
 
+    /**
+     *  Requests the names of all objects from the OpenDSS controller without waiting for the response. An OpenDSS controller not supporting the request ignores it, and every client is checked with a round trip.
+     */
+        void
+        RequestClientList( void );
+
+    /**
+     *  Processes a single message from the OpenDSS controller.
+     *
+     *  @param message Start of the message.
+     *  @param size    Number of received bytes starting with the message.
+     *
+     *  @return Size of the processed message, 0 if the message is not completely received.
+     */
+        size_t
+        ProcessMessage( const char* message, const size_t size );
+
     public:
     /**
      *  Sets the OpenDSS controller connection information.
@@ -201,7 +304,69 @@ class MatlabManager
         ConnectionBroken( void );
 
     /**
-     *  Checks for the presence of a client by communicating with OpenDSS controller. It may block the function call.
+     *  Sets the options of the OpenDSS controller connection. Must be called before Initialize(), the OS defaults are kept otherwise.
+     *
+     *  @param options Socket options of the connection.
+     */
+        void
+        SetSocketOptions( const SocketOptions & options )
+        {
+            this->m_server.SetConnectionOptions( options );
+            this->m_localServer.SetConnectionOptions( options );
+        }
+
+    /**
+     *  Accepts the OpenDSS controller on a Unix domain socket as well. Must be called before Initialize().
+     *
+     *  @param path File system path of the socket.
+     *
+     *  @return Success of the binding.
+     */
+        bool
+        SetLocalPath( const std::string & path )
+        {
+            this->m_useLocalServer = this->m_localServer.SetLocalPath( path );
+            return ( this->m_useLocalServer );
+        }
+
+    /**
+     *  Enables or disables the TCP port 26998, so the OpenDSS controller can be accepted only on the Unix domain socket. Must be called before Initialize().
+     *
+     *  @param enabled Indicates whether the TCP server listens.
+     */
+        void
+        SetPortEnabled( const bool enabled )
+        {
+            this->m_usePort = enabled;
+        }
+
+#if defined( __linux__ )
+    /**
+     *  Accepts the OpenDSS controller through a shared memory segment instead of the TCP port. Must be called before Initialize().
+     *
+     *  @param name Name of the segment, starting with '/'.
+     */
+        void
+        SetSharedMemory( const std::string & name )
+        {
+            this->m_sharedMemoryServer.SetName( name );
+            this->m_useSharedMemory = true;
+        }
+#endif
+
+    /**
+     *  Sets how often the list of object names is requested again from the OpenDSS controller.
+     *
+     *  @param clientListRefreshInterval Number of time steps between two requests, 0 requests the list only on connection.
+     */
+        void
+        SetClientListRefreshInterval( const TNumberOfSteps clientListRefreshInterval )
+        {
+            this->m_clientListRefreshInterval = clientListRefreshInterval;
+        }
+
+    /**
+     *  Checks for the presence of a client. A client in the list of object names received from the OpenDSS controller is admitted locally, otherwise the OpenDSS controller is asked, which may block the function call.
      *
      *  @param clientName Name of the object to be checked.
      *
@@ -268,7 +433,7 @@ class MatlabManager
     /**
      *  @brief Processes the received message from OpenDSS controller.
      
-        This function processes all received messages from the OpenDSS controller. Note that, it is not guaranteed that the received buffer contains only a single message. This function uses a while loop to process all the messages to avoid data loss.
+        This function processes all received messages from the OpenDSS controller. Note that, it is not guaranteed that the received buffer contains only a single message or a complete message. This function uses a while loop to process all the complete messages and keeps the rest until more data is received to avoid data loss.
      *
      *  @param buffer Buffer containing the received data.
      *  @param size   Size of the received data.
@@ -12,6 +12,8 @@
 #include "LogPrint.h"
 
 #include <mutex>
+#include <atomic>
+#include <type_traits>
 
 template <typename Type>
 class SmartPointer
@@ -23,21 +25,9 @@ class SmartPointer
         template<typename Type2>
         friend class SmartPointer;
     
-        typedef size_t TReferenceNumber;
+        typedef std::atomic<size_t> TReferenceNumber;
         typedef Type TObject;
         
-        template <typename T, size_t N>
-        static constexpr bool IsArray( T(&)[N] )
-        {
-            return ( true );
-        }
-        
-        template <typename T>
-        static constexpr bool IsArray( const T & )
-        {
-            return ( false );
-        }
-        
         template <bool SelectFirstCondition, typename First, typename Second>
         struct TypeSelection
         {
@@ -52,7 +42,7 @@ class SmartPointer
         
         enum TypeProperties
         {
-            IsTypeArray = IsArray( *( ( Type* )( nullptr ) ) )
+            IsTypeArray = std::is_array<Type>::value
         };
         
         typedef typename TypeSelection<IsTypeArray, decltype( ( ( Type* )( nullptr ) )[0] ), Type>::TResult TSubscriptType;
@@ -124,8 +114,7 @@ class SmartPointer
             LOG_FUNCTION_START();
             if ( this->m_referenceNumber != nullptr )
             {
-                --( *( this->m_referenceNumber ) );
-                if ( *( this->m_referenceNumber ) == 0 )
+                if ( --( *( this->m_referenceNumber ) ) == 0 )
                 {
                     this->DeleteMemory();
                 }
@@ -0,0 +1,135 @@
+/**
+ * @file SendReactor.cpp
+ * Implements the SendReactor class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "SendReactor.h"
+
+#if defined( __linux__ )
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "TCPConnectedClient.h"
+
+SendReactor::SendReactor( void ) : m_epollId( epoll_create1( EPOLL_CLOEXEC ) ),
+                                   m_wakeUpId( eventfd( 0, EFD_CLOEXEC ) ),
+                                   m_started( true ),
+                                   m_queuedBytes( 0 ),
+                                   m_maximumQueuedBytes( 0 ),
+                                   m_deferredSends( 0 ),
+                                   m_flushes( 0 ),
+                                   m_evictions( 0 ),
+                                   m_failures( 0 )
+{
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    epoll_ctl( this->m_epollId, EPOLL_CTL_ADD, this->m_wakeUpId, &event );
+    this->m_thread = std::thread( &SendReactor::ExecutionBody, this );
+}
+
+SendReactor::~SendReactor( void )
+{
+    this->m_started = false;
+    uint64_t value = 1;
+    if ( write( this->m_wakeUpId, &value, sizeof( value ) ) == sizeof( value ) )
+    {
+        this->m_thread.join();
+    }
+    else
+    {
+        this->m_thread.detach();
+    }
+    close( this->m_wakeUpId );
+    close( this->m_epollId );
+}
+
+SendReactor&
+SendReactor::GetSendReactor( void )
+{
+    static SendReactor sendReactor;
+    return ( sendReactor );
+}
+
+void
+SendReactor::ExecutionBody( void )
+{
+    struct epoll_event events[MaximumNumberOfEvents];
+    while ( this->m_started )
+    {
+        int numberOfEvents = epoll_wait( this->m_epollId, events, MaximumNumberOfEvents, -1 );
+        std::lock_guard<std::mutex> lockGuard( this->m_lock );
+        for ( int eventIndex = 0; eventIndex < numberOfEvents; ++eventIndex )
+        {
+            TCPConnectedClient* client = ( TCPConnectedClient* )events[eventIndex].data.ptr;
+            if ( client != nullptr && this->m_clients.count( client ) > 0 )
+            {
+                ++this->m_flushes;
+                client->FlushOutboundQueue();
+            }
+        }
+    }
+}
+
+bool
+SendReactor::Add( TCPConnectedClient* client, const int socketId )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_lock );
+    struct epoll_event event;
+    event.events = EPOLLONESHOT;
+    event.data.ptr = client;
+    if ( epoll_ctl( this->m_epollId, EPOLL_CTL_ADD, socketId, &event ) != 0 )
+    {
+        return ( false );
+    }
+    this->m_clients.insert( client );
+    return ( true );
+}
+
+void
+SendReactor::Remove( TCPConnectedClient* client, const int socketId )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_lock );
+    if ( this->m_clients.erase( client ) > 0 )
+    {
+        epoll_ctl( this->m_epollId, EPOLL_CTL_DEL, socketId, nullptr );
+    }
+}
+
+bool
+SendReactor::Arm( TCPConnectedClient* client, const int socketId )
+{
+    struct epoll_event event;
+    event.events = EPOLLOUT | EPOLLONESHOT;
+    event.data.ptr = client;
+    return ( epoll_ctl( this->m_epollId, EPOLL_CTL_MOD, socketId, &event ) == 0 );
+}
+
+void
+SendReactor::AddQueuedBytes( const TNumberOfBytes numberOfBytes )
+{
+    ++this->m_deferredSends;
+    TNumberOfBytes queuedBytes = ( this->m_queuedBytes += numberOfBytes );
+    TNumberOfBytes maximumQueuedBytes = this->m_maximumQueuedBytes;
+    while ( queuedBytes > maximumQueuedBytes && !this->m_maximumQueuedBytes.compare_exchange_weak( maximumQueuedBytes, queuedBytes ) )
+    {
+    }
+}
+
+SendReactor::Statistics
+SendReactor::GetStatistics( void ) const
+{
+    Statistics statistics;
+    statistics.queuedBytes = this->m_queuedBytes;
+    statistics.maximumQueuedBytes = this->m_maximumQueuedBytes;
+    statistics.deferredSends = this->m_deferredSends;
+    statistics.flushes = this->m_flushes;
+    statistics.evictions = this->m_evictions;
+    statistics.failures = this->m_failures;
+    return ( statistics );
+}
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ * @file SendReactor.h
+ * Defines the SendReactor class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef SENDREACTOR_H_
+#define SENDREACTOR_H_
+
+#if defined( __linux__ )
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+class TCPConnectedClient;
+
+/**
+ *  @brief Flushes the outbound queues of the connected clients when their sockets become writable.
+
+    A connected client sends without blocking and queues what the socket does not take. The reactor thread waits on epoll for the sockets with queued data and lets the client flush its queue. A socket is armed once per wait, so only the sockets with queued data are watched. The reactor also keeps the backpressure statistics of all connected clients.
+ */
+class SendReactor
+{
+    public:
+    /**
+     *  Defines the counter type.
+     */
+        typedef unsigned long long TCounter;
+
+    /**
+     *  Defines the byte count type.
+     */
+        typedef size_t TNumberOfBytes;
+
+    /**
+     *  Backpressure statistics of all connected clients.
+     */
+        struct Statistics
+        {
+            /**
+             *  Bytes waiting in the outbound queues.
+             */
+            TNumberOfBytes queuedBytes;
+
+            /**
+             *  Largest number of bytes that waited in the outbound queues.
+             */
+            TNumberOfBytes maximumQueuedBytes;
+
+            /**
+             *  Number of sends that did not complete immediately and were queued.
+             */
+            TCounter deferredSends;
+
+            /**
+             *  Number of flushes of the reactor thread.
+             */
+            TCounter flushes;
+
+            /**
+             *  Number of connections closed for exceeding their outbound queue limit.
+             */
+            TCounter evictions;
+
+            /**
+             *  Number of connections closed for a failed send.
+             */
+            TCounter failures;
+        };
+
+    private:
+    /**
+     *  Defines the number of events handled per wait.
+     */
+        enum EventValues
+        {
+            MaximumNumberOfEvents = 64
+        };
+
+    /**
+     *  Handle of the epoll instance.
+     */
+        int m_epollId;
+
+    /**
+     *  Event handle that wakes the thread up to stop.
+     */
+        int m_wakeUpId;
+
+    /**
+     *  Indicates whether the thread is running.
+     */
+        std::atomic<bool> m_started;
+
+    /**
+     *  Reactor thread.
+     */
+        std::thread m_thread;
+
+    /**
+     *  Protects the registered clients. The lock is held while a client flushes, so a client removed under the lock is never flushed afterwards.
+     */
+        std::mutex m_lock;
+
+    /**
+     *  Registered clients.
+     */
+        std::unordered_set<TCPConnectedClient*> m_clients;
+
+    /**
+     *  Bytes waiting in the outbound queues.
+     */
+        std::atomic<TNumberOfBytes> m_queuedBytes;
+
+    /**
+     *  Largest number of bytes that waited in the outbound queues.
+     */
+        std::atomic<TNumberOfBytes> m_maximumQueuedBytes;
+
+    /**
+     *  Number of queued sends.
+     */
+        std::atomic<TCounter> m_deferredSends;
+
+    /**
+     *  Number of flushes.
+     */
+        std::atomic<TCounter> m_flushes;
+
+    /**
+     *  Number of evicted connections.
+     */
+        std::atomic<TCounter> m_evictions;
+
+    /**
+     *  Number of failed connections.
+     */
+        std::atomic<TCounter> m_failures;
+
+    private:
+    /**
+     *  Creates the epoll instance and starts the thread.
+     */
+        SendReactor( void );
+
+    /**
+     *  Stops the thread and closes the epoll instance.
+     */
+        ~SendReactor( void );
+
+    /**
+     *  The execution body of the thread. Flushes the clients whose sockets became writable.
+     */
+        void
+        ExecutionBody( void );
+
+    public:
+        SendReactor( const SendReactor & ) = delete;
+
+        SendReactor&
+        operator = ( const SendReactor & ) = delete;
+
+    /**
+     *  Returns the single instance.
+     *
+     *  @return Reactor of the process.
+     */
+        static SendReactor&
+        GetSendReactor( void );
+
+    /**
+     *  Registers a client without watching its socket. The socket is registered as one-shot, so the hang-up reported after a failed send disables it until it is armed again instead of waking the reactor on every wait.
+     *
+     *  @param client   Client to be registered.
+     *  @param socketId Socket of the client.
+     *
+     *  @return Success of the registration.
+     */
+        bool
+        Add( TCPConnectedClient* client, const int socketId );
+
+    /**
+     *  Removes a client. Waits for a running flush of the client, the client is not flushed afterwards.
+     *
+     *  @param client   Client to be removed.
+     *  @param socketId Socket of the client.
+     */
+        void
+        Remove( TCPConnectedClient* client, const int socketId );
+
+    /**
+     *  Watches the socket of a registered client until it becomes writable once.
+     *
+     *  @param client   Client with queued data.
+     *  @param socketId Socket of the client.
+     *
+     *  @return Success of arming the socket.
+     */
+        bool
+        Arm( TCPConnectedClient* client, const int socketId );
+
+    /**
+     *  Accounts for bytes added to an outbound queue.
+     *
+     *  @param numberOfBytes Number of queued bytes.
+     */
+        void
+        AddQueuedBytes( const TNumberOfBytes numberOfBytes );
+
+    /**
+     *  Accounts for bytes leaving an outbound queue.
+     *
+     *  @param numberOfBytes Number of sent or dropped bytes.
+     */
+        void
+        RemoveQueuedBytes( const TNumberOfBytes numberOfBytes )
+        {
+            this->m_queuedBytes -= numberOfBytes;
+        }
+
+    /**
+     *  Counts an eviction.
+     */
+        void
+        CountEviction( void )
+        {
+            ++this->m_evictions;
+        }
+
+    /**
+     *  Counts a failed connection.
+     */
+        void
+        CountFailure( void )
+        {
+            ++this->m_failures;
+        }
+
+    /**
+     *  Returns the backpressure statistics.
+     *
+     *  @return Statistics of all connected clients.
+     */
+        Statistics
+        GetStatistics( void ) const;
+};
+
+#endif
+
+#endif /* SENDREACTOR_H_ */
@@ -0,0 +1,336 @@
+/**
+ * @file SharedMemoryChannel.cpp
+ * Implements the SharedMemoryChannel class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "SharedMemoryChannel.h"
+
+#if defined( __linux__ )
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <poll.h>
+#include <errno.h>
+#include <time.h>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <algorithm>
+
+SharedMemoryChannel::SharedMemoryChannel( void ) : m_side( ServerSide ),
+                                                   m_header( nullptr ),
+                                                   m_size( 0 ),
+                                                   m_peerProcessId( -1 )
+{
+}
+
+SharedMemoryChannel::~SharedMemoryChannel( void )
+{
+    if ( this->m_header != nullptr )
+    {
+        munmap( this->m_header, this->m_size );
+    }
+    if ( this->m_peerProcessId != -1 )
+    {
+        close( this->m_peerProcessId );
+    }
+}
+
+bool
+SharedMemoryChannel::Map( const int descriptor, const TNumberOfBytes size )
+{
+    void* address = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0 );
+    close( descriptor );
+    if ( address == MAP_FAILED )
+    {
+        return ( false );
+    }
+    this->m_header = ( Header* )address;
+    this->m_size = size;
+    return ( true );
+}
+
+void
+SharedMemoryChannel::OpenPeerProcess( void )
+{
+#if defined( SYS_pidfd_open )
+    int32_t processId = this->m_header->processIds[1 - this->m_side].load();
+    if ( processId > 0 )
+    {
+        this->m_peerProcessId = ( int )syscall( SYS_pidfd_open, processId, 0 );
+    }
+#endif
+}
+
+bool
+SharedMemoryChannel::Create( const std::string & name, const TNumberOfBytes capacity )
+{
+    TNumberOfBytes ringCapacity = 4096;
+    while ( ringCapacity < capacity )
+    {
+        ringCapacity <<= 1;
+    }
+    TNumberOfBytes size = sizeof( Header ) + 2 * ringCapacity;
+
+    shm_unlink( name.c_str() );
+    int descriptor = shm_open( name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+    if ( descriptor == -1 )
+    {
+        return ( false );
+    }
+    if ( ftruncate( descriptor, size ) != 0 )
+    {
+        close( descriptor );
+        shm_unlink( name.c_str() );
+        return ( false );
+    }
+    if ( !this->Map( descriptor, size ) )
+    {
+        shm_unlink( name.c_str() );
+        return ( false );
+    }
+
+    new ( this->m_header ) Header();
+    this->m_header->capacity = ringCapacity;
+    this->m_header->state = WaitingState;
+    this->m_header->processIds[ServerSide] = getpid();
+    this->m_header->processIds[ClientSide] = 0;
+    for ( int side = ServerSide; side <= ClientSide; ++side )
+    {
+        Ring & ring = this->m_header->rings[side];
+        ring.head = 0;
+        ring.tail = 0;
+        ring.dataSequence = 0;
+        ring.spaceSequence = 0;
+        ring.readerWaiting = 0;
+        ring.writerWaiting = 0;
+    }
+    this->m_header->magic = Magic;
+    this->m_header->version = Version;
+    this->m_name = name;
+    this->m_side = ServerSide;
+    return ( true );
+}
+
+bool
+SharedMemoryChannel::Open( const std::string & name )
+{
+    int descriptor = shm_open( name.c_str(), O_RDWR, 0 );
+    struct stat segmentStatus;
+    if ( descriptor == -1 )
+    {
+        return ( false );
+    }
+    if ( fstat( descriptor, &segmentStatus ) != 0 || ( TNumberOfBytes )segmentStatus.st_size < sizeof( Header ) )
+    {
+        close( descriptor );
+        return ( false );
+    }
+    if ( !this->Map( descriptor, ( TNumberOfBytes )segmentStatus.st_size ) )
+    {
+        return ( false );
+    }
+
+    uint32_t expectedState = WaitingState;
+    if ( this->m_header->magic != Magic ||
+         this->m_header->version != Version ||
+         sizeof( Header ) + 2 * this->m_header->capacity != this->m_size )
+    {
+        munmap( this->m_header, this->m_size );
+        this->m_header = nullptr;
+        return ( false );
+    }
+    if ( !this->m_header->state.compare_exchange_strong( expectedState, AttachedState ) )
+    {
+        munmap( this->m_header, this->m_size );
+        this->m_header = nullptr;
+        return ( false );
+    }
+    this->m_header->processIds[ClientSide] = getpid();
+    syscall( SYS_futex, &this->m_header->state, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0 );
+    this->m_name = name;
+    this->m_side = ClientSide;
+    this->OpenPeerProcess();
+    return ( true );
+}
+
+bool
+SharedMemoryChannel::WaitForPeer( void )
+{
+    struct timespec waitTime = { 0, WaitTime * 1000000L };
+    while ( this->m_header->state.load() == WaitingState )
+    {
+        syscall( SYS_futex, &this->m_header->state, FUTEX_WAIT, WaitingState, &waitTime, nullptr, 0 );
+    }
+    shm_unlink( this->m_name.c_str() );
+    this->OpenPeerProcess();
+    return ( this->m_header->state.load() == AttachedState );
+}
+
+void
+SharedMemoryChannel::WaitUntilClosed( void )
+{
+    struct timespec waitTime = { 0, WaitTime * 1000000L };
+    uint32_t state;
+    while ( ( state = this->m_header->state.load() ) != ClosedState )
+    {
+        syscall( SYS_futex, &this->m_header->state, FUTEX_WAIT, state, &waitTime, nullptr, 0 );
+        if ( this->IsPeerGone() )
+        {
+            this->Close();
+        }
+    }
+}
+
+bool
+SharedMemoryChannel::IsPeerGone( void ) const
+{
+    if ( this->m_peerProcessId != -1 )
+    {
+        struct pollfd peerProcess = { this->m_peerProcessId, POLLIN, 0 };
+        return ( poll( &peerProcess, 1, 0 ) > 0 );
+    }
+    int32_t processId = this->m_header->processIds[1 - this->m_side].load();
+    return ( processId > 0 && kill( processId, 0 ) != 0 && errno == ESRCH );
+}
+
+template <typename TCondition>
+void
+SharedMemoryChannel::Wait( std::atomic<uint32_t> & sequence, std::atomic<uint32_t> & waiting, TCondition condition )
+{
+    static const unsigned int spinCount = ( std::thread::hardware_concurrency() > 1 ? SpinCount : 0 );
+    for ( unsigned int spin = 0; spin < spinCount; ++spin )
+    {
+        if ( condition() || this->IsClosed() )
+        {
+            return;
+        }
+#if defined( __x86_64__ ) || defined( __i386__ )
+        __builtin_ia32_pause();
+#endif
+    }
+
+    uint32_t currentSequence = sequence.load();
+    waiting.store( 1 );
+    if ( !condition() && !this->IsClosed() )
+    {
+        struct timespec waitTime = { 0, WaitTime * 1000000L };
+        if ( syscall( SYS_futex, &sequence, FUTEX_WAIT, currentSequence, &waitTime, nullptr, 0 ) != 0 &&
+             errno == ETIMEDOUT &&
+             this->IsPeerGone() )
+        {
+            this->Close();
+        }
+    }
+    waiting.store( 0 );
+}
+
+void
+SharedMemoryChannel::Signal( std::atomic<uint32_t> & sequence, const std::atomic<uint32_t> & waiting )
+{
+    sequence.fetch_add( 1 );
+    if ( waiting.load() != 0 )
+    {
+        syscall( SYS_futex, &sequence, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0 );
+    }
+}
+
+SharedMemoryChannel::TNumberOfBytes
+SharedMemoryChannel::Write( const void* buffer, const TNumberOfBytes length )
+{
+    if ( this->m_header == nullptr )
+    {
+        return ( 0 );
+    }
+    const int readingSide = 1 - this->m_side;
+    Ring & ring = this->m_header->rings[readingSide];
+    char* data = this->GetRingData( readingSide );
+    const TNumberOfBytes capacity = this->m_header->capacity;
+    TNumberOfBytes writtenBytes = 0;
+    while ( writtenBytes < length )
+    {
+        if ( this->IsClosed() )
+        {
+            return ( 0 );
+        }
+        uint64_t head = ring.head.load( std::memory_order_relaxed );
+        uint64_t tail = ring.tail.load();
+        TNumberOfBytes freeBytes = capacity - ( TNumberOfBytes )( head - tail );
+        if ( freeBytes == 0 )
+        {
+            this->Wait( ring.spaceSequence, ring.writerWaiting, [&ring, tail]() { return ( ring.tail.load() != tail ); } );
+            continue;
+        }
+        TNumberOfBytes chunk = std::min( freeBytes, length - writtenBytes );
+        TNumberOfBytes offset = ( TNumberOfBytes )( head & ( capacity - 1 ) );
+        TNumberOfBytes firstPart = std::min( chunk, capacity - offset );
+        memcpy( data + offset, ( const char* )buffer + writtenBytes, firstPart );
+        memcpy( data, ( const char* )buffer + writtenBytes + firstPart, chunk - firstPart );
+        ring.head.store( head + chunk );
+        writtenBytes += chunk;
+        Signal( ring.dataSequence, ring.readerWaiting );
+    }
+    return ( length );
+}
+
+SharedMemoryChannel::TNumberOfBytes
+SharedMemoryChannel::Read( void* buffer, const TNumberOfBytes length )
+{
+    if ( this->m_header == nullptr )
+    {
+        return ( 0 );
+    }
+    Ring & ring = this->m_header->rings[this->m_side];
+    const char* data = this->GetRingData( this->m_side );
+    const TNumberOfBytes capacity = this->m_header->capacity;
+    while ( true )
+    {
+        uint64_t tail = ring.tail.load( std::memory_order_relaxed );
+        uint64_t head = ring.head.load();
+        if ( head != tail )
+        {
+            TNumberOfBytes chunk = std::min( ( TNumberOfBytes )( head - tail ), length );
+            TNumberOfBytes offset = ( TNumberOfBytes )( tail & ( capacity - 1 ) );
+            TNumberOfBytes firstPart = std::min( chunk, capacity - offset );
+            memcpy( buffer, data + offset, firstPart );
+            memcpy( ( char* )buffer + firstPart, data, chunk - firstPart );
+            ring.tail.store( tail + chunk );
+            Signal( ring.spaceSequence, ring.writerWaiting );
+            return ( chunk );
+        }
+        if ( this->IsClosed() )
+        {
+            return ( 0 );
+        }
+        this->Wait( ring.dataSequence, ring.readerWaiting, [&ring, tail]() { return ( ring.head.load() != tail ); } );
+    }
+}
+
+void
+SharedMemoryChannel::Close( void )
+{
+    if ( this->m_header == nullptr )
+    {
+        return;
+    }
+    this->m_header->state = ClosedState;
+    syscall( SYS_futex, &this->m_header->state, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0 );
+    for ( int side = ServerSide; side <= ClientSide; ++side )
+    {
+        Ring & ring = this->m_header->rings[side];
+        ring.dataSequence.fetch_add( 1 );
+        ring.spaceSequence.fetch_add( 1 );
+        syscall( SYS_futex, &ring.dataSequence, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0 );
+        syscall( SYS_futex, &ring.spaceSequence, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0 );
+    }
+}
+
+#endif
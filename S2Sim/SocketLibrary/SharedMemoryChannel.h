@@ -0,0 +1,321 @@
+/**
+ * @file SharedMemoryChannel.h
+ * Defines the SharedMemoryChannel class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef SHAREDMEMORYCHANNEL_H_
+#define SHAREDMEMORYCHANNEL_H_
+
+#if defined( __linux__ )
+
+#include <atomic>
+#include <string>
+#include <stdint.h>
+
+/**
+ *  @brief Byte stream between two processes on the same host through a shared memory segment, an alternative to a TCP connection.
+
+    The segment holds a single producer, single consumer ring buffer for each direction. Writing and reading copy the data into and out of the ring without a system call. A side waiting for data or space spins shortly and then sleeps on a futex in the segment, which the other side wakes only if it is sleeping. Like a TCP connection, the stream does not keep message boundaries.
+
+    The server side creates the segment and waits for the client side to attach. The name is removed after the attachment, so a new segment can be created for the next client. Closing either side ends the stream for both, and a side whose peer process ended sees the stream closed as well.
+ */
+class SharedMemoryChannel
+{
+    public:
+    /**
+     *  Defines the type for number of bytes.
+     */
+        typedef size_t TNumberOfBytes;
+
+    /**
+     *  Defines the sides of the channel.
+     */
+        enum SideValues
+        {
+            ServerSide = 0, /**< Creates the segment. */
+            ClientSide = 1 /**< Attaches to the segment. */
+        };
+
+    /**
+     *  Defines the channel parameters.
+     */
+        enum ChannelValues
+        {
+            DefaultCapacity = 0x400000, /**< Ring size of each direction, a power of two. */
+            SpinCount = 2000, /**< Checks before a waiting side sleeps, no spinning on a single CPU where the peer could not run meanwhile. */
+            WaitTime = 100 /**< Longest sleep in milliseconds before the peer process is checked. */
+        };
+
+    private:
+    /**
+     *  Defines the states of the segment.
+     */
+        enum StateValues
+        {
+            WaitingState = 0, /**< Created, no client attached. */
+            AttachedState = 1, /**< Client attached. */
+            ClosedState = 2 /**< Closed by a side. */
+        };
+
+    /**
+     *  Identifies a segment.
+     */
+        enum HeaderValues
+        {
+            Magic = 0x53325348, /**< Identifies a channel segment. */
+            Version = 0x00000001 /**< Version of the layout. */
+        };
+
+    /**
+     *  Positions and signals of a ring in the segment. The positions only increase, the offset in the ring is the position modulo the capacity. The written and the read positions are on separate cache lines, as they are updated by different processes.
+     */
+        struct Ring
+        {
+            /**
+             *  Position after the last written byte.
+             */
+            alignas( 64 ) std::atomic<uint64_t> head;
+
+            /**
+             *  Position of the next read byte.
+             */
+            alignas( 64 ) std::atomic<uint64_t> tail;
+
+            /**
+             *  Incremented after each write, the futex the reader sleeps on.
+             */
+            std::atomic<uint32_t> dataSequence;
+
+            /**
+             *  Incremented after each read, the futex the writer sleeps on.
+             */
+            std::atomic<uint32_t> spaceSequence;
+
+            /**
+             *  Indicates whether the reader sleeps.
+             */
+            std::atomic<uint32_t> readerWaiting;
+
+            /**
+             *  Indicates whether the writer sleeps.
+             */
+            std::atomic<uint32_t> writerWaiting;
+        };
+
+    /**
+     *  Start of the segment, followed by the data of the rings.
+     */
+        struct Header
+        {
+            /**
+             *  Identification of the segment.
+             */
+            uint32_t magic;
+
+            /**
+             *  Version of the layout.
+             */
+            uint32_t version;
+
+            /**
+             *  Size of each ring.
+             */
+            uint64_t capacity;
+
+            /**
+             *  State of the segment, the futex the server sleeps on while waiting for the client.
+             */
+            std::atomic<uint32_t> state;
+
+            /**
+             *  Process ids of the sides.
+             */
+            std::atomic<int32_t> processIds[2];
+
+            /**
+             *  Ring of each direction, indexed with the reading side.
+             */
+            Ring rings[2];
+        };
+
+    private:
+    /**
+     *  Name of the segment.
+     */
+        std::string m_name;
+
+    /**
+     *  Side of this instance.
+     */
+        SideValues m_side;
+
+    /**
+     *  Mapped segment.
+     */
+        Header* m_header;
+
+    /**
+     *  Size of the mapped segment.
+     */
+        TNumberOfBytes m_size;
+
+    /**
+     *  Process file descriptor of the other side, readable once the process ended, -1 if not available.
+     */
+        int m_peerProcessId;
+
+    private:
+    /**
+     *  Maps an opened segment.
+     *
+     *  @param descriptor File descriptor of the segment.
+     *  @param size       Size of the segment.
+     *
+     *  @return Success of the mapping.
+     */
+        bool
+        Map( const int descriptor, const TNumberOfBytes size );
+
+    /**
+     *  Opens the process file descriptor of the attached other side. Unlike the process id, it detects an ended process that is not reaped yet and is not reused.
+     */
+        void
+        OpenPeerProcess( void );
+
+    /**
+     *  Returns the data of a ring.
+     *
+     *  @param side Reading side of the ring.
+     *
+     *  @return Start of the ring data.
+     */
+        char*
+        GetRingData( const int side ) const
+        {
+            return ( ( char* )( this->m_header + 1 ) + side * this->m_header->capacity );
+        }
+
+    /**
+     *  Sleeps until the sequence changes, the condition holds or the wait time passes. Spins before sleeping if there are several CPUs, and closes the channel if the peer process ended.
+     *
+     *  @param sequence  Futex to sleep on.
+     *  @param waiting   Flag telling the other side to wake the futex.
+     *  @param condition Condition ending the wait.
+     */
+        template <typename TCondition>
+        void
+        Wait( std::atomic<uint32_t> & sequence, std::atomic<uint32_t> & waiting, TCondition condition );
+
+    /**
+     *  Increments a sequence and wakes its sleeper.
+     *
+     *  @param sequence Futex to be woken.
+     *  @param waiting  Flag of the sleeper, the futex is woken only if it is set.
+     */
+        static void
+        Signal( std::atomic<uint32_t> & sequence, const std::atomic<uint32_t> & waiting );
+
+    /**
+     *  Checks whether the process of the other side ended.
+     *
+     *  @return true if the peer attached and its process does not exist anymore.
+     */
+        bool
+        IsPeerGone( void ) const;
+
+    public:
+    /**
+     *  Creates an unconnected channel.
+     */
+        SharedMemoryChannel( void );
+
+    /**
+     *  Unmaps the segment without closing the stream.
+     */
+        ~SharedMemoryChannel( void );
+
+        SharedMemoryChannel( const SharedMemoryChannel & ) = delete;
+
+        SharedMemoryChannel&
+        operator = ( const SharedMemoryChannel & ) = delete;
+
+    /**
+     *  Creates the segment as the server side. A previous segment with the same name is replaced.
+     *
+     *  @param name     Name of the segment, starting with '/'.
+     *  @param capacity Size of each ring, rounded up to a power of two.
+     *
+     *  @return Success of the creation.
+     */
+        bool
+        Create( const std::string & name, const TNumberOfBytes capacity = DefaultCapacity );
+
+    /**
+     *  Attaches to a segment as the client side.
+     *
+     *  @param name Name of the segment, starting with '/'.
+     *
+     *  @return false if there is no segment waiting for a client.
+     */
+        bool
+        Open( const std::string & name );
+
+    /**
+     *  Waits for a client to attach to the created segment and removes the name.
+     *
+     *  @return false if the channel is closed before.
+     */
+        bool
+        WaitForPeer( void );
+
+    /**
+     *  Waits until either side closes the channel.
+     */
+        void
+        WaitUntilClosed( void );
+
+    /**
+     *  Writes data to the other side. Blocks while the ring is full.
+     *
+     *  @param buffer Data to be written.
+     *  @param length Length of the data.
+     *
+     *  @return length, 0 if the channel is closed.
+     */
+        TNumberOfBytes
+        Write( const void* buffer, const TNumberOfBytes length );
+
+    /**
+     *  Reads the available data, up to the length of the buffer. Blocks while there is no data.
+     *
+     *  @param buffer Buffer receiving the data.
+     *  @param length Length of the buffer.
+     *
+     *  @return Number of bytes read, 0 if the channel is closed and empty.
+     */
+        TNumberOfBytes
+        Read( void* buffer, const TNumberOfBytes length );
+
+    /**
+     *  Closes the stream for both sides and wakes up the waiting sides.
+     */
+        void
+        Close( void );
+
+    /**
+     *  Checks whether the stream is closed.
+     *
+     *  @return true if a side closed the channel or it is not connected.
+     */
+        bool
+        IsClosed( void ) const
+        {
+            return ( this->m_header == nullptr || this->m_header->state.load() == ClosedState );
+        }
+};
+
+#endif
+
+#endif /* SHAREDMEMORYCHANNEL_H_ */
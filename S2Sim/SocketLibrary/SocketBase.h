@@ -9,12 +9,14 @@
 #define SOCKETBASE_H_
 
 #include "LogPrint.h"
+#include "SocketOptions.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <winsock2.h>
 #elif defined( __linux__ ) || defined ( __APPLE__ )
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <sys/un.h>
 #include <netdb.h>
 #include <arpa/inet.h>
@@ -85,7 +87,7 @@ class SocketBase
      *
      *  @param socketId Handle of a socket.
      */
-        SocketBase( const TSocketId socketId ) : m_socketId( socketId ){}
+        SocketBase( const TSocketId socketId ) : m_socketId( socketId ), m_quickAck( false ){}
     
     /**
      *  Copies the handle of another socket.
@@ -99,7 +101,7 @@ class SocketBase
      *
      *  @param movedObject Socket to be moved.
      */
-        SocketBase( SocketBase<SocketType> && movedObject ) : m_socketId( movedObject.m_socketId )
+        SocketBase( SocketBase<SocketType> && movedObject ) : m_socketId( movedObject.m_socketId ), m_quickAck( movedObject.m_quickAck )
         {
             movedObject.m_socketId = InvalidSocketId;
         }
@@ -126,12 +128,68 @@ class SocketBase
      */
         TSocketId m_socketId;
 
+    /**
+     *  Indicates whether the immediate acknowledgement is renewed after every reception.
+     */
+        bool m_quickAck;
+
+    protected:
+    /**
+     *  Renews the immediate acknowledgement if it is enabled, as the OS clears it by itself. Called after every reception.
+     */
+        void
+        RenewQuickAck( void )
+        {
+#if defined( __linux__ )
+            if ( this->m_quickAck )
+            {
+                int value = 1;
+                setsockopt( this->m_socketId, IPPROTO_TCP, TCP_QUICKACK, &value, sizeof( value ) );
+            }
+#endif
+        }
+
+    /**
+     *  Sets an integer socket option.
+     *
+     *  @param level  Protocol level of the option.
+     *  @param option Option to be set.
+     *  @param value  Value of the option.
+     *  @param name   Name of the option for the warning.
+     *
+     *  @return Success of setting the option.
+     */
+        bool
+        SetIntegerOption( const int level, const int option, const int value, const char* name );
+
+    /**
+     *  Replaces the socket with a new one of another address family, e.g. AF_UNIX for a Unix domain socket.
+     *
+     *  @param domain Address family of the new socket.
+     */
+        void
+        ReopenSocket( const int domain )
+        {
+            this->CloseSocket();
+            this->OpenSocket( domain );
+        }
+
+    /**
+     *  Checks whether the socket is a Unix domain socket, where the TCP options do not apply.
+     *
+     *  @return true if the socket is bound or connected to a path.
+     */
+        bool
+        IsLocal( void ) const;
+
     private:
     /**
      *  Opens a new socket and sets its reusable options.
+     *
+     *  @param domain Address family of the socket.
      */
         void
-        OpenSocket( void );
+        OpenSocket( const int domain = AF_INET );
 
     /**
      *  Closes the socket handle.
@@ -145,10 +203,20 @@ class SocketBase
         {
             this->CloseSocket();
         }
+
+    /**
+     *  Applies the options that are not left unchanged. Every option is tried even if a previous one failed. Only the buffer sizes are applied to a Unix domain socket.
+     *
+     *  @param options Options to be applied.
+     *
+     *  @return false if an option could not be set.
+     */
+        bool
+        SetOptions( const SocketOptions & options );
 };
 
 template <int SocketType>
-SocketBase<SocketType>::SocketBase( void ) : m_socketId( InvalidSocketId )
+SocketBase<SocketType>::SocketBase( void ) : m_socketId( InvalidSocketId ), m_quickAck( false )
 {
 #if defined(_WIN32) || defined(_WIN64)
     static WindowsStarter windowsStarterInstance;
@@ -164,10 +232,10 @@ SocketBase<SocketType>::~SocketBase( void )
 
 template <int SocketType>
 void
-SocketBase<SocketType>::OpenSocket( void )
+SocketBase<SocketType>::OpenSocket( const int domain )
 {
     LOG_FUNCTION_START();
-    this->m_socketId = socket( AF_INET, SocketType, 0 );
+    this->m_socketId = socket( domain, SocketType, 0 );
     if ( this->m_socketId <= 0 )
     {
         ErrorPrint( "Invalid Socket" );
@@ -202,8 +270,96 @@ SocketBase<SocketType>::CloseSocket( void )
         LogPrint( "Socket Closed" );
         close( this->m_socketId );
 #endif
+        this->m_socketId = InvalidSocketId;
     }
     LOG_FUNCTION_END();
 }
 
+template <int SocketType>
+bool
+SocketBase<SocketType>::SetIntegerOption( const int level, const int option, const int value, const char* name )
+{
+    if ( 0 != setsockopt( this->m_socketId, level, option, ( const char* )&value, sizeof( value ) ) )
+    {
+        WarningPrint( "Socket Option ", name, " Not Set! Error: ", errno );
+        return ( false );
+    }
+    return ( true );
+}
+
+template <int SocketType>
+bool
+SocketBase<SocketType>::IsLocal( void ) const
+{
+#if defined( __linux__ ) || defined ( __APPLE__ )
+    struct sockaddr_storage address;
+    socklen_t length = sizeof( address );
+    return ( getsockname( this->m_socketId, ( struct sockaddr* )&address, &length ) == 0 && address.ss_family == AF_UNIX );
+#else
+    return ( false );
+#endif
+}
+
+template <int SocketType>
+bool
+SocketBase<SocketType>::SetOptions( const SocketOptions & options )
+{
+    LOG_FUNCTION_START();
+    bool success = true;
+    if ( options.sendBufferSize > 0 )
+    {
+        success = this->SetIntegerOption( SOL_SOCKET, SO_SNDBUF, options.sendBufferSize, "SO_SNDBUF" ) && success;
+    }
+    if ( options.receiveBufferSize > 0 )
+    {
+        success = this->SetIntegerOption( SOL_SOCKET, SO_RCVBUF, options.receiveBufferSize, "SO_RCVBUF" ) && success;
+    }
+    if ( this->IsLocal() )
+    {
+        LOG_FUNCTION_END();
+        return ( success );
+    }
+    if ( options.noDelay != SocketOptions::Unchanged )
+    {
+        success = this->SetIntegerOption( IPPROTO_TCP, TCP_NODELAY, options.noDelay, "TCP_NODELAY" ) && success;
+    }
+    if ( options.keepAlive != SocketOptions::Unchanged )
+    {
+        success = this->SetIntegerOption( SOL_SOCKET, SO_KEEPALIVE, options.keepAlive, "SO_KEEPALIVE" ) && success;
+    }
+#if defined( TCP_KEEPIDLE )
+    if ( options.keepAliveIdleTime > 0 )
+    {
+        success = this->SetIntegerOption( IPPROTO_TCP, TCP_KEEPIDLE, options.keepAliveIdleTime, "TCP_KEEPIDLE" ) && success;
+    }
+#endif
+#if defined( TCP_KEEPINTVL )
+    if ( options.keepAliveInterval > 0 )
+    {
+        success = this->SetIntegerOption( IPPROTO_TCP, TCP_KEEPINTVL, options.keepAliveInterval, "TCP_KEEPINTVL" ) && success;
+    }
+#endif
+#if defined( TCP_KEEPCNT )
+    if ( options.keepAliveCount > 0 )
+    {
+        success = this->SetIntegerOption( IPPROTO_TCP, TCP_KEEPCNT, options.keepAliveCount, "TCP_KEEPCNT" ) && success;
+    }
+#endif
+#if defined( __linux__ )
+    if ( options.quickAck != SocketOptions::Unchanged )
+    {
+        this->m_quickAck = ( options.quickAck == SocketOptions::Enabled );
+        success = this->SetIntegerOption( IPPROTO_TCP, TCP_QUICKACK, options.quickAck, "TCP_QUICKACK" ) && success;
+    }
+#if defined( SO_BUSY_POLL )
+    if ( options.busyPollTime > 0 )
+    {
+        success = this->SetIntegerOption( SOL_SOCKET, SO_BUSY_POLL, options.busyPollTime, "SO_BUSY_POLL" ) && success;
+    }
+#endif
+#endif
+    LOG_FUNCTION_END();
+    return ( success );
+}
+
 #endif /* SOCKETBASE_H_ */
@@ -0,0 +1,161 @@
+/**
+ * @file SocketOptions.h
+ * Defines the SocketOptions class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef SOCKETOPTIONS_H_
+#define SOCKETOPTIONS_H_
+
+/**
+ *  @brief Options of a TCP socket, applied with SocketBase::SetOptions().
+
+    Every option has a value that leaves the OS setting unchanged, so a profile only touches the options it cares about. The profiles of the S2Sim ports are created by the static methods.
+ */
+class SocketOptions
+{
+    public:
+    /**
+     *  Defines the type of an option that is switched on or off.
+     */
+        typedef int TFlag;
+
+    /**
+     *  Defines the type of a size or time option.
+     */
+        typedef int TValue;
+
+    /**
+     *  Values of a flag option.
+     */
+        enum FlagValues
+        {
+            Unchanged = -1, /**< The option is not set. */
+            Disabled = 0, /**< The option is switched off. */
+            Enabled = 1 /**< The option is switched on. */
+        };
+
+    /**
+     *  Defines the sizes and times used by the profiles.
+     */
+        enum ProfileValues
+        {
+            LinkBufferSize = 0x100000, /**< Socket buffer size of the simulator links. */
+            KeepAliveIdleTime = 60, /**< Idle seconds before the first keepalive probe. */
+            KeepAliveInterval = 10, /**< Seconds between two keepalive probes. */
+            KeepAliveCount = 3 /**< Unanswered probes before the connection is dropped. */
+        };
+
+    public:
+    /**
+     *  Disables Nagle's algorithm, so small frames are sent without waiting for the acknowledgement of the previous ones.
+     */
+        TFlag noDelay;
+
+    /**
+     *  Acknowledges received data immediately instead of delaying the acknowledgement. The OS clears the option by itself, so it is renewed after every reception. Linux only.
+     */
+        TFlag quickAck;
+
+    /**
+     *  Sends keepalive probes on an idle connection, so a peer that disappeared is detected.
+     */
+        TFlag keepAlive;
+
+    /**
+     *  Idle seconds before the first keepalive probe, 0 for the OS default.
+     */
+        TValue keepAliveIdleTime;
+
+    /**
+     *  Seconds between two keepalive probes, 0 for the OS default.
+     */
+        TValue keepAliveInterval;
+
+    /**
+     *  Unanswered keepalive probes before the connection is dropped, 0 for the OS default.
+     */
+        TValue keepAliveCount;
+
+    /**
+     *  Size of the send buffer in bytes, 0 for the OS default. Setting it disables the automatic sizing of the OS.
+     */
+        TValue sendBufferSize;
+
+    /**
+     *  Size of the receive buffer in bytes, 0 for the OS default. Setting it disables the automatic sizing of the OS.
+     */
+        TValue receiveBufferSize;
+
+    /**
+     *  Microseconds a blocking reception polls the device queue before sleeping, 0 to leave it unchanged. Values above net.core.busy_poll need CAP_NET_ADMIN. Linux only.
+     */
+        TValue busyPollTime;
+
+    public:
+    /**
+     *  Creates options that leave every OS setting unchanged.
+     */
+        SocketOptions( void ) : noDelay( Unchanged ),
+                                quickAck( Unchanged ),
+                                keepAlive( Unchanged ),
+                                keepAliveIdleTime( 0 ),
+                                keepAliveInterval( 0 ),
+                                keepAliveCount( 0 ),
+                                sendBufferSize( 0 ),
+                                receiveBufferSize( 0 ),
+                                busyPollTime( 0 )
+        {
+        }
+
+    /**
+     *  Returns the profile of the client port. Clients exchange small messages once per time step, so their frames are sent immediately and dead clients are detected with keepalive. The buffers are sized by the OS, as there may be thousands of clients.
+     *
+     *  @return Options of the client connections.
+     */
+        static SocketOptions
+        GetClientProfile( void )
+        {
+            SocketOptions options;
+            options.noDelay = Enabled;
+            options.keepAlive = Enabled;
+            options.keepAliveIdleTime = KeepAliveIdleTime;
+            options.keepAliveInterval = KeepAliveInterval;
+            options.keepAliveCount = KeepAliveCount;
+            return ( options );
+        }
+
+    /**
+     *  Returns the profile of the OpenDSS port. Every request waits for its response, so neither side may delay a frame or its acknowledgement.
+     *
+     *  @param busyPollTime Busy poll time of the reception in microseconds, 0 for none.
+     *
+     *  @return Options of the OpenDSS connection.
+     */
+        static SocketOptions
+        GetSolverProfile( const TValue busyPollTime = 0 )
+        {
+            SocketOptions options = GetClientProfile();
+            options.quickAck = Enabled;
+            options.sendBufferSize = LinkBufferSize;
+            options.receiveBufferSize = LinkBufferSize;
+            options.busyPollTime = busyPollTime;
+            return ( options );
+        }
+
+    /**
+     *  Returns the profile of the controller port. The decision frames hold every client, so the buffers are larger, and the decisions are on the critical path of every time step.
+     *
+     *  @param busyPollTime Busy poll time of the reception in microseconds, 0 for none.
+     *
+     *  @return Options of the controller connection.
+     */
+        static SocketOptions
+        GetControllerProfile( const TValue busyPollTime = 0 )
+        {
+            return ( GetSolverProfile( busyPollTime ) );
+        }
+};
+
+#endif /* SOCKETOPTIONS_H_ */
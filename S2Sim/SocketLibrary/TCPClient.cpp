@@ -6,6 +6,7 @@
  */
 
 #include "TCPClient.h"
+#include <cstring>
 
 TCPClient::TCPClient( void )
 {
@@ -13,18 +14,38 @@ TCPClient::TCPClient( void )
 
 TCPClient::~TCPClient( void )
 {
+#if defined( __linux__ )
+    if ( !this->m_channel.IsNull() )
+    {
+        this->m_channel->Close();
+    }
+#endif
 }
 
 TCPClient::TNumberOfBytes
 TCPClient::SendData( const TBuffer buffer, const TNumberOfBytes length )
 {
+#if defined( __linux__ )
+    if ( !this->m_channel.IsNull() )
+    {
+        return ( this->m_channel->Write( buffer, length ) );
+    }
+#endif
     return ( send( this->m_socketId, buffer, length, 0 ) );
 }
 
 TCPClient::TNumberOfBytes
 TCPClient::ReceiveData( TBuffer buffer, const TNumberOfBytes receptionLength )
 {
-    return ( recv( this->m_socketId, buffer, receptionLength, 0 ) );
+#if defined( __linux__ )
+    if ( !this->m_channel.IsNull() )
+    {
+        return ( this->m_channel->Read( buffer, receptionLength ) );
+    }
+#endif
+    TNumberOfBytes receivedBytes = recv( this->m_socketId, buffer, receptionLength, 0 );
+    this->RenewQuickAck();
+    return ( receivedBytes );
 }
 
 bool
@@ -37,12 +58,54 @@ TCPClient::Connect( IPAddress & address )
     return ( true );
 }
 
+bool
+TCPClient::ConnectLocal( const std::string & path )
+{
+#if defined( __linux__ ) || defined ( __APPLE__ )
+    struct sockaddr_un address;
+    if ( path.size() >= sizeof( address.sun_path ) )
+    {
+        return ( false );
+    }
+    memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    memcpy( address.sun_path, path.c_str(), path.size() );
+
+    this->ReopenSocket( AF_UNIX );
+    if ( connect( this->m_socketId, ( struct sockaddr* )&address, sizeof( address ) ) < 0 )
+    {
+        return ( false );
+    }
+    return ( true );
+#else
+    return ( false );
+#endif
+}
+
+#if defined( __linux__ )
+bool
+TCPClient::ConnectSharedMemory( const std::string & name )
+{
+    auto channel = CreateObject<SharedMemoryChannel>();
+    if ( !channel->Open( name ) )
+    {
+        return ( false );
+    }
+    this->m_channel = channel;
+    return ( true );
+}
+#endif
+
 /*TCPClient::TCPClient( const TCPClient & copy ) : SocketBase<SOCK_STREAM>( copy )
 {
 }*/
 
 TCPClient::TCPClient( TCPClient && move ) : SocketBase<SOCK_STREAM>( std::move( move ) )
 {
+#if defined( __linux__ )
+    this->m_channel = move.m_channel;
+    move.m_channel.NullifyPointer();
+#endif
 }
 
 /*TCPClient &
@@ -8,11 +8,16 @@
 #ifndef TCPCLIENT_H_
 #define TCPCLIENT_H_
 
+#include <string>
 #include "SocketBase.h"
 #include "IPAddress.h"
+#include "SharedMemoryChannel.h"
+#include "SmartPointer.hpp"
 
 /**
  *  This class defines a TCP client that can connect to a TCP server and communicate. All OS related utilities are abstracted.
+
+    On Linux, the client can attach to a shared memory segment of a ThreadedSharedMemoryServer on the same host instead of connecting. Sending and receiving then go through the SharedMemoryChannel.
  */
 class TCPClient : public SocketBase<SOCK_STREAM>
 {
@@ -61,6 +66,28 @@ class TCPClient : public SocketBase<SOCK_STREAM>
         bool
         Connect( IPAddress & address );
 
+    /**
+     *  Connects to the Unix domain socket of a server on the same host instead of a TCP port. The socket is replaced, so the options must be set afterwards.
+     *
+     *  @param path File system path of the socket.
+     *
+     *  @return Success of the connection.
+     */
+        bool
+        ConnectLocal( const std::string & path );
+
+#if defined( __linux__ )
+    /**
+     *  Attaches to the shared memory segment of a server on the same host instead of a TCP connection.
+     *
+     *  @param name Name of the segment, starting with '/'.
+     *
+     *  @return false if no server waits for a client on the segment.
+     */
+        bool
+        ConnectSharedMemory( const std::string & name );
+#endif
+
     /**
      *  Sends data to the server.
      *
@@ -88,6 +115,14 @@ class TCPClient : public SocketBase<SOCK_STREAM>
      *  Defines the base type for rapid development.
      */
         typedef SocketBase<SOCK_STREAM> TBaseType;
+
+#if defined( __linux__ )
+    private:
+    /**
+     *  Shared memory channel replacing the socket, null for a TCP connection.
+     */
+        SmartPointer<SharedMemoryChannel> m_channel;
+#endif
 };
 
 #endif /* TCPCLIENT_H_ */
@@ -7,35 +7,279 @@
 
 #include "TCPConnectedClient.h"
 
+#if defined( __linux__ ) || defined ( __APPLE__ )
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <errno.h>
+#endif
+#if defined( __linux__ )
+#include "SendReactor.h"
+#endif
+
 TCPConnectedClient::TCPConnectedClient( const TSocketId socketId,
                                         const IPAddress& clientAddress ) : SocketBase<SOCK_STREAM>( socketId ),
-                                                                     m_clientAddress( clientAddress )
+                                                                     m_clientAddress( clientAddress ),
+                                                                     m_frontOffset( 0 ),
+                                                                     m_queuedBytes( 0 ),
+                                                                     m_maximumQueuedBytes( DefaultMaximumQueuedBytes ),
+                                                                     m_sendingStopped( false )
+{
+#if defined( __linux__ )
+    SendReactor::GetSendReactor().Add( this, this->m_socketId );
+#endif
+}
+
+#if defined( __linux__ )
+TCPConnectedClient::TCPConnectedClient( const SmartPointer<SharedMemoryChannel> & channel ) : SocketBase<SOCK_STREAM>( InvalidSocketId ),
+                                                                                            m_frontOffset( 0 ),
+                                                                                            m_queuedBytes( 0 ),
+                                                                                            m_maximumQueuedBytes( DefaultMaximumQueuedBytes ),
+                                                                                            m_sendingStopped( false ),
+                                                                                            m_channel( channel )
 {
 }
+#endif
 
 /*TCPConnectedClient::TCPConnectedClient( const TCPConnectedClient & copy ) : SocketBase<SOCK_STREAM>( copy ), m_clientAddress( copy.m_clientAddress )
 {
 }*/
 
-TCPConnectedClient::TCPConnectedClient( TCPConnectedClient && move ) : SocketBase<SOCK_STREAM>( std::move( move ) ), m_clientAddress( std::move( move.m_clientAddress ) )
+TCPConnectedClient::TCPConnectedClient( TCPConnectedClient && move ) : SocketBase<SOCK_STREAM>( std::move( move ) ),
+                                                                       m_clientAddress( std::move( move.m_clientAddress ) ),
+                                                                       m_frontOffset( 0 ),
+                                                                       m_queuedBytes( 0 ),
+                                                                       m_maximumQueuedBytes( move.m_maximumQueuedBytes ),
+                                                                       m_sendingStopped( false )
 {
+#if defined( __linux__ )
+    SendReactor::GetSendReactor().Remove( &move, this->m_socketId );
+#endif
+    {
+        std::lock_guard<std::mutex> lockGuard( move.m_sendLock );
+        this->m_outboundQueue = std::move( move.m_outboundQueue );
+        this->m_frontOffset = move.m_frontOffset;
+        this->m_queuedBytes = move.m_queuedBytes;
+        this->m_sendingStopped = move.m_sendingStopped;
+#if defined( __linux__ )
+        this->m_channel = move.m_channel;
+        move.m_channel = SmartPointer<SharedMemoryChannel>();
+#endif
+        move.m_outboundQueue.clear();
+        move.m_frontOffset = 0;
+        move.m_queuedBytes = 0;
+        move.m_sendingStopped = true;
+    }
+#if defined( __linux__ )
+    if ( this->m_channel.IsNull() )
+    {
+        SendReactor::GetSendReactor().Add( this, this->m_socketId );
+        std::lock_guard<std::mutex> lockGuard( this->m_sendLock );
+        if ( !this->m_outboundQueue.empty() && !SendReactor::GetSendReactor().Arm( this, this->m_socketId ) )
+        {
+            this->FailSending();
+        }
+    }
+#endif
 }
 
 TCPConnectedClient::~TCPConnectedClient( void )
 {
+    this->CloseOutboundQueue();
 }
 
 TCPConnectedClient::TNumberOfBytes
 TCPConnectedClient::SendData( const TBuffer buffer, const TNumberOfBytes length )
 {
-    return ( send( this->m_socketId, buffer, length, 0 ) );
+    std::lock_guard<std::mutex> lockGuard( this->m_sendLock );
+    if ( this->m_sendingStopped )
+    {
+        return ( 0 );
+    }
+#if defined( __linux__ )
+    if ( !this->m_channel.IsNull() )
+    {
+        return ( this->m_channel->Write( buffer, length ) );
+    }
+    TNumberOfBytes sentBytes = 0;
+    if ( this->m_outboundQueue.empty() )
+    {
+        ssize_t result = send( this->m_socketId, buffer, length, MSG_DONTWAIT | MSG_NOSIGNAL );
+        if ( result < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR )
+        {
+            SendReactor::GetSendReactor().CountFailure();
+            this->FailSending();
+            return ( 0 );
+        }
+        sentBytes = ( result < 0 ) ? 0 : ( TNumberOfBytes )result;
+        if ( sentBytes == length )
+        {
+            return ( length );
+        }
+    }
+
+    TNumberOfBytes remainingBytes = length - sentBytes;
+    if ( this->m_queuedBytes + remainingBytes > this->m_maximumQueuedBytes )
+    {
+        SendReactor::GetSendReactor().CountEviction();
+        this->FailSending();
+        return ( 0 );
+    }
+    bool wasEmpty = this->m_outboundQueue.empty();
+    this->m_outboundQueue.emplace_back( ( const char* )buffer + sentBytes, ( const char* )buffer + length );
+    this->m_queuedBytes += remainingBytes;
+    SendReactor::GetSendReactor().AddQueuedBytes( remainingBytes );
+    if ( wasEmpty && !SendReactor::GetSendReactor().Arm( this, this->m_socketId ) )
+    {
+        SendReactor::GetSendReactor().CountFailure();
+        this->FailSending();
+        return ( 0 );
+    }
+    return ( length );
+#else
+    TNumberOfBytes sentBytes = 0;
+    while ( sentBytes < length )
+    {
+        int result = send( this->m_socketId, ( const char* )buffer + sentBytes, length - sentBytes, 0 );
+        if ( result <= 0 )
+        {
+            this->FailSending();
+            return ( 0 );
+        }
+        sentBytes += result;
+    }
+    return ( length );
+#endif
+}
+
+void
+TCPConnectedClient::FlushOutboundQueue( void )
+{
+#if defined( __linux__ )
+    std::lock_guard<std::mutex> lockGuard( this->m_sendLock );
+    if ( this->m_sendingStopped || this->m_outboundQueue.empty() )
+    {
+        return;
+    }
+    struct iovec vectors[MaximumNumberOfVectors];
+    size_t numberOfVectors = 0;
+    for ( auto message = this->m_outboundQueue.begin(); message != this->m_outboundQueue.end() && numberOfVectors < MaximumNumberOfVectors; ++message, ++numberOfVectors )
+    {
+        TNumberOfBytes offset = ( numberOfVectors == 0 ) ? this->m_frontOffset : 0;
+        vectors[numberOfVectors].iov_base = message->data() + offset;
+        vectors[numberOfVectors].iov_len = message->size() - offset;
+    }
+    struct msghdr header = {};
+    header.msg_iov = vectors;
+    header.msg_iovlen = numberOfVectors;
+    ssize_t result = sendmsg( this->m_socketId, &header, MSG_DONTWAIT | MSG_NOSIGNAL );
+    if ( result < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR )
+    {
+        SendReactor::GetSendReactor().CountFailure();
+        this->FailSending();
+        return;
+    }
+
+    TNumberOfBytes sentBytes = ( result < 0 ) ? 0 : ( TNumberOfBytes )result;
+    this->m_queuedBytes -= sentBytes;
+    SendReactor::GetSendReactor().RemoveQueuedBytes( sentBytes );
+    while ( sentBytes > 0 )
+    {
+        TNumberOfBytes frontBytes = this->m_outboundQueue.front().size() - this->m_frontOffset;
+        if ( sentBytes < frontBytes )
+        {
+            this->m_frontOffset += sentBytes;
+            break;
+        }
+        sentBytes -= frontBytes;
+        this->m_outboundQueue.pop_front();
+        this->m_frontOffset = 0;
+    }
+    if ( !this->m_outboundQueue.empty() && !SendReactor::GetSendReactor().Arm( this, this->m_socketId ) )
+    {
+        SendReactor::GetSendReactor().CountFailure();
+        this->FailSending();
+    }
+#endif
+}
+
+void
+TCPConnectedClient::SetMaximumQueuedBytes( const TNumberOfBytes maximumQueuedBytes )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_sendLock );
+    this->m_maximumQueuedBytes = maximumQueuedBytes;
+}
+
+TCPConnectedClient::TNumberOfBytes
+TCPConnectedClient::GetQueuedBytes( void )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_sendLock );
+    return ( this->m_queuedBytes );
+}
+
+void
+TCPConnectedClient::FailSending( void )
+{
+    this->m_sendingStopped = true;
+#if defined( __linux__ )
+    SendReactor::GetSendReactor().RemoveQueuedBytes( this->m_queuedBytes );
+#endif
+    this->m_outboundQueue.clear();
+    this->m_frontOffset = 0;
+    this->m_queuedBytes = 0;
+    shutdown( this->m_socketId, SHUT_RDWR );
+}
+
+void
+TCPConnectedClient::CloseOutboundQueue( void )
+{
+#if defined( __linux__ )
+    SendReactor::GetSendReactor().Remove( this, this->m_socketId );
+#endif
+    std::lock_guard<std::mutex> lockGuard( this->m_sendLock );
+#if defined( __linux__ )
+    SendReactor::GetSendReactor().RemoveQueuedBytes( this->m_queuedBytes );
+#endif
+    this->m_sendingStopped = true;
+    this->m_outboundQueue.clear();
+    this->m_frontOffset = 0;
+    this->m_queuedBytes = 0;
 }
 
 TCPConnectedClient::TNumberOfBytes
 TCPConnectedClient::ReceiveData( TBuffer buffer,
                                  const TNumberOfBytes receptionLength)
 {
-    return ( recv( this->m_socketId, buffer, receptionLength, 0 ) );
+#if defined( __linux__ )
+    if ( !this->m_channel.IsNull() )
+    {
+        return ( this->m_channel->Read( buffer, receptionLength ) );
+    }
+#endif
+    TNumberOfBytes receivedBytes = recv( this->m_socketId, buffer, receptionLength, 0 );
+    this->RenewQuickAck();
+    return ( receivedBytes );
+}
+
+bool
+TCPConnectedClient::SetReceiveTimeout( const unsigned int milliseconds )
+{
+    struct timeval timeout;
+    timeout.tv_sec = milliseconds / 1000;
+    timeout.tv_usec = ( milliseconds % 1000 ) * 1000;
+    return ( setsockopt( this->m_socketId, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof( timeout ) ) == 0 );
+}
+
+bool
+TCPConnectedClient::Shutdown( void )
+{
+#if defined( __linux__ )
+    if ( !this->m_channel.IsNull() )
+    {
+        this->m_channel->Close();
+        return ( true );
+    }
+#endif
+    return ( shutdown( this->m_socketId, SHUT_RDWR ) == 0 );
 }
 
 IPAddress
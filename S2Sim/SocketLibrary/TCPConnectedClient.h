@@ -8,14 +8,33 @@
 #ifndef TCPCONNECTEDCLIENT_H_
 #define TCPCONNECTEDCLIENT_H_
 
+#include <deque>
+#include <mutex>
+#include <vector>
 #include "SocketBase.h"
 #include "IPAddress.h"
+#include "SharedMemoryChannel.h"
+#include "SmartPointer.hpp"
 
 /**
  *  Manages the connection to a connected client on the server side. When a client is accepted, an instance of the class is initialized to furthur maintain the connection.
+
+    Data is sent without blocking. What the socket does not take immediately is kept in a bounded outbound queue, which the SendReactor flushes when the socket becomes writable. A client that lets its queue grow over the limit is a slow consumer and its connection is shut down.
+
+    On Linux, the connection can be a SharedMemoryChannel to a process on the same host instead of a socket. Sending and receiving then go through the channel, and sending blocks while the ring of the channel is full.
  */
 class TCPConnectedClient : public SocketBase<SOCK_STREAM>
 {
+    public:
+    /**
+     *  Defines the outbound queue limits.
+     */
+        enum OutboundQueueValues
+        {
+            DefaultMaximumQueuedBytes = 0x4000000, /**< Default limit of the outbound queue, large enough for the simulator links. */
+            MaximumNumberOfVectors = 64 /**< Number of queued messages written by a single flush. */
+        };
+
     public:
     /**
      *  Initializes the class with a ready socket and address.
@@ -23,6 +42,14 @@ class TCPConnectedClient : public SocketBase<SOCK_STREAM>
         @param clientAddress IPAddress of the connected client.
      */
         TCPConnectedClient( const TSocketId socketId, const IPAddress & clientAddress );
+
+#if defined( __linux__ )
+    /**
+     *  Initializes the class with an attached shared memory channel instead of a socket.
+        @param channel Channel attached by the client.
+     */
+        TCPConnectedClient( const SmartPointer<SharedMemoryChannel> & channel );
+#endif
     
     /**
      *  Copies the contents of another instance.
@@ -31,7 +58,7 @@ class TCPConnectedClient : public SocketBase<SOCK_STREAM>
         TCPConnectedClient( const TCPConnectedClient & copy ) = delete;
     
     /**
-     *  Moves the contents of another instance.
+     *  Moves the contents of another instance, including its outbound queue.
         @param move Instance to be moved.
     */
         TCPConnectedClient( TCPConnectedClient && move );
@@ -42,16 +69,38 @@ class TCPConnectedClient : public SocketBase<SOCK_STREAM>
         ~TCPConnectedClient( void );
 
     /**
-     *  Sends data to the connected client.
+     *  Sends data to the connected client without blocking. The part the socket does not take is queued and sent in order by the SendReactor. If the queue would exceed its limit or the send fails, the connection is shut down, so the reception of the connection ends.
      *
      *  @param buffer Buffer, holding the data to be sent.
      *  @param length Length of the data to be sent.
      *
-     *  @return Actual number of bytes sent.
+     *  @return length if the data is sent or queued, 0 if the connection is broken or evicted.
      */
         TNumberOfBytes
         SendData( const TBuffer buffer, const TNumberOfBytes length );
 
+    /**
+     *  Sends as much of the outbound queue as the socket takes. Called by the SendReactor when the socket is writable.
+     */
+        void
+        FlushOutboundQueue( void );
+
+    /**
+     *  Sets the limit of the outbound queue.
+     *
+     *  @param maximumQueuedBytes Largest number of bytes waiting to be sent.
+     */
+        void
+        SetMaximumQueuedBytes( const TNumberOfBytes maximumQueuedBytes );
+
+    /**
+     *  Returns the number of bytes waiting to be sent.
+     *
+     *  @return Size of the outbound queue.
+     */
+        TNumberOfBytes
+        GetQueuedBytes( void );
+
     /**
      *  Receives data from the connected client. This is a blocking call.
      *
@@ -63,6 +112,24 @@ class TCPConnectedClient : public SocketBase<SOCK_STREAM>
         TNumberOfBytes
         ReceiveData( TBuffer buffer, const TNumberOfBytes receptionLength );
 
+    /**
+     *  Limits how long ReceiveData() waits for data.
+     *
+     *  @param milliseconds Longest wait, 0 waits without limit.
+     *
+     *  @return Success of setting the socket option.
+     */
+        bool
+        SetReceiveTimeout( const unsigned int milliseconds );
+
+    /**
+     *  Shuts the connection down in both directions. A blocked ReceiveData() call returns 0, as if the client closed the connection.
+     *
+     *  @return Success of the shutdown.
+     */
+        bool
+        Shutdown( void );
+
     /**
      *  Returns the IP address of the client.
      *
@@ -77,11 +144,62 @@ class TCPConnectedClient : public SocketBase<SOCK_STREAM>
      */
         typedef SocketBase<SOCK_STREAM> TBaseType;
 
+    protected:
+    /**
+     *  Drops the outbound queue and stops sending before the socket is closed, so the SendReactor does not use the socket afterwards.
+     */
+        void
+        CloseOutboundQueue( void );
+
+    private:
+    /**
+     *  Marks the connection as broken, drops the outbound queue and shuts the connection down. Called with m_sendLock held.
+     */
+        void
+        FailSending( void );
+
     private:
     /**
      *  IP Address of the client.
      */
         IPAddress m_clientAddress;
+
+    /**
+     *  Protects the outbound queue.
+     */
+        std::mutex m_sendLock;
+
+    /**
+     *  Messages waiting to be sent, in order.
+     */
+        std::deque<std::vector<char>> m_outboundQueue;
+
+    /**
+     *  Number of bytes of the first queued message already sent.
+     */
+        TNumberOfBytes m_frontOffset;
+
+    /**
+     *  Number of bytes waiting to be sent.
+     */
+        TNumberOfBytes m_queuedBytes;
+
+    /**
+     *  Limit of the outbound queue.
+     */
+        TNumberOfBytes m_maximumQueuedBytes;
+
+    /**
+     *  Indicates whether sending stopped after a failure, an eviction or closing the socket.
+     */
+        bool m_sendingStopped;
+
+#if defined( __linux__ )
+    /**
+     *  Shared memory channel replacing the socket, null for a socket connection.
+     */
+        SmartPointer<SharedMemoryChannel> m_channel;
+#endif
 };
 
 #endif /* TCPCONNECTEDCLIENT_H_ */
@@ -7,12 +7,23 @@
 
 #include "TCPServer.h"
 
-TCPServer::TCPServer( void )
+#include <cstring>
+#if defined( __linux__ )
+#include <netinet/tcp.h>
+#endif
+
+TCPServer::TCPServer( void ) : m_backlog( 1 ), m_connectionOptions()
 {
 }
 
 TCPServer::~TCPServer( void )
 {
+#if defined( __linux__ ) || defined ( __APPLE__ )
+    if ( !this->m_localPath.empty() )
+    {
+        unlink( this->m_localPath.c_str() );
+    }
+#endif
 }
 
 void
@@ -26,6 +37,47 @@ TCPServer::SetAddress( IPAddress& address )
     LOG_FUNCTION_END();
 }
 
+bool
+TCPServer::SetReusePort( void )
+{
+#if defined( __linux__ ) || defined ( __APPLE__ )
+    int value = 1;
+    if ( 0 != setsockopt( this->m_socketId, SOL_SOCKET, SO_REUSEPORT, &value, sizeof( value ) ) )
+    {
+        ErrorPrint( "Socket Option Not Set! Error: ", errno );
+        return ( false );
+    }
+    return ( true );
+#else
+    return ( false );
+#endif
+}
+
+bool
+TCPServer::SetConnectionOptions( const SocketOptions & options )
+{
+    this->m_connectionOptions = options;
+    return ( this->SetOptions( options ) );
+}
+
+bool
+TCPServer::GetAcceptBacklog( unsigned int & length, unsigned int & limit ) const
+{
+#if defined( __linux__ )
+    struct tcp_info information;
+    socklen_t informationSize = sizeof( information );
+    if ( getsockopt( this->m_socketId, IPPROTO_TCP, TCP_INFO, &information, &informationSize ) != 0 )
+    {
+        return ( false );
+    }
+    length = information.tcpi_unacked;
+    limit = information.tcpi_sacked;
+    return ( true );
+#else
+    return ( false );
+#endif
+}
+
 void
 TCPServer::SetPort( const IPAddress::TPort port )
 {
@@ -37,11 +89,45 @@ TCPServer::SetPort( const IPAddress::TPort port )
     this->SetAddress( address );
 }
 
+bool
+TCPServer::SetLocalPath( const std::string & path )
+{
+    LOG_FUNCTION_START();
+#if defined( __linux__ ) || defined ( __APPLE__ )
+    struct sockaddr_un address;
+    if ( path.size() >= sizeof( address.sun_path ) )
+    {
+        ErrorPrint( "Socket path too long: ", path );
+        LOG_FUNCTION_END();
+        return ( false );
+    }
+    memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    memcpy( address.sun_path, path.c_str(), path.size() );
+
+    this->ReopenSocket( AF_UNIX );
+    unlink( path.c_str() );
+    if ( -1 == bind( this->m_socketId, ( struct sockaddr* )&address, sizeof( address ) ) )
+    {
+        ErrorPrint( "Socket Bind failed! Error: ", errno );
+        LOG_FUNCTION_END();
+        return ( false );
+    }
+    this->m_localPath = path;
+    LOG_FUNCTION_END();
+    return ( true );
+#else
+    ErrorPrint( "Unix domain sockets not supported" );
+    LOG_FUNCTION_END();
+    return ( false );
+#endif
+}
+
 bool
 TCPServer::Listen( void )
 {
     LOG_FUNCTION_START();
-    if ( listen( this->m_socketId, 1 ) == 0 )
+    if ( listen( this->m_socketId, this->m_backlog ) == 0 )
     {
         LOG_FUNCTION_END();
         return ( true );
@@ -57,13 +143,18 @@ TCPServer::Accept( void )
     LOG_FUNCTION_START();
     IPAddress address;
     IPAddress::TSocketSize length = IPAddress::GetSocketSize();
-    TSocketId acceptedSocketId = accept( this->m_socketId, ( struct sockaddr* )address, &length );
+    TSocketId acceptedSocketId = ( this->m_localPath.empty() ? accept( this->m_socketId, ( struct sockaddr* )address, &length ) : accept( this->m_socketId, nullptr, nullptr ) );
     if ( acceptedSocketId <= 0 )
     {
         ErrorPrint( "Socket Accept failed! Error: ", errno );
         //class ERROR_SocketAcceptFailed{};
         //throw ( ERROR_SocketAcceptFailed() );
     }
+    auto client = CreateObject<ThreadedTCPConnectedClient>( acceptedSocketId, address );
+    if ( acceptedSocketId > 0 )
+    {
+        client->SetOptions( this->m_connectionOptions );
+    }
     LOG_FUNCTION_END();
-    return ( CreateObject<ThreadedTCPConnectedClient>( acceptedSocketId, address ) );
+    return ( client );
 }
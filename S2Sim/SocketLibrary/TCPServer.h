@@ -8,6 +8,7 @@
 #ifndef TCPSERVER_H_
 #define TCPSERVER_H_
 
+#include <string>
 #include "SocketBase.h"
 #include "IPAddress.h"
 #include "ThreadedTCPConnectedClient.h"
@@ -15,7 +16,7 @@
 #include "SmartPointer.hpp"
 
 /**
- *  Defines a TCP server that can listen to connection attempts and can accept them for communication.
+ *  Defines a TCP server that can listen to connection attempts and can accept them for communication. The server can listen to a Unix domain socket instead of a port, which serves the processes on the same host without the TCP stack.
  */
 class TCPServer : public SocketBase<SOCK_STREAM>
 {
@@ -26,7 +27,7 @@ class TCPServer : public SocketBase<SOCK_STREAM>
         TCPServer( void );
     
     /**
-     *  Not used.
+     *  Removes the path of the Unix domain socket if it is set.
      */
         ~TCPServer( void );
     
@@ -40,6 +41,46 @@ class TCPServer : public SocketBase<SOCK_STREAM>
         TCPServer &
         operator = ( TCPServer && ) = delete;
 
+    /**
+     *  Allows other sockets to listen to the same port, which must be called before setting the port. The connections are distributed among the listening sockets by the OS.
+     *
+     *  @return Success of setting the socket option.
+     */
+        bool
+        SetReusePort( void );
+
+    /**
+     *  Sets the number of established connections the OS keeps until they are accepted. Must be called before TCPServer::Listen().
+     *
+     *  @param backlog Length of the accept queue.
+     */
+        void
+        SetBacklog( const int backlog )
+        {
+            this->m_backlog = backlog;
+        }
+
+    /**
+     *  Sets the options of the accepted connections. They are applied to the listening socket as well, since the buffer sizes must be known before the connection is established. Should be called before TCPServer::Listen().
+     *
+     *  @param options Options of the accepted connections.
+     *
+     *  @return false if an option could not be set on the listening socket.
+     */
+        bool
+        SetConnectionOptions( const SocketOptions & options );
+
+    /**
+     *  Reads the current length of the accept queue from the OS.
+     *
+     *  @param length Number of established connections waiting to be accepted.
+     *  @param limit  Length of the accept queue.
+     *
+     *  @return false if the OS does not report the accept queue.
+     */
+        bool
+        GetAcceptBacklog( unsigned int & length, unsigned int & limit ) const;
+
     /**
      *  Sets the IP address of the server. This method is not recommended as the IP address of the computer is mostly set, while only the port number is required. If you are not sure, use TCPServer::SetPort() instead.
      *
@@ -56,6 +97,16 @@ class TCPServer : public SocketBase<SOCK_STREAM>
         void
         SetPort( const IPAddress::TPort port );
 
+    /**
+     *  Replaces the socket with a Unix domain socket bound to the path. A file left at the path by a previous run is removed. Must be called instead of TCPServer::SetPort() and before any other setting.
+     *
+     *  @param path File system path of the socket.
+     *
+     *  @return Success of the binding.
+     */
+        bool
+        SetLocalPath( const std::string & path );
+
     /**
      *  This method makes the server listen to incoming connection attempts.
      *
@@ -77,6 +128,22 @@ class TCPServer : public SocketBase<SOCK_STREAM>
      *  Defines the type of the base class for rapid development.
      */
         typedef SocketBase<SOCK_STREAM> TBaseType;
+
+    private:
+    /**
+     *  Length of the accept queue.
+     */
+        int m_backlog;
+
+    /**
+     *  Options applied to every accepted connection.
+     */
+        SocketOptions m_connectionOptions;
+
+    /**
+     *  Path of the Unix domain socket, empty for a TCP server.
+     */
+        std::string m_localPath;
 };
 
 #endif /* TCPSERVER_H_ */
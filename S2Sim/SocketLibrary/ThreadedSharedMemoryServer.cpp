@@ -0,0 +1,69 @@
+/**
+ * @file ThreadedSharedMemoryServer.cpp
+ * Implements the ThreadedSharedMemoryServer class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "ThreadedSharedMemoryServer.h"
+
+#if defined( __linux__ )
+
+ThreadedSharedMemoryServer::ThreadedSharedMemoryServer( void ) : m_started( false ),
+                                                                 m_capacity( SharedMemoryChannel::DefaultCapacity )
+{
+}
+
+ThreadedSharedMemoryServer::~ThreadedSharedMemoryServer( void )
+{
+    this->m_started = false;
+}
+
+void
+ThreadedSharedMemoryServer::ExecutionBody( void )
+{
+    while ( this->m_started )
+    {
+        auto channel = CreateObject<SharedMemoryChannel>();
+        if ( !channel->Create( this->m_name, this->m_capacity ) )
+        {
+            ErrorPrint( "Shared memory segment ", this->m_name, " cannot be created! Error: ", errno );
+            break;
+        }
+        if ( !channel->WaitForPeer() )
+        {
+            continue;
+        }
+        LogPrint( "Client attached to shared memory segment ", this->m_name );
+        ( *this->m_notification )( CreateObject<ThreadedTCPConnectedClient>( channel ) );
+        channel->WaitUntilClosed();
+        LogPrint( "Shared memory channel ", this->m_name, " closed" );
+    }
+}
+
+void
+ThreadedSharedMemoryServer::SetName( const std::string & name, const SharedMemoryChannel::TNumberOfBytes capacity )
+{
+    this->m_name = name;
+    this->m_capacity = capacity;
+}
+
+void
+ThreadedSharedMemoryServer::SetNotificationCallback( TNotification && notification )
+{
+    LOG_FUNCTION_START();
+    if ( !this->m_notification.IsNull() && this->m_started )
+    {
+        ErrorPrint( "Multiple notification callbacks not allowed" );
+    }
+    this->m_notification = std::move( notification );
+    if ( !this->m_notification.IsNull() )
+    {
+        this->m_started = true;
+        this->m_thread = std::thread( &ThreadedSharedMemoryServer::ExecutionBody, this );
+        this->m_thread.detach();
+    }
+    LOG_FUNCTION_END();
+}
+
+#endif
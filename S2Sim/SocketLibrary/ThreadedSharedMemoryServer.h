@@ -0,0 +1,100 @@
+/**
+ * @file ThreadedSharedMemoryServer.h
+ * Defines the ThreadedSharedMemoryServer class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef THREADEDSHAREDMEMORYSERVER_H_
+#define THREADEDSHAREDMEMORYSERVER_H_
+
+#if defined( __linux__ )
+
+#include <string>
+#include <thread>
+#include "ThreadedTCPServer.h"
+#include "SharedMemoryChannel.h"
+
+/**
+ *  @brief Accepts a single client at a time through a shared memory segment in a background thread, the shared memory counterpart of ThreadedTCPServer.
+
+    The thread creates the segment and waits for a client to attach. The attached channel is given to the notification callback as a ThreadedTCPConnectedClient, so the user handles it like an accepted TCP connection. When the channel is closed, a new segment is created for the next client.
+ */
+class ThreadedSharedMemoryServer
+{
+    public:
+    /**
+     *  Defines the type of the callback notification function, the same as of ThreadedTCPServer.
+     */
+        typedef ThreadedTCPServer::TNotification TNotification;
+
+    private:
+    /**
+     *  The execution body of the thread. Creates the segments and notifies the attached clients.
+     */
+        void
+        ExecutionBody( void );
+
+    private:
+    /**
+     *  Thread object.
+     */
+        std::thread m_thread;
+
+    /**
+     *  Callback function.
+     */
+        TNotification m_notification;
+
+    /**
+     *  Indicates whether the thread is running.
+     */
+        bool m_started;
+
+    /**
+     *  Name of the segment.
+     */
+        std::string m_name;
+
+    /**
+     *  Size of each ring of the channel.
+     */
+        SharedMemoryChannel::TNumberOfBytes m_capacity;
+
+    public:
+    /**
+     *  Initializes the variables.
+     */
+        ThreadedSharedMemoryServer( void );
+
+    /**
+     *  Stops the execution of the thread.
+     */
+        ~ThreadedSharedMemoryServer( void );
+
+        ThreadedSharedMemoryServer( const ThreadedSharedMemoryServer & ) = delete;
+
+        ThreadedSharedMemoryServer&
+        operator = ( const ThreadedSharedMemoryServer & ) = delete;
+
+    /**
+     *  Sets the name of the segment. Must be called before the notification callback is set.
+     *
+     *  @param name     Name of the segment, starting with '/'.
+     *  @param capacity Size of each ring of the channel.
+     */
+        void
+        SetName( const std::string & name, const SharedMemoryChannel::TNumberOfBytes capacity = SharedMemoryChannel::DefaultCapacity );
+
+    /**
+     *  Sets the notification callback. If the notification callback function is legit, the thread is started. This function can be set only once.
+     *
+     *  @param notification Callback to the notification function.
+     */
+        void
+        SetNotificationCallback( TNotification && notification );
+};
+
+#endif
+
+#endif /* THREADEDSHAREDMEMORYSERVER_H_ */
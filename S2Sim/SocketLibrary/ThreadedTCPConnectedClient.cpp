@@ -8,15 +8,25 @@
 #include "ThreadedTCPConnectedClient.h"
 
 ThreadedTCPConnectedClient::ThreadedTCPConnectedClient( const TSocketId socketId, const IPAddress & clientAddress ) : TCPConnectedClient( socketId, clientAddress ),
-                                                                                                                      m_started( true )
+                                                                                                                      m_started( true ),
+                                                                                                                      m_threadStarted( false )
 {
     LOG_FUNCTION_START();
     this->m_allowingMutex.lock();
-    this->m_thread = std::thread( &ThreadedTCPConnectedClient::ExecutionBody, this );
-    this->m_thread.detach();
     LOG_FUNCTION_END();
 }
 
+#if defined( __linux__ )
+ThreadedTCPConnectedClient::ThreadedTCPConnectedClient( const SmartPointer<SharedMemoryChannel> & channel ) : TCPConnectedClient( channel ),
+                                                                                                            m_started( true ),
+                                                                                                            m_threadStarted( false )
+{
+    LOG_FUNCTION_START();
+    this->m_allowingMutex.lock();
+    LOG_FUNCTION_END();
+}
+#endif
+
 ThreadedTCPConnectedClient::~ThreadedTCPConnectedClient( void )
 {
     LOG_FUNCTION_START();
@@ -31,6 +41,10 @@ ThreadedTCPConnectedClient::ExecutionBody( void )
     while ( this->m_started )
     {
         this->m_allowingMutex.lock();
+        if ( !this->m_started )
+        {
+            break;
+        }
         const TNumberOfBytes bufferSize = 10000;
         char buffer[bufferSize];
         memset( buffer, 0x00, bufferSize );
@@ -76,6 +90,12 @@ ThreadedTCPConnectedClient::SetNotificationCallback( TNotification && notificati
         {
             this->m_notification = std::move( notification );
             this->m_allowingMutex.unlock();
+            if ( !this->m_threadStarted && this->m_started )
+            {
+                this->m_threadStarted = true;
+                this->m_thread = std::thread( &ThreadedTCPConnectedClient::ExecutionBody, this );
+                this->m_thread.detach();
+            }
         }
         else
         {
@@ -94,8 +114,19 @@ ThreadedTCPConnectedClient::StopThread( const SmartPointer<ThreadedTCPConnectedC
     LOG_FUNCTION_START();
     this->m_deathMutex.lock();
     this->m_myselfBeforeDeath = myself;
+    this->CloseOutboundQueue();
+    this->Shutdown();
     this->ForceCloseSocket();
     this->m_started = false;
+    if ( this->m_notification.IsNull() )
+    {
+        this->m_allowingMutex.unlock();
+    }
     this->m_notification.NullifyPointer();
+    if ( !this->m_threadStarted )
+    {
+        this->m_myselfBeforeDeath.NullifyPointer();
+        this->m_deathMutex.unlock();
+    }
     LOG_FUNCTION_END();
 }
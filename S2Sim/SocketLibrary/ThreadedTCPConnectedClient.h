@@ -15,7 +15,7 @@
 #include "FunctionPointer.hpp"
 
 /**
- *  Manages the connection to an accepted client on the server side and receives data in a separate thread in the background.
+ *  Manages the connection to an accepted client on the server side and receives data in a separate thread in the background. The thread is started when the first notification callback is set, so a connection that is closed before, e.g. during its handshake, never gets a thread.
  */
 class ThreadedTCPConnectedClient : public TCPConnectedClient
 {
@@ -49,6 +49,11 @@ class ThreadedTCPConnectedClient : public TCPConnectedClient
          *  Boolean variable to stop the thread.
          */
         bool m_started;
+
+        /**
+         *  Indicates whether the reception thread was started.
+         */
+        bool m_threadStarted;
         
         /**
          *  This mutex is unlocked only if there is a legitimate callback function.
@@ -61,11 +66,19 @@ class ThreadedTCPConnectedClient : public TCPConnectedClient
 
     public:
     /**
-     *  Initializes the class with a ready socket and address, and starts the reception thread.
+     *  Initializes the class with a ready socket and address.
         @param socketId Handle to the socket.
         @param clientAddress IPAddress of the connected client.
      */
         ThreadedTCPConnectedClient( const TSocketId socketId, const IPAddress & clientAddress );
+
+#if defined( __linux__ )
+    /**
+     *  Initializes the class with an attached shared memory channel instead of a socket.
+        @param channel Channel attached by the client.
+     */
+        ThreadedTCPConnectedClient( const SmartPointer<SharedMemoryChannel> & channel );
+#endif
     
     /**
      *  Copies the TCP connection information and starts a new thread.
@@ -80,7 +93,7 @@ class ThreadedTCPConnectedClient : public TCPConnectedClient
         ~ThreadedTCPConnectedClient( void );
 
     /**
-     *  Sets the notification callback function. If the mutex was already released, it is taken back. If the new callback is legit, it is released again.
+     *  Sets the notification callback function. If the mutex was already released, it is taken back. If the new callback is legit, it is released again, and the reception thread is started if it is not running yet.
      *
      *  @param notification Notification callback function.
      */
@@ -88,7 +101,7 @@ class ThreadedTCPConnectedClient : public TCPConnectedClient
         SetNotificationCallback( TNotification && notification );
     
     /**
-     *  Stops the thread at the earliest time possible.
+     *  Stops the thread at the earliest time possible. The connection is shut down, so the peer sees it closed. A connection without a started thread is closed at once.
      */
         void
         StopThread( const SmartPointer<ThreadedTCPConnectedClient> & myself );
@@ -6,6 +6,8 @@
  */
 
 #include "UDPSocket.h"
+#include <vector>
+#include <cstring>
 
 UDPSocket::UDPSocket( void )
 {
@@ -28,6 +30,48 @@ UDPSocket::ReceiveData( TBuffer buffer, const TNumberOfBytes receptionLength, IP
     return ( recvfrom( this->m_socketId, buffer, receptionLength, 0, ( struct sockaddr* )destinationAddress, &socketSize ) );
 }
 
+UDPSocket::TNumberOfMessages
+UDPSocket::ReceiveMessages( TBuffer buffer, const TNumberOfBytes messageLength, TNumberOfBytes* lengths, IPAddress* sourceAddresses, const TNumberOfMessages numberOfMessages )
+{
+#if defined( __linux__ )
+    std::vector<struct mmsghdr> messages( numberOfMessages );
+    std::vector<struct iovec> vectors( numberOfMessages );
+    for ( TNumberOfMessages messageIndex = 0; messageIndex < numberOfMessages; ++messageIndex )
+    {
+        vectors[messageIndex].iov_base = ( char* )buffer + messageIndex * messageLength;
+        vectors[messageIndex].iov_len = messageLength;
+        memset( &messages[messageIndex].msg_hdr, 0, sizeof( messages[messageIndex].msg_hdr ) );
+        messages[messageIndex].msg_hdr.msg_iov = &vectors[messageIndex];
+        messages[messageIndex].msg_hdr.msg_iovlen = 1;
+        messages[messageIndex].msg_hdr.msg_name = ( struct sockaddr* )sourceAddresses[messageIndex];
+        messages[messageIndex].msg_hdr.msg_namelen = IPAddress::GetSocketSize();
+    }
+    int numberOfReceived = recvmmsg( this->m_socketId, messages.data(), numberOfMessages, MSG_WAITFORONE, nullptr );
+    if ( numberOfReceived <= 0 )
+    {
+        return ( 0 );
+    }
+    for ( int messageIndex = 0; messageIndex < numberOfReceived; ++messageIndex )
+    {
+        lengths[messageIndex] = ( ( messages[messageIndex].msg_hdr.msg_flags & MSG_TRUNC ) != 0 ) ? 0 : messages[messageIndex].msg_len;
+    }
+    return ( ( TNumberOfMessages )numberOfReceived );
+#else
+    if ( numberOfMessages == 0 )
+    {
+        return ( 0 );
+    }
+    IPAddress::TSocketSize socketSize = IPAddress::GetSocketSize();
+    ssize_t receivedBytes = recvfrom( this->m_socketId, buffer, messageLength, 0, ( struct sockaddr* )sourceAddresses[0], &socketSize );
+    if ( receivedBytes < 0 )
+    {
+        return ( 0 );
+    }
+    lengths[0] = ( TNumberOfBytes )receivedBytes;
+    return ( 1 );
+#endif
+}
+
 void
 UDPSocket::SetIPAddress( IPAddress & address )
 {
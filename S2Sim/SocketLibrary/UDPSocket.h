@@ -17,6 +17,21 @@
 class UDPSocket : private SocketBase<SOCK_DGRAM>
 {
     public:
+    /**
+     *  Defines the type for a number of datagrams.
+     */
+        typedef unsigned int TNumberOfMessages;
+
+    /**
+     *  Redefines the type for number of bytes, as the base class is private.
+     */
+        typedef SocketBase<SOCK_DGRAM>::TNumberOfBytes TNumberOfBytes;
+
+    /**
+     *  Redefines the type for a buffer pointer, as the base class is private.
+     */
+        typedef SocketBase<SOCK_DGRAM>::TBuffer TBuffer;
+
     /**
      *  Not used.
      */
@@ -67,6 +82,33 @@ class UDPSocket : private SocketBase<SOCK_DGRAM>
         TNumberOfBytes
         ReceiveData( TBuffer buffer, const TNumberOfBytes receptionLength, IPAddress & destinationAddress );
 
+    /**
+     *  Receives a batch of datagrams with a single system call where the OS supports it, one datagram per call otherwise. Blocks until the first datagram arrives and returns the ones already waiting after it.
+     *
+     *  @param buffer           Buffer of numberOfMessages consecutive slots of messageLength bytes.
+     *  @param messageLength    Length of a slot.
+     *  @param lengths          Receives the length of each datagram, 0 for a datagram longer than a slot.
+     *  @param sourceAddresses  Receives the IP address each datagram was sent from.
+     *  @param numberOfMessages Number of slots.
+     *
+     *  @return Number of received datagrams, 0 on error.
+     */
+        TNumberOfMessages
+        ReceiveMessages( TBuffer buffer, const TNumberOfBytes messageLength, TNumberOfBytes* lengths, IPAddress* sourceAddresses, const TNumberOfMessages numberOfMessages );
+
+    /**
+     *  Sets the size of the receive buffer, which holds the datagrams arriving while the previous batch is processed.
+     *
+     *  @param size Size of the buffer in bytes.
+     *
+     *  @return Success of setting the option.
+     */
+        bool
+        SetReceiveBufferSize( const int size )
+        {
+            return ( this->SetIntegerOption( SOL_SOCKET, SO_RCVBUF, size, "SO_RCVBUF" ) );
+        }
+
     private:
     /**
      *  Defines the base class for rapid development.
@@ -6,6 +6,8 @@
  */
 
 #include "SystemManager.h"
+#include <cmath>
+#include <algorithm>
 
 using namespace TerraSwarm;
 
@@ -17,11 +19,17 @@ GetSystemManager( void )
 }
 
 SystemManager::SystemManager( void ) : m_systemTime( 0 ),
-                                       m_systemTimeStep( 1 )
+                                       m_systemTimeStep( 1 ),
+                                       m_waitStartTime( TClock::now() ),
+                                       m_numberOfReports( 0 ),
+                                       m_awaitedReports( 0 ),
+                                       m_substituteStragglers( false ),
+                                       m_pipelined( false ),
+                                       m_decisionPending( false ),
+                                       m_checkpointInterval( 0 )
 {
     LOG_FUNCTION_START();
     this->SetSystemMode( SimulationMode );
-    this->m_clientTimedMutex.lock();
     LOG_FUNCTION_END();
 }
 
@@ -29,44 +37,130 @@ void
 SystemManager::RegisterData( const TClientId clientId,
                              const TSystemTime startTime,
                              const TSystemTime resolution,
-                             const TNumberOfDataPoints numberOfDataPoints,
-                             const SmartPointer<TDataPoint> & dataPoints )
+                             const TDataPointView & dataPoints )
 {
     LOG_FUNCTION_START();
+    TNumberOfDataPoints numberOfDataPoints = dataPoints.GetNumberOfElements();
     LogPrint( "Registering Client ", clientId, "'s ", numberOfDataPoints, " data points. Staring at ", startTime, " with resolution: ", resolution );
-    TSystemTime endTime = startTime + resolution * numberOfDataPoints;
-    if ( endTime < this->m_systemTime )
+    if ( resolution == 0 )
     {
-        WarningPrint( "Outdated data received. Current Time: ", this->m_systemTime, " Data End Time: ", endTime );
+        WarningPrint( "Data with zero resolution received from Client ", clientId );
+        LOG_FUNCTION_END();
         return;
     }
 
-    TSystemTime realStartTime = std::max( startTime, this->m_systemTime );
-    LogPrint( "Registering from start time: ", realStartTime );
+    std::vector<TDataPoint> hostDataPoints( numberOfDataPoints );
+    dataPoints.CopyToHost( hostDataPoints.data() );
+    ConsumptionTrace trace( startTime, resolution );
+    trace.Store( hostDataPoints.data(), numberOfDataPoints );
+    this->AddTrace( clientId, std::move( trace ) );
+    LOG_FUNCTION_END();
+}
+
+bool
+SystemManager::RegisterCompressedData( const TClientId clientId,
+                                       const TSystemTime startTime,
+                                       const TSystemTime resolution,
+                                       const TNumberOfDataPoints numberOfDataPoints,
+                                       const void* encodedData,
+                                       const TDataSize encodedSize )
+{
+    LOG_FUNCTION_START();
+    LogPrint( "Registering Client ", clientId, "'s compressed ", numberOfDataPoints, " data points in ", encodedSize, " bytes. Starting at ", startTime, " with resolution: ", resolution );
+    if ( resolution == 0 )
+    {
+        WarningPrint( "Compressed data with zero resolution received from Client ", clientId );
+        LOG_FUNCTION_END();
+        return ( false );
+    }
+    ConsumptionTrace trace( startTime, resolution );
+    if ( !trace.Load( encodedData, encodedSize, numberOfDataPoints ) )
+    {
+        LOG_FUNCTION_END();
+        return ( false );
+    }
+    this->AddTrace( clientId, std::move( trace ) );
+    LOG_FUNCTION_END();
+    return ( true );
+}
+
+void
+SystemManager::AddTrace( const TClientId clientId, ConsumptionTrace && trace )
+{
+    LogPrint( "Storing trace of Client ", clientId, " until ", trace.GetEndTime(), " in ", trace.GetMemorySize(), " bytes" );
     this->m_systemDataLock.lock();
-    for ( TSystemTime currentTime = realStartTime; currentTime < endTime; ++currentTime )
+    TSystemTime systemTime = this->m_systemTime;
+    if ( trace.GetEndTime() < systemTime )
     {
-        this->m_systemMap[currentTime][clientId].realConsumption = dataPoints[(currentTime - startTime)/resolution];
-        this->m_systemMap[currentTime][clientId].numberOfDataPoints = 1;
+        this->m_systemDataLock.unlock();
+        WarningPrint( "Outdated data received. Current Time: ", systemTime, " Data End Time: ", trace.GetEndTime() );
+        return;
     }
+    this->m_traceMap[clientId].push_back( std::move( trace ) );
     this->m_systemDataLock.unlock();
-    LOG_FUNCTION_END();
+}
+
+void
+SystemManager::ResolveTraces( const TSystemTime time, TDataMap & dataMap )
+{
+    TTraceMap::iterator client = this->m_traceMap.begin();
+    while ( client != this->m_traceMap.end() )
+    {
+        TTraceList & traces = client->second;
+        for ( TTraceList::iterator trace = traces.begin(); trace != traces.end(); )
+        {
+            if ( trace->GetEndTime() <= this->m_systemTime )
+            {
+                trace = traces.erase( trace );
+            }
+            else
+            {
+                ++trace;
+            }
+        }
+
+        for ( TTraceList::reverse_iterator trace = traces.rbegin(); trace != traces.rend(); ++trace )
+        {
+            if ( trace->Covers( time ) )
+            {
+                ClientInformation & information = dataMap[client->first];
+                information.realConsumption = trace->GetDataPoint( time );
+                information.predictedConsumption = information.realConsumption;
+                information.fractionalBits = 0;
+                information.numberOfDataPoints = 1;
+                information.predicted = true;
+                break;
+            }
+        }
+
+        if ( traces.empty() )
+        {
+            client = this->m_traceMap.erase( client );
+        }
+        else
+        {
+            ++client;
+        }
+    }
 }
 
 void
 SystemManager::RegisterData( const TClientId clientId,
-                             TDataPoint dataPoint )
+                             TDataPoint dataPoint,
+                             const TFractionalBits fractionalBits )
 {
     LOG_FUNCTION_START();
-    LogPrint( "Registering Synchronous Data for Client ", clientId, " as: ", dataPoint, " time: ", this->m_systemTime );
+    LogPrint( "Registering Synchronous Data for Client ", clientId, " as: ", dataPoint, " with ", fractionalBits, " fractional bits, time: ", this->m_systemTime );
     this->m_systemDataLock.lock();
+    this->m_systemMap[this->m_systemTime][clientId].SetFractionalBits( fractionalBits );
     this->m_systemMap[this->m_systemTime][clientId].realConsumption = dataPoint;
     this->m_systemMap[this->m_systemTime][clientId].numberOfDataPoints = 1;
+    bool quorumReached = this->CountReport( this->m_systemMap[this->m_systemTime][clientId] );
     this->m_systemDataLock.unlock();
     
-    if ( this->m_systemMap[this->m_systemTime].size() == ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber() )
+    if ( quorumReached )
     {
-        this->m_clientTimedMutex.unlock();
+        this->m_reportCondition.notify_one();
     }
     
     LOG_FUNCTION_END();
@@ -74,48 +168,269 @@ SystemManager::RegisterData( const TClientId clientId,
 
 void
 SystemManager::RegisterData( const TClientId clientId,
-                             const TNumberOfDataPoints numberOfDataPoints,
-                             const SmartPointer<TDataPoint> &  dataPoints )
+                             const TDataPointView & dataPoints,
+                             const TFractionalBits fractionalBits )
 {
     LOG_FUNCTION_START();
+    TNumberOfDataPoints numberOfDataPoints = dataPoints.GetNumberOfElements();
     LogPrint( "Registering Synchronous Extended Data for Client ", clientId, " N: ", numberOfDataPoints );
+    TDataPoint realConsumption = dataPoints[0];
     this->m_systemDataLock.lock();
-    this->m_systemMap[this->m_systemTime][clientId].realConsumption = dataPoints[0];
+    this->m_systemMap[this->m_systemTime][clientId].SetFractionalBits( fractionalBits );
+    this->m_systemMap[this->m_systemTime][clientId].realConsumption = realConsumption;
     this->m_systemMap[this->m_systemTime][clientId].numberOfDataPoints = numberOfDataPoints;
     
     /* Set the predictions and the receeding horizons. */
     TSystemTime selectedTime = this->m_systemTime + 1;
     for ( TDataPoint timeIndex = 1; timeIndex < numberOfDataPoints; ++timeIndex )
     {
-        this->m_systemMap[selectedTime][clientId].realConsumption = dataPoints[0];
+        this->m_systemMap[selectedTime][clientId].fractionalBits = fractionalBits;
+        this->m_systemMap[selectedTime][clientId].realConsumption = realConsumption;
         this->m_systemMap[selectedTime][clientId].predictedConsumption = dataPoints[timeIndex];
+        this->m_systemMap[selectedTime][clientId].predicted = true;
         this->m_systemMap[selectedTime][clientId].numberOfDataPoints = numberOfDataPoints - timeIndex;
         ++selectedTime;
     }
+    bool quorumReached = this->CountReport( this->m_systemMap[this->m_systemTime][clientId] );
+    this->m_systemDataLock.unlock();
+    
+    if ( quorumReached )
+    {
+        this->m_reportCondition.notify_one();
+    }
+    
+    LOG_FUNCTION_END();
+}
+
+void
+SystemManager::RemoveSynchronousClient( void )
+{
+    this->m_systemDataLock.lock();
+    ClientNumberManager::GetClientNumberManager().RemoveSynchronousClient();
+    ClientNumberManager::TClientNumber numberOfClients = ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber();
+    bool waiting = ( this->m_awaitedReports > 0 );
+    this->m_awaitedReports = std::min( this->m_awaitedReports, numberOfClients );
     this->m_systemDataLock.unlock();
     
-    if ( this->m_systemMap[this->m_systemTime].size() == ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber() )
+    if ( waiting )
+    {
+        this->m_reportCondition.notify_one();
+    }
+}
+
+bool
+SystemManager::CountReport( ClientInformation & information )
+{
+    if ( information.reported )
+    {
+        return ( false );
+    }
+    information.reported = true;
+    ++this->m_numberOfReports;
+    this->m_arrivalTimes.push_back( TClock::now() );
+    return ( this->m_awaitedReports > 0 && this->m_numberOfReports >= this->m_awaitedReports );
+}
+
+void
+SystemManager::WaitForClients( void )
+{
+    LOG_FUNCTION_START();
+    std::unique_lock<std::mutex> lockGuard( this->m_systemDataLock );
+    TClock::time_point deadline = this->m_waitStartTime + this->m_clientTimeout;
+    for ( TQuorumList::const_iterator quorum = this->m_decisionQuorums.begin(); quorum != this->m_decisionQuorums.end(); ++quorum )
     {
-        this->m_clientTimedMutex.unlock();
+        ClientNumberManager::TClientNumber numberOfClients = ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber();
+        ClientNumberManager::TClientNumber quorumSize = ( ClientNumberManager::TClientNumber )std::ceil( *quorum * numberOfClients );
+        if ( quorumSize == 0 )
+        {
+            continue;
+        }
+        if ( quorumSize >= numberOfClients )
+        {
+            break;
+        }
+        this->m_awaitedReports = quorumSize;
+        if ( !this->m_reportCondition.wait_until( lockGuard, deadline, [this]() { return ( this->m_numberOfReports >= this->m_awaitedReports ); } ) )
+        {
+            break;
+        }
+        
+        std::vector<TClientId> clientIds;
+        TDataMap & dataMap = this->m_systemMap[this->m_systemTime];
+        for ( TDataMap::const_iterator client = dataMap.begin(); client != dataMap.end(); ++client )
+        {
+            if ( client->second.reported )
+            {
+                clientIds.push_back( client->first );
+            }
+        }
+        if ( clientIds.size() >= ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber() )
+        {
+            break;
+        }
+        LogPrint( "Quorum ", *quorum, " reached, partial decision for ", clientIds.size(), " clients" );
+        lockGuard.unlock();
+        this->BeginArchiveTick();
+        GetControlManager()->MakePartialDecision( clientIds );
+        lockGuard.lock();
     }
     
+    LogPrint( "Waiting for the remaining clients" );
+    this->m_awaitedReports = ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber();
+    this->m_reportCondition.wait_until( lockGuard, deadline, [this]()
+    {
+        ClientNumberManager::TClientNumber numberOfClients = ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber();
+        return ( numberOfClients > 0 && this->m_numberOfReports >= numberOfClients );
+    } );
+    this->m_awaitedReports = 0;
     LOG_FUNCTION_END();
 }
 
+void
+SystemManager::SubstituteStragglers( const std::vector<TClientId> & clientIds )
+{
+    TDataMap & dataMap = this->m_systemMap[this->m_systemTime];
+    TSystemMap::const_iterator previousDataMap = this->m_systemMap.find( this->m_systemTime - 1 );
+    ClientNumberManager::TClientNumber numberOfSubstitutions = 0;
+    for ( std::vector<TClientId>::const_iterator clientId = clientIds.begin(); clientId != clientIds.end(); ++clientId )
+    {
+        TDataMap::iterator client = dataMap.find( *clientId );
+        if ( client != dataMap.end() )
+        {
+            if ( client->second.reported )
+            {
+                continue;
+            }
+            client->second.realConsumption = client->second.predictedConsumption;
+            client->second.substituted = true;
+        }
+        else
+        {
+            if ( previousDataMap == this->m_systemMap.end() )
+            {
+                continue;
+            }
+            TDataMap::const_iterator previousClient = previousDataMap->second.find( *clientId );
+            if ( previousClient == previousDataMap->second.end() )
+            {
+                continue;
+            }
+            ClientInformation & information = dataMap[*clientId];
+            information.realConsumption = previousClient->second.realConsumption;
+            information.predictedConsumption = information.realConsumption;
+            information.fractionalBits = previousClient->second.fractionalBits;
+            information.numberOfDataPoints = 1;
+            information.substituted = true;
+        }
+        LogPrint( "Client ", *clientId, " missed the deadline, substituted with ", dataMap[*clientId].realConsumption );
+        ++numberOfSubstitutions;
+    }
+    if ( numberOfSubstitutions > 0 )
+    {
+        WarningPrint( "Substituted ", numberOfSubstitutions, " clients at time ", this->m_systemTime );
+    }
+    ClientNumberManager::GetClientNumberManager().SetSubstitutedClients( numberOfSubstitutions );
+}
+
+void
+SystemManager::UpdateClientTimeout( void )
+{
+    ClientNumberManager::TClientNumber numberOfClients = ClientNumberManager::GetClientNumberManager().GetSynchronousClientNumber();
+    TTimeout elapsedTime = std::chrono::duration_cast<TTimeout>( TClock::now() - this->m_waitStartTime );
+    std::vector<TTimeout> arrivalTimes;
+    for ( std::vector<TClock::time_point>::const_iterator arrivalTime = this->m_arrivalTimes.begin(); arrivalTime != this->m_arrivalTimes.end(); ++arrivalTime )
+    {
+        arrivalTimes.push_back( std::max( TTimeout( 0 ), std::chrono::duration_cast<TTimeout>( *arrivalTime - this->m_waitStartTime ) ) );
+    }
+    this->m_arrivalTimes.clear();
+    if ( arrivalTimes.empty() && numberOfClients == 0 )
+    {
+        return;
+    }
+    
+    size_t numberOfOnTimeClients = ( size_t )std::count_if( arrivalTimes.begin(), arrivalTimes.end(), [this]( const TTimeout arrivalTime ) { return ( arrivalTime <= this->m_clientTimeout ); } );
+    if ( arrivalTimes.size() < numberOfClients )
+    {
+        arrivalTimes.resize( numberOfClients, std::max( elapsedTime, this->m_clientTimeout ) );
+    }
+    size_t percentileIndex = ( size_t )std::ceil( this->m_timeoutConfiguration.percentile * arrivalTimes.size() );
+    percentileIndex = std::min( std::max( percentileIndex, ( size_t )1 ), arrivalTimes.size() ) - 1;
+    std::nth_element( arrivalTimes.begin(), arrivalTimes.begin() + percentileIndex, arrivalTimes.end() );
+    
+    this->m_deadlineStatistics.deadline = this->m_clientTimeout;
+    this->m_deadlineStatistics.arrivalPercentile = arrivalTimes[percentileIndex];
+    this->m_deadlineStatistics.onTimeFraction = ( double )numberOfOnTimeClients / arrivalTimes.size();
+    
+    this->m_arrivalPercentiles.push_back( arrivalTimes[percentileIndex] );
+    if ( this->m_arrivalPercentiles.size() > ArrivalWindow )
+    {
+        this->m_arrivalPercentiles.pop_front();
+    }
+    if ( this->m_timeoutConfiguration.adaptive )
+    {
+        TTimeout clientTimeout = *std::max_element( this->m_arrivalPercentiles.begin(), this->m_arrivalPercentiles.end() ) + this->m_timeoutConfiguration.margin;
+        this->m_clientTimeout = std::min( std::max( clientTimeout, this->m_timeoutConfiguration.minimumTimeout ), this->m_timeoutConfiguration.maximumTimeout );
+    }
+    this->m_deadlineStatistics.nextDeadline = this->m_clientTimeout;
+    LogPrint( "Deadline of time ", this->m_systemTime, ": ", this->m_deadlineStatistics.deadline.count(), " ms, on time: ", 100 * this->m_deadlineStatistics.onTimeFraction, "%, arrival percentile: ", this->m_deadlineStatistics.arrivalPercentile.count(), " ms, next deadline: ", this->m_clientTimeout.count(), " ms" );
+}
+
+void
+SystemManager::FinishDecision( void )
+{
+    if ( !this->m_decisionPending )
+    {
+        return;
+    }
+    LogPrint( "Waiting for the decision of time ", this->m_systemTime - 1 );
+    GetControlManager()->WaitUntilReady();
+    this->m_decisionPending = false;
+    this->m_archiveLock.lock();
+    this->m_archive.CommitTick();
+    this->m_archiveLock.unlock();
+}
+
+void
+SystemManager::BeginArchiveTick( void )
+{
+    this->FinishDecision();
+    std::lock_guard<std::mutex> lockGuard( this->m_archiveLock );
+    if ( this->m_archive.IsOpen() && !this->m_archive.IsTickStarted() )
+    {
+        this->m_archive.BeginTick( this->m_systemTime );
+    }
+}
+
 void
 SystemManager::AdvanceTimeStep( void )
 {
     LOG_FUNCTION_START();
     
-    LogPrint( "Waiting for clients for: ", this->m_clientTimeout );
-    this->m_clientTimedMutex.try_lock_for( std::chrono::seconds( this->m_clientTimeout ) );
+    if ( !this->m_decisionPending )
+    {
+        this->m_systemDataLock.lock();
+        this->m_waitStartTime = TClock::now();
+        this->m_systemDataLock.unlock();
+    }
+    LogPrint( "Waiting for clients for: ", this->m_clientTimeout.count(), " ms" );
+    this->WaitForClients();
+    std::vector<TClientId> synchronousClientIds;
+    if ( this->m_substituteStragglers )
+    {
+        synchronousClientIds = GetControlManager()->GetSynchronousClientIds();
+    }
     LogPrint( "Start preparation for time: ",this->m_systemTime , " by deleting previous step" );
     this->m_systemDataLock.lock();
+    if ( this->m_substituteStragglers )
+    {
+        this->SubstituteStragglers( synchronousClientIds );
+    }
     if ( this->m_systemMap.find( this->m_systemTime - 1 ) != this->m_systemMap.end() )
     {
         this->m_systemMap.erase( this->m_systemTime - 1 );
     }
     TDataMap currentDataMap = this->m_systemMap[this->m_systemTime];
+    this->ResolveTraces( this->m_systemTime, currentDataMap );
     
     this->m_systemDataLock.unlock();
     
@@ -125,38 +440,275 @@ SystemManager::AdvanceTimeStep( void )
           ++client )
     {
         LogPrint( "Set Wattage for Next Client" );
-        GetMatlabManager()->SetWattage( GetControlManager()->GetClientName( client->first ), client->second.realConsumption );
+        GetMatlabManager()->SetWattage( GetControlManager()->GetClientName( client->first ), client->second.GetRealWattage() );
         LogPrint( "Wattage set for the client" );
     }
     LogPrint( "Advance time on OpenDSS" );
     GetMatlabManager()->AdvanceTimeStep();
+    
+    this->BeginArchiveTick();
+    this->m_archiveLock.lock();
+    if ( this->m_archive.IsTickStarted() )
+    {
+        for ( TDataMap::iterator client = currentDataMap.begin();
+              client != currentDataMap.end();
+              ++client )
+        {
+            this->m_archive.SetValue( GridArchive::ConsumptionColumn, client->first, client->second.realConsumption, client->second.fractionalBits );
+            if ( client->second.predicted )
+            {
+                this->m_archive.SetValue( GridArchive::PredictedConsumptionColumn, client->first, client->second.predictedConsumption, client->second.fractionalBits );
+            }
+        }
+    }
+    this->m_archiveLock.unlock();
 
     LogPrint( "Invoke External Controller for a Decision" );
     GetControlManager()->MakeDecision();
+    this->m_decisionPending = true;
+    this->m_systemDataLock.lock();
+    this->UpdateClientTimeout();
     ++this->m_systemTime;
+    this->m_numberOfReports = 0;
+    this->m_waitStartTime = TClock::now();
+    this->m_systemDataLock.unlock();
+    ClientNumberManager::GetClientNumberManager().StartTimeStep( this->m_systemTime );
+    GetControlManager()->AdvanceDecisionTime();
     
-    GetControlManager()->WaitUntilReady();
+    if ( !this->m_pipelined )
+    {
+        this->FinishDecision();
+    }
+    if ( this->m_checkpointInterval > 0 && this->m_systemTime % this->m_checkpointInterval == 0 )
+    {
+        this->SaveCheckpoint( this->m_checkpointPath );
+    }
     LogPrint( "Current time frame finished" );
     
     LOG_FUNCTION_END();
 }
 
+bool
+SystemManager::OpenArchive( const std::string & directory, const GridArchive::TClientIndex clientCapacity )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_archiveLock );
+    if ( !this->m_archive.Create( directory, clientCapacity ) )
+    {
+        ErrorPrint( "Cannot create the archive in ", directory );
+        return ( false );
+    }
+    LogPrint( "Archiving up to ", clientCapacity, " clients in ", directory );
+    return ( true );
+}
+
+void
+SystemManager::ArchiveValue( const GridArchive::TColumn column, const TClientId clientId, const TDataPoint value )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_archiveLock );
+    if ( this->m_archive.IsOpen() && !this->m_archive.SetValue( column, clientId, value ) )
+    {
+        WarningPrint( "Client ", clientId, " cannot be archived" );
+    }
+}
+
+bool
+SystemManager::SaveCheckpoint( const std::string & path )
+{
+    LOG_FUNCTION_START();
+    CheckpointWriter checkpoint( path );
+    checkpoint.Write( this->m_systemTime );
+    checkpoint.Write( this->m_systemMode );
+    checkpoint.Write( this->m_systemTimeStep );
+    checkpoint.Write( ClientManager::GetNextClientId() );
+    GetControlManager()->SaveClients( checkpoint );
+    
+    this->m_systemDataLock.lock();
+    TSystemMap::iterator firstTime = this->m_systemMap.lower_bound( this->m_systemTime );
+    checkpoint.Write( ( unsigned int )std::distance( firstTime, this->m_systemMap.end() ) );
+    for ( TSystemMap::iterator time = firstTime; time != this->m_systemMap.end(); ++time )
+    {
+        checkpoint.Write( time->first );
+        checkpoint.Write( ( unsigned int )time->second.size() );
+        for ( TDataMap::iterator client = time->second.begin(); client != time->second.end(); ++client )
+        {
+            checkpoint.Write( client->first );
+            checkpoint.Write( client->second.realConsumption );
+            checkpoint.Write( client->second.predictedConsumption );
+            checkpoint.Write( client->second.fractionalBits );
+            checkpoint.Write( client->second.numberOfDataPoints );
+            checkpoint.Write( client->second.predicted );
+        }
+    }
+    checkpoint.Write( ( unsigned int )this->m_traceMap.size() );
+    for ( TTraceMap::iterator client = this->m_traceMap.begin(); client != this->m_traceMap.end(); ++client )
+    {
+        checkpoint.Write( client->first );
+        checkpoint.Write( ( unsigned int )client->second.size() );
+        for ( TTraceList::iterator trace = client->second.begin(); trace != client->second.end(); ++trace )
+        {
+            checkpoint.Write( trace->GetStartTime() );
+            checkpoint.Write( trace->GetResolution() );
+            checkpoint.Write( trace->GetNumberOfDataPoints() );
+            checkpoint.Write( trace->GetEncodedSize() );
+            checkpoint.WriteBytes( trace->GetEncodedData(), trace->GetEncodedSize() );
+        }
+    }
+    this->m_systemDataLock.unlock();
+    
+    if ( !checkpoint.Commit() )
+    {
+        ErrorPrint( "Cannot write the checkpoint ", path );
+        LOG_FUNCTION_END();
+        return ( false );
+    }
+    LogPrint( "Checkpoint written at time ", this->m_systemTime );
+    LOG_FUNCTION_END();
+    return ( true );
+}
+
+bool
+SystemManager::RestoreCheckpoint( const std::string & path )
+{
+    LOG_FUNCTION_START();
+    CheckpointReader checkpoint( path );
+    TSystemTime systemTime;
+    TSystemMode systemMode;
+    TSystemTimeStep systemTimeStep;
+    TClientId nextClientId;
+    checkpoint.Read( systemTime );
+    checkpoint.Read( systemMode );
+    checkpoint.Read( systemTimeStep );
+    checkpoint.Read( nextClientId );
+    if ( !checkpoint.IsGood() || !GetControlManager()->RestoreClients( checkpoint ) )
+    {
+        ErrorPrint( "Cannot read the checkpoint ", path );
+        LOG_FUNCTION_END();
+        return ( false );
+    }
+    
+    TSystemMap systemMap;
+    unsigned int numberOfTimes = 0;
+    checkpoint.Read( numberOfTimes );
+    for ( unsigned int timeIndex = 0; timeIndex < numberOfTimes && checkpoint.IsGood(); ++timeIndex )
+    {
+        TSystemTime time;
+        unsigned int numberOfClients = 0;
+        checkpoint.Read( time );
+        checkpoint.Read( numberOfClients );
+        for ( unsigned int clientIndex = 0; clientIndex < numberOfClients && checkpoint.IsGood(); ++clientIndex )
+        {
+            TClientId clientId;
+            ClientInformation clientInformation;
+            checkpoint.Read( clientId );
+            checkpoint.Read( clientInformation.realConsumption );
+            checkpoint.Read( clientInformation.predictedConsumption );
+            checkpoint.Read( clientInformation.fractionalBits );
+            checkpoint.Read( clientInformation.numberOfDataPoints );
+            checkpoint.Read( clientInformation.predicted );
+            systemMap[time][clientId] = clientInformation;
+        }
+    }
+    
+    TTraceMap traceMap;
+    unsigned int numberOfTraceClients = 0;
+    checkpoint.Read( numberOfTraceClients );
+    for ( unsigned int clientIndex = 0; clientIndex < numberOfTraceClients && checkpoint.IsGood(); ++clientIndex )
+    {
+        TClientId clientId;
+        unsigned int numberOfTraces = 0;
+        checkpoint.Read( clientId );
+        checkpoint.Read( numberOfTraces );
+        for ( unsigned int traceIndex = 0; traceIndex < numberOfTraces && checkpoint.IsGood(); ++traceIndex )
+        {
+            ConsumptionTrace::TTime startTime = 0;
+            ConsumptionTrace::TTime resolution = 0;
+            ConsumptionTrace::TNumberOfDataPoints numberOfDataPoints = 0;
+            TDataSize encodedSize = 0;
+            checkpoint.Read( startTime );
+            checkpoint.Read( resolution );
+            checkpoint.Read( numberOfDataPoints );
+            checkpoint.Read( encodedSize );
+            if ( !checkpoint.IsGood() || encodedSize > TraceCodec::GetMaximumEncodedSize( numberOfDataPoints ) )
+            {
+                break;
+            }
+            std::vector<unsigned char> encodedData( encodedSize );
+            ConsumptionTrace trace( startTime, resolution );
+            if ( checkpoint.ReadBytes( encodedData.data(), encodedSize ) &&
+                 resolution > 0 &&
+                 trace.Load( encodedData.data(), encodedSize, numberOfDataPoints ) )
+            {
+                traceMap[clientId].push_back( std::move( trace ) );
+            }
+        }
+    }
+    if ( !checkpoint.IsGood() )
+    {
+        ErrorPrint( "Cannot read the checkpoint ", path );
+        LOG_FUNCTION_END();
+        return ( false );
+    }
+    
+    this->m_systemDataLock.lock();
+    this->m_systemTime = systemTime;
+    this->m_systemTimeStep = systemTimeStep;
+    this->m_systemMap.swap( systemMap );
+    this->m_traceMap.swap( traceMap );
+    this->m_systemDataLock.unlock();
+    this->SetSystemMode( systemMode );
+    ClientManager::SetNextClientId( nextClientId );
+    LogPrint( "Checkpoint restored at time ", this->m_systemTime );
+    LOG_FUNCTION_END();
+    return ( true );
+}
+
 void
 SystemManager::SetSystemMode( const TSystemMode systemMode )
 {
     this->m_systemMode = systemMode;
     if ( this->m_systemMode == RealTimeMode )
     {
-        this->m_clientTimeout = 1;
+        this->m_clientTimeout = TTimeout( RealTimeTimeout );
     }
     else if ( this->m_systemMode == SimulationMode )
     {
-        this->m_clientTimeout = 10;
+        this->m_clientTimeout = TTimeout( SimulationTimeout );
     }
     else
     {
         ErrorPrint( "Unknown System Mode: ", systemMode );
     }
+    this->SetTimeoutConfiguration( this->m_timeoutConfiguration );
+}
+
+void
+SystemManager::SetTimeoutConfiguration( const TimeoutConfiguration & timeoutConfiguration )
+{
+    this->m_timeoutConfiguration = timeoutConfiguration;
+    if ( this->m_timeoutConfiguration.adaptive )
+    {
+        this->m_clientTimeout = std::min( std::max( this->m_clientTimeout, this->m_timeoutConfiguration.minimumTimeout ), this->m_timeoutConfiguration.maximumTimeout );
+    }
+}
+
+SystemManager::DeadlineStatistics
+SystemManager::GetDeadlineStatistics( void )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_systemDataLock );
+    return ( this->m_deadlineStatistics );
+}
+
+void
+SystemManager::SetDecisionQuorums( const TQuorumList & decisionQuorums )
+{
+    this->m_decisionQuorums = decisionQuorums;
+    std::sort( this->m_decisionQuorums.begin(), this->m_decisionQuorums.end() );
+}
+
+void
+SystemManager::SetPipelining( const bool pipelined )
+{
+    this->m_pipelined = pipelined;
 }
 
 void
@@ -164,6 +716,7 @@ SystemManager::SetConsumptionsToPredictionTime( const TSystemTime predictionTime
 {
     this->m_systemDataLock.lock();
     TDataMap currentDataMap = this->m_systemMap[predictionTime];
+    this->ResolveTraces( predictionTime, currentDataMap );
     this->m_systemDataLock.unlock();
     
     LogPrint( "Send prediction information to OpenDSS for time ", predictionTime );
@@ -174,7 +727,7 @@ SystemManager::SetConsumptionsToPredictionTime( const TSystemTime predictionTime
              client != currentDataMap.end();
              ++client )
         {
-            GetMatlabManager()->SetWattage( GetControlManager()->GetClientName( client->first ), client->second.realConsumption );
+            GetMatlabManager()->SetWattage( GetControlManager()->GetClientName( client->first ), client->second.GetRealWattage() );
         }
     }
     else
@@ -183,7 +736,7 @@ SystemManager::SetConsumptionsToPredictionTime( const TSystemTime predictionTime
              client != currentDataMap.end();
              ++client )
         {
-            GetMatlabManager()->SetWattage( GetControlManager()->GetClientName( client->first ), client->second.predictedConsumption );
+            GetMatlabManager()->SetWattage( GetControlManager()->GetClientName( client->first ), client->second.GetPredictedWattage() );
         }
     }
     LogPrint( "Advance time on OpenDSS" );
@@ -194,25 +747,50 @@ SystemManager::SetConsumptionsToPredictionTime( const TSystemTime predictionTime
 SystemManager::TDataPoint
 SystemManager::GetCurrentConsumption( const TClientId clientId )
 {
-    return ( this->m_systemMap[this->m_systemTime][clientId].realConsumption );
+    std::lock_guard<std::mutex> lockGuard( this->m_systemDataLock );
+    return ( this->m_systemMap[this->m_systemTime][clientId].GetRealWattage() );
 }
 
 SystemManager::TDataPoint
 SystemManager::GetPredictionConsumption( const TClientId clientId, const TSystemTime interval )
 {
+    std::lock_guard<std::mutex> lockGuard( this->m_systemDataLock );
     if ( this->m_systemMap.find( this->m_systemTime ) != this->m_systemMap.end() )
     {
         if ( this->m_systemMap[this->m_systemTime].find( clientId ) != this->m_systemMap[this->m_systemTime].end() )
         {
-            return ( this->m_systemMap[this->m_systemTime + interval][clientId].predictedConsumption );
+            return ( this->m_systemMap[this->m_systemTime + interval][clientId].GetPredictedWattage() );
         }
     }
     return ( -1 );
 }
 
+std::vector<SystemManager::DecisionInformation>
+SystemManager::GetDecisionInformation( const std::vector<TClientId> & clientIds )
+{
+    std::vector<DecisionInformation> decisionInformation( clientIds.size() );
+    std::lock_guard<std::mutex> lockGuard( this->m_systemDataLock );
+    TSystemMap::const_iterator currentDataMap = this->m_systemMap.find( this->m_systemTime );
+    if ( currentDataMap == this->m_systemMap.end() )
+    {
+        return ( decisionInformation );
+    }
+    for ( size_t clientIndex = 0; clientIndex < clientIds.size(); ++clientIndex )
+    {
+        TDataMap::const_iterator client = currentDataMap->second.find( clientIds[clientIndex] );
+        if ( client != currentDataMap->second.end() )
+        {
+            decisionInformation[clientIndex].numberOfDataPoints = client->second.numberOfDataPoints;
+            decisionInformation[clientIndex].substituted = client->second.substituted;
+        }
+    }
+    return ( decisionInformation );
+}
+
 SystemManager::TNumberOfDataPoints
 SystemManager::GetNumberOfConsumptions( const TClientId clientId )
 {
+    std::lock_guard<std::mutex> lockGuard( this->m_systemDataLock );
     if ( this->m_systemMap.find( this->m_systemTime ) != this->m_systemMap.end() )
     {
         if ( this->m_systemMap[this->m_systemTime].find( clientId ) != this->m_systemMap[this->m_systemTime].end() )
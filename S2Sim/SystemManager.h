@@ -9,13 +9,21 @@
 #define SYSTEMMANAGER_H_
 
 #include <map>
+#include <list>
+#include <deque>
 #include <mutex>
+#include <chrono>
 #include <memory>
+#include <vector>
+#include <condition_variable>
 #include "ClientManager.h"
 #include "MatlabManager.h"
 #include "ControlManager.h"
 #include "LogPrint.h"
 #include "ClientNumberManager.h"
+#include "ConsumptionTrace.h"
+#include "GridArchiveWriter.h"
+#include "CheckpointFile.h"
 
 using namespace TerraSwarm;
 
@@ -91,6 +99,11 @@ class SystemManager
      */
         typedef Asynchronous::ClientData::TNumberOfDataPoints TNumberOfDataPoints;
 
+    /**
+     *  Redefines the view of received data points for rapid development.
+     */
+        typedef Asynchronous::ClientData::TDataPointView TDataPointView;
+
     /**
      *  Defines the voltage information type.
      */
@@ -100,6 +113,137 @@ class SystemManager
      *  Defines the wattage consumption type.
      */
         typedef TDataPoint TWattage;
+    
+    /**
+     *  Redefines the number of fractional bits of a consumption for rapid development.
+     */
+        typedef PayloadEncoding::TFractionalBits TFractionalBits;
+    
+    /**
+     *  Defines the list of quorum fractions of the synchronous clients.
+     */
+        typedef std::vector<double> TQuorumList;
+    
+    /**
+     *  Defines the clock measuring the arrival of the clients.
+     */
+        typedef std::chrono::steady_clock TClock;
+    
+    /**
+     *  Defines the type of the client timeout and the arrival times.
+     */
+        typedef std::chrono::milliseconds TTimeout;
+    
+    /**
+     *  Defines the values of the client timeout.
+     */
+        enum TimeoutValues
+        {
+            RealTimeTimeout = 1000, /**< Fixed timeout of the real-time mode in milliseconds. */
+            SimulationTimeout = 10000, /**< Fixed timeout of the simulation mode in milliseconds. */
+            ArrivalWindow = 8 /**< Number of time steps whose arrival percentiles the adaptive timeout covers. */
+        };
+    
+    /**
+     *  @brief Configuration of the adaptive client timeout.
+     
+        The timeout of a time step is the largest arrival percentile of the last SystemManager::ArrivalWindow time steps plus a margin, kept within the bounds. A client that did not report is counted as arriving at the end of the time step, so the timeout grows while clients miss it.
+     */
+        struct TimeoutConfiguration
+        {
+            /**
+             *  Indicates whether the timeout is adaptive instead of fixed by the system mode.
+             */
+            bool adaptive;
+            
+            /**
+             *  Lower bound of the timeout.
+             */
+            TTimeout minimumTimeout;
+            
+            /**
+             *  Upper bound of the timeout.
+             */
+            TTimeout maximumTimeout;
+            
+            /**
+             *  Percentile of the arrival times the timeout covers, between 0 and 1.
+             */
+            double percentile;
+            
+            /**
+             *  Time added to the arrival percentile.
+             */
+            TTimeout margin;
+            
+            /**
+             *  Creates the configuration of a fixed timeout.
+             */
+            TimeoutConfiguration( void ) : adaptive( false ),
+                                           minimumTimeout( 100 ),
+                                           maximumTimeout( SimulationTimeout ),
+                                           percentile( 0.99 ),
+                                           margin( 50 )
+            {}
+        };
+    
+    /**
+     *  Arrival statistics of the last finished time step.
+     */
+        struct DeadlineStatistics
+        {
+            /**
+             *  Client timeout the time step waited with.
+             */
+            TTimeout deadline;
+            
+            /**
+             *  Arrival percentile of the time step, with the missing clients counted at the end of the time step.
+             */
+            TTimeout arrivalPercentile;
+            
+            /**
+             *  Fraction of the synchronous clients that reported before the deadline.
+             */
+            double onTimeFraction;
+            
+            /**
+             *  Client timeout of the next time step.
+             */
+            TTimeout nextDeadline;
+            
+            /**
+             *  Creates the statistics before the first time step.
+             */
+            DeadlineStatistics( void ) : deadline( 0 ),
+                                         arrivalPercentile( 0 ),
+                                         onTimeFraction( 0 ),
+                                         nextDeadline( 0 )
+            {}
+        };
+    
+    /**
+     *  Information of a client in a decision message, taken in the current interval.
+     */
+        struct DecisionInformation
+        {
+            /**
+             *  Number of data points including the current interval, 0 if the client has no data.
+             */
+            TNumberOfDataPoints numberOfDataPoints;
+            
+            /**
+             *  Indicates whether the client missed the deadline and its consumption was substituted.
+             */
+            bool substituted;
+            
+            /**
+             *  Creates the information of a client without data.
+             */
+            DecisionInformation( void ) : numberOfDataPoints( 0 ),
+                                          substituted( false )
+            {}
+        };
 
     private:
     /**
@@ -108,34 +252,103 @@ class SystemManager
         struct ClientInformation
         {
             /**
-             *  Real consumption of the client within the interval.
+             *  Real consumption of the client within the interval, in units of 2^-fractionalBits watts.
              */
             TWattage realConsumption;
             
             /**
-             *  Predicted consumption for the client for the next intervals.
+             *  Predicted consumption for the client for the next intervals, in units of 2^-fractionalBits watts.
              */
             TWattage predictedConsumption;
             
+            /**
+             *  Number of fractional bits of the consumptions, negotiated by the client in its payload encoding.
+             */
+            TFractionalBits fractionalBits;
+            
             /**
              *  Number of data intervals including and after this interval.
              */
             TNumberOfDataPoints numberOfDataPoints;
             
+            /**
+             *  Indicates whether a prediction of the consumption was registered for this interval, through the horizon of a previous interval or a trace.
+             */
+            bool predicted;
+            
+            /**
+             *  Indicates whether the client reported this interval itself, not through the horizon of a previous interval.
+             */
+            bool reported;
+            
+            /**
+             *  Indicates whether the client missed the deadline and its consumption was substituted with its prediction or its last consumption.
+             */
+            bool substituted;
+            
             /**
              *  Default constructor for std::map compatibility.
              */
-            ClientInformation( void ){}
+            ClientInformation( void ) : realConsumption( 0 ),
+                                        predictedConsumption( 0 ),
+                                        fractionalBits( 0 ),
+                                        numberOfDataPoints( 0 ),
+                                        predicted( false ),
+                                        reported( false ),
+                                        substituted( false )
+            {}
             
             /**
              *  Copy constructor for std::map compatibility.
              *
              *  @param copy Copied instance.
              */
-            ClientInformation( const ClientInformation & copy ) : realConsumption( copy.realConsumption ),
-                                                                  predictedConsumption( copy.predictedConsumption ),
-                                                                  numberOfDataPoints( copy.numberOfDataPoints )
-            {}
+            ClientInformation( const ClientInformation & copy ) = default;
+            
+            /**
+             *  Copy assignment for std::map compatibility.
+             *
+             *  @param copy Copied instance.
+             *
+             *  @return This instance.
+             */
+            ClientInformation&
+            operator = ( const ClientInformation & copy ) = default;
+            
+            /**
+             *  Changes the number of fractional bits, rescaling the consumptions.
+             *
+             *  @param newFractionalBits New number of fractional bits.
+             */
+            void
+            SetFractionalBits( const TFractionalBits newFractionalBits )
+            {
+                this->realConsumption = PayloadEncoding::Rescale( this->realConsumption, this->fractionalBits, newFractionalBits );
+                this->predictedConsumption = PayloadEncoding::Rescale( this->predictedConsumption, this->fractionalBits, newFractionalBits );
+                this->fractionalBits = newFractionalBits;
+            }
+            
+            /**
+             *  Returns the real consumption rounded to watts, as used by OpenDSS and the External Controller.
+             *
+             *  @return Real consumption in watts.
+             */
+            TWattage
+            GetRealWattage( void ) const
+            {
+                return ( PayloadEncoding::ToInteger( this->realConsumption, this->fractionalBits ) );
+            }
+            
+            /**
+             *  Returns the predicted consumption rounded to watts, as used by OpenDSS and the External Controller.
+             *
+             *  @return Predicted consumption in watts.
+             */
+            TWattage
+            GetPredictedWattage( void ) const
+            {
+                return ( PayloadEncoding::ToInteger( this->predictedConsumption, this->fractionalBits ) );
+            }
         };
     
     /**
@@ -147,6 +360,16 @@ class SystemManager
      *  Defines the mapping from Time->(ClientId->Consumption).
      */
         typedef std::map<TSystemTime, TDataMap> TSystemMap;
+    
+    /**
+     *  Defines the compressed traces of a client, in the order of registration.
+     */
+        typedef std::list<ConsumptionTrace> TTraceList;
+    
+    /**
+     *  Defines the mapping from ClientId->Compressed traces.
+     */
+        typedef std::map<TClientId, TTraceList> TTraceMap;
 
     private:
     /**
@@ -165,24 +388,104 @@ class SystemManager
         TSystemTimeStep m_systemTimeStep;
 
     /**
-     *  This variable contains the consumption information for all clients for the future. It is a mapping from time->Client/Data. This allows us to get the consumption of any client at any time. This simplifies the asynchronous client consumption drastically.
+     *  This variable contains the consumption information of the synchronous clients for the future. It is a mapping from time->Client/Data. The asynchronous clients are stored in SystemManager::m_traceMap and added to a copy of the data map of a time step when it is used.
      */
         TSystemMap m_systemMap;
     
+    /**
+     *  Consumption traces of the asynchronous clients, compressed or not when received. They are kept at their own resolution and resolved into the data map of a time step when it is used. Protected by m_systemDataLock.
+     */
+        TTraceMap m_traceMap;
+    
     /**
      *  Mutex protecting the data map.
      */
         std::mutex m_systemDataLock;
     
     /**
-     *  Timed mutex waiting for the consumption information of all clients.
+     *  Defines the time to wait for the data of clients.
      */
-        std::timed_mutex m_clientTimedMutex;
+        TTimeout m_clientTimeout;
     
     /**
-     *  Defines the time to wait for the data of clients.
+     *  Configuration of the adaptive client timeout.
+     */
+        TimeoutConfiguration m_timeoutConfiguration;
+    
+    /**
+     *  Start of the wait for the clients in the current time step. Protected by m_systemDataLock.
+     */
+        TClock::time_point m_waitStartTime;
+    
+    /**
+     *  Arrival times of the synchronous clients in the current time step. Protected by m_systemDataLock.
+     */
+        std::vector<TClock::time_point> m_arrivalTimes;
+    
+    /**
+     *  Arrival percentiles of the last time steps, the newest at the back.
+     */
+        std::deque<TTimeout> m_arrivalPercentiles;
+    
+    /**
+     *  Arrival statistics of the last finished time step. Protected by m_systemDataLock.
+     */
+        DeadlineStatistics m_deadlineStatistics;
+    
+    /**
+     *  Quorum fractions at which a partial decision is made, empty to wait for all clients before the decision.
+     */
+        TQuorumList m_decisionQuorums;
+    
+    /**
+     *  Number of synchronous clients that reported the current interval themselves. Protected by m_systemDataLock.
+     */
+        ClientNumberManager::TClientNumber m_numberOfReports;
+    
+    /**
+     *  Number of reports the time step waits for, 0 if it does not wait. Lowered when the number of synchronous clients drops below it. Protected by m_systemDataLock.
      */
-        TSystemTime m_clientTimeout;
+        ClientNumberManager::TClientNumber m_awaitedReports;
+    
+    /**
+     *  Signaled when the awaited number of reports is reached or a synchronous client is removed.
+     */
+        std::condition_variable m_reportCondition;
+    
+    /**
+     *  Indicates whether the synchronous clients missing at the deadline are substituted.
+     */
+        bool m_substituteStragglers;
+    
+    /**
+     *  Indicates whether the next time step is prepared while the External Controller decides on the current one.
+     */
+        bool m_pipelined;
+    
+    /**
+     *  Indicates whether the External Controller has not finished the last decision yet.
+     */
+        bool m_decisionPending;
+
+    /**
+     *  Archive of the grid state of every time step, written if it is open.
+     */
+        GridArchiveWriter m_archive;
+
+    /**
+     *  Mutex protecting the archive, written by the main loop and the External Controller thread.
+     */
+        std::mutex m_archiveLock;
+
+    /**
+     *  Path of the periodic checkpoint.
+     */
+        std::string m_checkpointPath;
+
+    /**
+     *  Number of time steps between two checkpoints, 0 for no checkpoints.
+     */
+        TSystemTime m_checkpointInterval;
 
     private:
     /**
@@ -190,6 +493,70 @@ class SystemManager
      */
         SystemManager( void );
 
+    /**
+     *  @brief Adds the consumption of the compressed traces at the given time to a data map.
+     
+        The most recently registered trace covering the time wins, like the overwritten entries of SystemManager::m_systemMap. Traces that ended before the current system time are deleted. m_systemDataLock must be locked.
+     *
+     *  @param time    Time of the consumption.
+     *  @param dataMap Data map of the time.
+     */
+        void
+        ResolveTraces( const TSystemTime time, TDataMap & dataMap );
+    
+    /**
+     *  Marks the client as reported in the current interval and wakes up the time step if the awaited number of reports is reached. m_systemDataLock must be locked.
+     *
+     *  @param information Information of the client in the current interval.
+     *
+     *  @return Whether the time step must be woken up after m_systemDataLock is released.
+     */
+        bool
+        CountReport( ClientInformation & information );
+    
+    /**
+     *  Waits for the External Controller to finish the pending decision and commits its time step to the archive. Returns immediately if no decision is pending.
+     */
+        void
+        FinishDecision( void );
+    
+    /**
+     *  Finishes the pending decision and starts the archive tick of the current time step, unless it is started already. Called before the first decision of the time step is sent, so its values can be archived.
+     */
+        void
+        BeginArchiveTick( void );
+    
+    /**
+     *  Computes the arrival statistics of the finished time step and chooses the client timeout of the next one, if it is adaptive. m_systemDataLock must be locked.
+     */
+        void
+        UpdateClientTimeout( void );
+    
+    /**
+     *  Waits for the consumption information of the synchronous clients. At each decision quorum, the reported clients are sent to the External Controller in a partial decision. Returns when all clients reported or the client timeout passed.
+     */
+        void
+        WaitForClients( void );
+    
+    /**
+     *  @brief Substitutes the consumption of the synchronous clients that did not report the current interval.
+     
+        A client with a prediction for the interval from an earlier horizon gets its prediction, otherwise the consumption of the previous interval is repeated. Clients without either stay missing. m_systemDataLock must be locked.
+     *
+     *  @param clientIds Unique ids of the synchronous clients.
+     */
+        void
+        SubstituteStragglers( const std::vector<TClientId> & clientIds );
+
+    /**
+     *  Adds a trace of a client unless it ended before the current system time.
+     *
+     *  @param clientId Unique client id for the consumer.
+     *  @param trace    Trace to be added.
+     */
+        void
+        AddTrace( const TClientId clientId, ConsumptionTrace && trace );
+
     public:
     /**
      *  Returns the current system time.
@@ -227,58 +594,153 @@ class SystemManager
     /**
      *  @brief Used to register multiple consumption information.
      
-        This method is mostly used for asynchronous consumption registration. Multiple consumption data points are fed into the SystemManager::m_systemMap.
+        This method is mostly used for asynchronous consumption registration. The data points are stored once at their own resolution in SystemManager::m_traceMap, instead of once per second of the covered time.
      *
-     *  @param clientId           Unique client id for the consumer.
-     *  @param startTime          Starting time of the consumption map.
-     *  @param resolution         Time resolution between consecutive consumptions.
-     *  @param numberOfDataPoints Number of consumption data points.
-     *  @param dataPoints         Buffer containing consumption data points.
+     *  @param clientId   Unique client id for the consumer.
+     *  @param startTime  Starting time of the consumption map.
+     *  @param resolution Time resolution between consecutive consumptions.
+     *  @param dataPoints View of the consumption data points in the received message.
      */
         void
         RegisterData( const TClientId clientId,
                       const TSystemTime startTime,
                       const TSystemTime resolution,
-                      const TNumberOfDataPoints numberOfDataPoints,
-                      const SmartPointer<TDataPoint> & dataPoints );
+                      const TDataPointView & dataPoints );
+
+    /**
+     *  @brief Used to register a compressed asynchronous consumption trace.
+     
+        The trace stays compressed at its own resolution and is not expanded into SystemManager::m_systemMap. The encoded data is validated and copied.
+     *
+     *  @param clientId           Unique client id for the consumer.
+     *  @param startTime          Starting time of the consumption trace.
+     *  @param resolution         Time resolution between consecutive consumptions.
+     *  @param numberOfDataPoints Number of data points in the trace.
+     *  @param encodedData        Data points encoded with TerraSwarm::TraceCodec.
+     *  @param encodedSize        Number of bytes of the encoded data points.
+     *
+     *  @return false if the trace is malformed.
+     */
+        bool
+        RegisterCompressedData( const TClientId clientId,
+                                const TSystemTime startTime,
+                                const TSystemTime resolution,
+                                const TNumberOfDataPoints numberOfDataPoints,
+                                const void* encodedData,
+                                const TDataSize encodedSize );
 
     /**
      *  @brief Used to register a single consumption information for the next time step.
      
         The method is mostly used for synchronous consumption registration. The consumption for the next time interval is registered.
      *
-     *  @param clientId  Unique client id of the consumer.
-     *  @param dataPoint Consumption for the next time interval.
+     *  @param clientId       Unique client id of the consumer.
+     *  @param dataPoint      Consumption for the next time interval, in units of 2^-fractionalBits watts.
+     *  @param fractionalBits Number of fractional bits of the consumption.
      */
         void
         RegisterData( const TClientId clientId,
-                      TDataPoint dataPoint );
+                      TDataPoint dataPoint,
+                      const TFractionalBits fractionalBits );
     
     /**
      *  @brief Used to register a single consumption information for the next time step.
      
      The method is mostly used for synchronous consumption registration. The consumption for the next time interval is registered.
      *
-     *  @param clientId  Unique client id of the consumer.
-     *  @param numberOfDataPoints Number of consumption points.
-     *  @param dataPoints Consumption for the next time interval and the predicted consumptions.
+     *  @param clientId       Unique client id of the consumer.
+     *  @param dataPoints     View of the consumption for the next time interval and the predicted consumptions in the received message, in units of 2^-fractionalBits watts.
+     *  @param fractionalBits Number of fractional bits of the consumptions.
      */
         void
         RegisterData( const TClientId clientId,
-                      const TNumberOfDataPoints numberOfDataPoints,
-                      const SmartPointer<TDataPoint> & dataPoints );
+                      const TDataPointView & dataPoints,
+                      const TFractionalBits fractionalBits );
 
+    /**
+     *  Removes a deregistered synchronous client from the client count and wakes up the time step if it waits for reports, as the awaited set shrank.
+     */
+        void
+        RemoveSynchronousClient( void );
+
+
+    /**
+     *  @brief Starts archiving the grid state of every time step.
+     
+        The consumption of all clients and the predicted consumption of the clients with a registered prediction are archived by AdvanceTimeStep(), the voltage deviations and prices of the decision by ControlManager through ArchiveValue(). A time step is committed after the decision is finished.
+     *
+     *  @param directory      Archive directory.
+     *  @param clientCapacity Maximum number of clients in the archive.
+     *
+     *  @return false if the archive cannot be created.
+     */
+        bool
+        OpenArchive( const std::string & directory, const GridArchive::TClientIndex clientCapacity );
+
+    /**
+     *  @brief Archives a value of a client in the current time step, if the archive is open.
+     *
+     *  @param column   Archive column of the value.
+     *  @param clientId Unique client id.
+     *  @param value    Value to be archived.
+     */
+        void
+        ArchiveValue( const GridArchive::TColumn column, const TClientId clientId, const TDataPoint value );
+
+    /**
+     *  @brief Writes a checkpoint of the simulation state periodically.
+     *
+     *  @param path     Path of the checkpoint, replaced by each new checkpoint.
+     *  @param interval Number of time steps between two checkpoints, 0 for no checkpoints.
+     */
+        void
+        SetCheckpoint( const std::string & path, const TSystemTime interval )
+        {
+            this->m_checkpointPath = path;
+            this->m_checkpointInterval = interval;
+        }
+
+    /**
+     *  @brief Writes the simulation state to a checkpoint.
+     
+        The checkpoint contains the system time and mode, the next client id, the id and object name of each client, the consumption registered for the current and future time steps and the asynchronous consumption traces. The connections are not part of the checkpoint.
+     *
+     *  @param path Path of the checkpoint.
+     *
+     *  @return false if the checkpoint cannot be written, the previous checkpoint is kept.
+     */
+        bool
+        SaveCheckpoint( const std::string & path );
+
+    /**
+     *  @brief Restores the simulation state from a checkpoint before the connections are accepted.
+     
+        The client ids of the checkpoint are reserved in ControlManager until the clients reconnect with their previous ids.
+     *
+     *  @param path Path of the checkpoint.
+     *
+     *  @return false if the checkpoint cannot be read.
+     */
+        bool
+        RestoreCheckpoint( const std::string & path );
 
     /**
      *  @brief Main time iteration of the system.
      
         This method is the main time iteration of the whole system. The workflow is as follows:
+        - Wait for the clients, making partial decisions at the decision quorums.
+        - Substitute the consumption of the clients that missed the deadline.
         - Delete the previous time step information.
         - Get the current time consumption information.
         - Set the consumption information in OpenDSS.
         - Advance the time in OpenDSS.
+        - Wait for the decision of the previous time step if it is pipelined, commit it to the archive and start the archive tick, unless a partial decision did so already.
+        - Archive the consumption information.
         - Invoke the External Controller for a decision.
-        - Wait for the External Controller to finish its decision.
+        - Choose the client timeout of the next time step from the arrival times.
+        - Advance the system time, the held price signals are sent once the decision is finished as well.
+        - Wait for the External Controller to finish its decision and commit the time step to the archive, unless it is pipelined.
+        - Write a checkpoint if the checkpoint interval has passed.
      */
         void
         AdvanceTimeStep( void );
@@ -291,6 +753,73 @@ class SystemManager
         void
         SetSystemMode( const TSystemMode systemMode );
     
+    /**
+     *  Sets the quorum fractions at which the External Controller starts deciding on the clients that reported so far.
+     *
+     *  @param decisionQuorums Increasing fractions between 0 and 1, empty to wait for all clients before the decision.
+     */
+        void
+        SetDecisionQuorums( const TQuorumList & decisionQuorums );
+    
+    /**
+     *  Sets whether the synchronous clients that miss the deadline of a time step are substituted with their prediction or their last consumption. The substituted clients are then listed at the end of the MakeDecision and PartialDecision messages.
+     *
+     *  @param substituteStragglers Indicates whether the missing clients are substituted.
+     */
+        void
+        SetStragglerSubstitution( const bool substituteStragglers )
+        {
+            this->m_substituteStragglers = substituteStragglers;
+        }
+    
+    /**
+     *  Returns whether the synchronous clients that miss the deadline are substituted.
+     *
+     *  @return Whether the missing clients are substituted.
+     */
+        bool
+        GetStragglerSubstitution( void ) const
+        {
+            return ( this->m_substituteStragglers );
+        }
+    
+    /**
+     *  @brief Sets whether the time steps are pipelined.
+     
+        A pipelined time step does not wait for the decision of the External Controller. The next time step waits for its clients and sets its consumptions in OpenDSS meanwhile, and waits for the decision only before its own decision message.
+     *
+     *  @param pipelined Indicates whether the time steps are pipelined.
+     */
+        void
+        SetPipelining( const bool pipelined );
+    
+    /**
+     *  @brief Sets the configuration of the client timeout.
+     *
+     *  @param timeoutConfiguration New configuration, the current timeout is kept within its bounds if it is adaptive.
+     */
+        void
+        SetTimeoutConfiguration( const TimeoutConfiguration & timeoutConfiguration );
+    
+    /**
+     *  @brief Returns the arrival statistics of the last finished time step.
+     *
+     *  @return Deadline, arrival percentile and on-time fraction of the time step.
+     */
+        DeadlineStatistics
+        GetDeadlineStatistics( void );
+    
+    /**
+     *  @brief Returns the information of the clients of a decision message in the current interval.
+     
+        The information of all clients is taken under one lock, so the message is sized and filled from it while the clients keep reporting.
+     *
+     *  @param clientIds Ids of the clients in the message.
+     *  @return Information of each client, in the order of the ids.
+     */
+        std::vector<DecisionInformation>
+        GetDecisionInformation( const std::vector<TClientId> & clientIds );
+    
     /**
      *  @brief Returns the consumption of the client in the current interval.
      *
@@ -0,0 +1,179 @@
+/**
+ * @file ByteOrderConverter.cpp
+ * Implements the ByteOrderConverter class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <string.h>
+#if ( defined(_WIN32) || defined(_WIN64) )
+#include <winsock2.h>
+#elif ( defined(__linux__) || defined(__APPLE__) )
+#include <netinet/in.h>
+#endif
+#include "ByteOrderConverter.h"
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && defined(__GNUC__)
+#define BYTE_ORDER_CONVERTER_X86
+#include <immintrin.h>
+#endif
+
+namespace TerraSwarm
+{
+    /**
+     *  Signature of a conversion kernel.
+     */
+    typedef void ( *TConvertFunction )( void* destination, const void* source, const ByteOrderConverter::TNumberOfElements numberOfElements );
+
+    /**
+     *  Converts one element per step. Also converts the remainder of the vector kernels.
+     */
+    static void
+    ConvertScalar( void* destination, const void* source, const ByteOrderConverter::TNumberOfElements numberOfElements )
+    {
+        char* currentDestination = ( char* )destination;
+        const char* currentSource = ( const char* )source;
+        for ( ByteOrderConverter::TNumberOfElements index = 0; index < numberOfElements; ++index )
+        {
+            unsigned int value;
+            memcpy( &value, currentSource, sizeof( value ) );
+            value = ntohl( value );
+            memcpy( currentDestination, &value, sizeof( value ) );
+            currentSource += sizeof( value );
+            currentDestination += sizeof( value );
+        }
+    }
+
+#if defined(BYTE_ORDER_CONVERTER_X86)
+    /**
+     *  Converts 4 elements per step with the SSSE3 byte shuffle.
+     */
+    __attribute__(( target( "ssse3" ) )) static void
+    ConvertSsse3( void* destination, const void* source, const ByteOrderConverter::TNumberOfElements numberOfElements )
+    {
+        const __m128i shuffleMask = _mm_set_epi8( 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+        char* currentDestination = ( char* )destination;
+        const char* currentSource = ( const char* )source;
+        ByteOrderConverter::TNumberOfElements index = 0;
+        for ( ; index + 4 <= numberOfElements; index += 4 )
+        {
+            __m128i values = _mm_loadu_si128( ( const __m128i* )currentSource );
+            _mm_storeu_si128( ( __m128i* )currentDestination, _mm_shuffle_epi8( values, shuffleMask ) );
+            currentSource += sizeof( __m128i );
+            currentDestination += sizeof( __m128i );
+        }
+        ConvertScalar( currentDestination, currentSource, numberOfElements - index );
+    }
+
+    /**
+     *  Converts 8 elements per step with the AVX2 byte shuffle, which shuffles each 128 bit lane separately.
+     */
+    __attribute__(( target( "avx2" ) )) static void
+    ConvertAvx2( void* destination, const void* source, const ByteOrderConverter::TNumberOfElements numberOfElements )
+    {
+        const __m256i shuffleMask = _mm256_set_epi8( 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                                     12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+        char* currentDestination = ( char* )destination;
+        const char* currentSource = ( const char* )source;
+        ByteOrderConverter::TNumberOfElements index = 0;
+        for ( ; index + 16 <= numberOfElements; index += 16 )
+        {
+            __m256i firstValues = _mm256_loadu_si256( ( const __m256i* )currentSource );
+            __m256i secondValues = _mm256_loadu_si256( ( const __m256i* )( currentSource + sizeof( __m256i ) ) );
+            _mm256_storeu_si256( ( __m256i* )currentDestination, _mm256_shuffle_epi8( firstValues, shuffleMask ) );
+            _mm256_storeu_si256( ( __m256i* )( currentDestination + sizeof( __m256i ) ), _mm256_shuffle_epi8( secondValues, shuffleMask ) );
+            currentSource += 2 * sizeof( __m256i );
+            currentDestination += 2 * sizeof( __m256i );
+        }
+        for ( ; index + 8 <= numberOfElements; index += 8 )
+        {
+            __m256i values = _mm256_loadu_si256( ( const __m256i* )currentSource );
+            _mm256_storeu_si256( ( __m256i* )currentDestination, _mm256_shuffle_epi8( values, shuffleMask ) );
+            currentSource += sizeof( __m256i );
+            currentDestination += sizeof( __m256i );
+        }
+        ConvertScalar( currentDestination, currentSource, numberOfElements - index );
+    }
+#endif
+
+    /**
+     *  Returns the function of a kernel.
+     */
+    static TConvertFunction
+    GetConvertFunction( const ByteOrderConverter::TKernel kernel )
+    {
+#if defined(BYTE_ORDER_CONVERTER_X86)
+        if ( kernel == ByteOrderConverter::Avx2Kernel )
+        {
+            return ( &ConvertAvx2 );
+        }
+        if ( kernel == ByteOrderConverter::Ssse3Kernel )
+        {
+            return ( &ConvertSsse3 );
+        }
+#endif
+        return ( &ConvertScalar );
+    }
+
+    void
+    ByteOrderConverter::Convert( void* destination, const void* source, const TNumberOfElements numberOfElements )
+    {
+        static const TConvertFunction convertFunction = GetConvertFunction( GetKernel() );
+        convertFunction( destination, source, numberOfElements );
+    }
+
+    ByteOrderConverter::TKernel
+    ByteOrderConverter::GetKernel( void )
+    {
+        if ( IsKernelSupported( Avx2Kernel ) )
+        {
+            return ( Avx2Kernel );
+        }
+        if ( IsKernelSupported( Ssse3Kernel ) )
+        {
+            return ( Ssse3Kernel );
+        }
+        return ( ScalarKernel );
+    }
+
+    bool
+    ByteOrderConverter::IsKernelSupported( const TKernel kernel )
+    {
+        switch ( kernel )
+        {
+            case ScalarKernel:
+                return ( true );
+#if defined(BYTE_ORDER_CONVERTER_X86)
+            case Ssse3Kernel:
+                return ( __builtin_cpu_supports( "ssse3" ) );
+            case Avx2Kernel:
+                return ( __builtin_cpu_supports( "avx2" ) );
+#endif
+            default:
+                return ( false );
+        }
+    }
+
+    const char*
+    ByteOrderConverter::GetKernelName( const TKernel kernel )
+    {
+        switch ( kernel )
+        {
+            case ScalarKernel:
+                return ( "Scalar" );
+            case Ssse3Kernel:
+                return ( "SSSE3" );
+            case Avx2Kernel:
+                return ( "AVX2" );
+            default:
+                return ( "Unknown" );
+        }
+    }
+
+    void
+    ByteOrderConverter::Convert( const TKernel kernel, void* destination, const void* source, const TNumberOfElements numberOfElements )
+    {
+        GetConvertFunction( kernel )( destination, source, numberOfElements );
+    }
+
+} /* namespace TerraSwarm */
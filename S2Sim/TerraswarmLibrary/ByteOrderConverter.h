@@ -0,0 +1,137 @@
+/**
+ * @file ByteOrderConverter.h
+ * Defines the ByteOrderConverter class for byte order conversion of whole arrays.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef BYTEORDERCONVERTER_H_
+#define BYTEORDERCONVERTER_H_
+
+#include <stddef.h>
+#include "CompileTimeCheckerLibrary.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Converts arrays of 32 bit values between host and network byte order.
+
+        NetworkByteAccessor converts single fields. The array payloads of the messages (data points, prices, voltages) are converted here in one pass. The kernel is chosen once at runtime: AVX2 and SSSE3 byte shuffles on x86 processors that support them, a scalar loop otherwise. On big endian hosts the scalar kernel only copies the arrays.
+     */
+    class ByteOrderConverter
+    {
+        public:
+        /**
+         *  Defines the type of the number of elements in an array.
+         */
+            typedef size_t TNumberOfElements;
+
+        /**
+         *  Defines the kernel type.
+         */
+            typedef unsigned char TKernel;
+
+        /**
+         *  Available conversion kernels.
+         */
+            enum KernelValues
+            {
+                ScalarKernel = ( TKernel )0, /**< One element per step, available on every host. */
+                Ssse3Kernel = ( TKernel )1, /**< 4 elements per step with the SSSE3 byte shuffle. */
+                Avx2Kernel = ( TKernel )2, /**< 8 elements per step with the AVX2 byte shuffle. */
+                NumberOfKernels = ( TKernel )3 /**< Number of kernels, not a kernel. */
+            };
+
+        private:
+        /**
+         *  Size of a single converted element in bytes.
+         */
+            static const TNumberOfElements ElementSize = 4;
+
+        /**
+         *  Converts the byte order of every element in the array.
+         *
+         *  @param destination Converted elements, can be the same as the source.
+         *  @param source Elements to be converted.
+         *  @param numberOfElements Number of elements.
+         */
+            static void
+            Convert( void* destination, const void* source, const TNumberOfElements numberOfElements );
+
+        public:
+        /**
+         *  Returns the kernel used by HostToNetwork() and NetworkToHost() on this host.
+         *
+         *  @return The fastest supported kernel.
+         */
+            static TKernel
+            GetKernel( void );
+
+        /**
+         *  Checks whether the processor supports a kernel.
+         *
+         *  @param kernel Kernel to be checked.
+         *
+         *  @return true if the kernel can be used.
+         */
+            static bool
+            IsKernelSupported( const TKernel kernel );
+
+        /**
+         *  Returns a readable name for a kernel.
+         *
+         *  @param kernel Kernel whose name is returned.
+         *
+         *  @return Name of the kernel.
+         */
+            static const char*
+            GetKernelName( const TKernel kernel );
+
+        /**
+         *  Converts the byte order of every element in the array with the given kernel. Used to compare the kernels, the kernel must be supported.
+         *
+         *  @param kernel Kernel to be used.
+         *  @param destination Converted elements, can be the same as the source.
+         *  @param source Elements to be converted.
+         *  @param numberOfElements Number of elements.
+         */
+            static void
+            Convert( const TKernel kernel, void* destination, const void* source, const TNumberOfElements numberOfElements );
+
+        /**
+         *  Converts an array from host byte order to network byte order. The destination does not need to be aligned, e.g. it can point into a message.
+         *
+         *  @tparam TElement Type of the elements, must be 4 bytes long.
+         *
+         *  @param destination Converted elements, can be the same as the source.
+         *  @param source Elements to be converted.
+         *  @param numberOfElements Number of elements.
+         */
+            template <typename TElement>
+            static void
+            HostToNetwork( void* destination, const TElement* source, const TNumberOfElements numberOfElements )
+            {
+                SizeCheck<TElement, ElementSize>::Check();
+                Convert( destination, source, numberOfElements );
+            }
+
+        /**
+         *  Converts an array from network byte order to host byte order. The source does not need to be aligned, e.g. it can point into a message.
+         *
+         *  @tparam TElement Type of the elements, must be 4 bytes long.
+         *
+         *  @param destination Converted elements, can be the same as the source.
+         *  @param source Elements to be converted.
+         *  @param numberOfElements Number of elements.
+         */
+            template <typename TElement>
+            static void
+            NetworkToHost( TElement* destination, const void* source, const TNumberOfElements numberOfElements )
+            {
+                SizeCheck<TElement, ElementSize>::Check();
+                Convert( destination, source, numberOfElements );
+            }
+    };
+} /* namespace TerraSwarm */
+
+#endif /* BYTEORDERCONVERTER_H_ */
@@ -9,6 +9,51 @@
 
 namespace TerraSwarm
 {
+    /**
+     *  Size of the optional payload encoding field after the padded client name: 2 bytes encoding, 2 bytes number of fractional bits.
+     */
+    static const TDataSize PayloadEncodingSize = sizeof( PayloadEncoding::TEncoding ) + sizeof( PayloadEncoding::TFractionalBits );
+
+    /**
+     *  Writes the payload encoding field.
+     *
+     *  @param destination First byte of the field.
+     *  @param payloadEncoding Encoding to be written.
+     */
+    static void
+    WritePayloadEncoding( char* destination, const PayloadEncoding & payloadEncoding )
+    {
+        PayloadEncoding::TEncoding encoding = htons( payloadEncoding.GetEncoding() );
+        PayloadEncoding::TFractionalBits fractionalBits = htons( payloadEncoding.GetFractionalBits() );
+        memcpy( destination, &encoding, sizeof( encoding ) );
+        memcpy( destination + sizeof( encoding ), &fractionalBits, sizeof( fractionalBits ) );
+    }
+
+    /**
+     *  Reads the payload encoding field of a connection request. The field follows the padded client name and is missing in the requests of older clients.
+     *
+     *  @param message First byte of the message.
+     *
+     *  @return Requested encoding, the integer encoding if the field is missing.
+     */
+    static PayloadEncoding
+    ReadPayloadEncoding( const char* message )
+    {
+        TDataSize dataSize = ( ( MessageHeader* )message )->GetDataSize();
+        const char* name = message + MessageHeader::MessageHeaderSize;
+        TDataSize nameSize = ( TDataSize )strnlen( name, dataSize );
+        TDataSize paddingSize = 4 - nameSize % 4;
+        if ( dataSize < nameSize + paddingSize + PayloadEncodingSize )
+        {
+            return ( PayloadEncoding() );
+        }
+        PayloadEncoding::TEncoding encoding;
+        PayloadEncoding::TFractionalBits fractionalBits;
+        memcpy( &encoding, name + nameSize + paddingSize, sizeof( encoding ) );
+        memcpy( &fractionalBits, name + nameSize + paddingSize + sizeof( encoding ), sizeof( fractionalBits ) );
+        return ( PayloadEncoding( ntohs( encoding ), ntohs( fractionalBits ) ) );
+    }
+
     namespace Asynchronous
     {
 
@@ -23,15 +68,21 @@ namespace TerraSwarm
         SmartPointer<ClientConnectionRequest>
         ClientConnectionRequest::GetNewClientConnectionRequest( const MessageHeader::TSenderId senderId,
                                                                 const MessageHeader::TReceiverId receiverId,
-                                                                const TClientName & clientName )
+                                                                const TClientName & clientName,
+                                                                const PayloadEncoding & payloadEncoding )
         {
             TDataSize nameSize = ( TDataSize )clientName.size();
-            TDataSize paddingSize = ( nameSize % 4 == 0 ) ? 0 : 4 - nameSize;
-            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + nameSize + paddingSize + MessageEnder::EndOfMessageSize;
+            TDataSize paddingSize = 4 - nameSize % 4;
+            TDataSize encodingSize = ( payloadEncoding.GetEncoding() == PayloadEncoding::IntegerEncoding ) ? 0 : PayloadEncodingSize;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + nameSize + paddingSize + encodingSize + MessageEnder::EndOfMessageSize;
             auto newMemory = CreateObjectArray<char>( totalDataSize );
-            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, nameSize + paddingSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, nameSize + paddingSize + encodingSize );
             memcpy( newMemory + MessageHeader::MessageHeaderSize, clientName.c_str(), nameSize );
             memset( newMemory + MessageHeader::MessageHeaderSize + nameSize, 0x00, paddingSize );
+            if ( encodingSize != 0 )
+            {
+                WritePayloadEncoding( newMemory + MessageHeader::MessageHeaderSize + nameSize + paddingSize, payloadEncoding );
+            }
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
@@ -54,6 +105,12 @@ namespace TerraSwarm
             return ( clientName );
         }
 
+        PayloadEncoding
+        ClientConnectionRequest::GetPayloadEncoding( void ) const
+        {
+            return ( ReadPayloadEncoding( ( const char* )this ) );
+        }
+
     } /* namespace Asynchronous */
 
     namespace Synchronous
@@ -69,16 +126,22 @@ namespace TerraSwarm
         SmartPointer<ClientConnectionRequest>
         ClientConnectionRequest::GetNewClientConnectionRequest( const MessageHeader::TSenderId senderId,
                                                                 const MessageHeader::TReceiverId receiverId,
-                                                                const TClientName & clientName )
+                                                                const TClientName & clientName,
+                                                                const PayloadEncoding & payloadEncoding )
         {
             TDataSize nameSize = ( TDataSize )clientName.size();
-            TDataSize paddingSize = ( nameSize % 4 == 0 ) ? 0 : 4 - nameSize;
-            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + nameSize + paddingSize + MessageEnder::EndOfMessageSize;
+            TDataSize paddingSize = 4 - nameSize % 4;
+            TDataSize encodingSize = ( payloadEncoding.GetEncoding() == PayloadEncoding::IntegerEncoding ) ? 0 : PayloadEncodingSize;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + nameSize + paddingSize + encodingSize + MessageEnder::EndOfMessageSize;
             auto newMemory = CreateObjectArray<char>( totalDataSize );
 
-            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, nameSize + paddingSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, nameSize + paddingSize + encodingSize );
             memcpy( newMemory + MessageHeader::MessageHeaderSize, clientName.c_str(), nameSize );
             memset( newMemory + MessageHeader::MessageHeaderSize + nameSize, 0x00, paddingSize );
+            if ( encodingSize != 0 )
+            {
+                WritePayloadEncoding( newMemory + MessageHeader::MessageHeaderSize + nameSize + paddingSize, payloadEncoding );
+            }
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
@@ -100,5 +163,11 @@ namespace TerraSwarm
             TClientName clientName = ( ( char* )this ) + MessageHeader::MessageHeaderSize;
             return ( clientName );
         }
+
+        PayloadEncoding
+        ClientConnectionRequest::GetPayloadEncoding( void ) const
+        {
+            return ( ReadPayloadEncoding( ( const char* )this ) );
+        }
     } /* namespace Synchronous */
 } /* namespace TerraSwarm */
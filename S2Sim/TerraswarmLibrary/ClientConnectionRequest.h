@@ -10,6 +10,7 @@
 
 #include "MessageHeader.h"
 #include "MessageEnder.h"
+#include "PayloadEncoding.h"
 
 #include <string>
 
@@ -78,13 +79,15 @@ namespace TerraSwarm
              *  @param senderId   Id of the client.
              *  @param receiverId Id of S2Sim.
              *  @param clientName Name of the object, the client is representing.
+             *  @param payloadEncoding Encoding of the consumption values the client will send. The encoding and its number of fractional bits are only written to the message if it is not the integer encoding.
              *
              *  @return A new allocated message. @warning The deallocation is user's duty.
              */
                 static SmartPointer<ClientConnectionRequest>
                 GetNewClientConnectionRequest( const MessageHeader::TSenderId senderId,
                                                const MessageHeader::TReceiverId receiverId,
-                                               const TClientName & clientName );
+                                               const TClientName & clientName,
+                                               const PayloadEncoding & payloadEncoding = PayloadEncoding() );
 
             /**
              *  Checks whether the current memory address contains a Client Connection Request message. Cast the received memory to the pointer of this class and call this method for checking.
@@ -101,6 +104,14 @@ namespace TerraSwarm
              */
                 TClientName
                 GetClientName( void ) const;
+
+            /**
+             *  Returns the payload encoding requested by the client. Clients that do not request one use the integer encoding.
+             *
+             *  @return Requested payload encoding.
+             */
+                PayloadEncoding
+                GetPayloadEncoding( void ) const;
         };
     } /* namespace Asynchronous */
 
@@ -162,13 +173,15 @@ namespace TerraSwarm
              *  @param senderId   Id of the client.
              *  @param receiverId Id of S2Sim.
              *  @param clientName Name of the object, the client is representing.
+             *  @param payloadEncoding Encoding of the consumption values the client will send. The encoding and its number of fractional bits are only written to the message if it is not the integer encoding.
              *
              *  @return A new allocated message. @warning The deallocation is user's duty.
              */
                 static SmartPointer<ClientConnectionRequest>
                 GetNewClientConnectionRequest( const MessageHeader::TSenderId senderId,
                                                const MessageHeader::TReceiverId receiverId,
-                                               const TClientName & clientName );
+                                               const TClientName & clientName,
+                                               const PayloadEncoding & payloadEncoding = PayloadEncoding() );
 
             /**
              *  Checks whether the current memory address contains a Client Connection Request message. Cast the received memory to the pointer of this class and call this method for checking.
@@ -185,6 +198,14 @@ namespace TerraSwarm
              */
                 TClientName
                 GetClientName( void ) const;
+
+            /**
+             *  Returns the payload encoding requested by the client. Clients that do not request one use the integer encoding.
+             *
+             *  @return Requested payload encoding.
+             */
+                PayloadEncoding
+                GetPayloadEncoding( void ) const;
         };
     } /* namespace Synchronous */
 } /* namespace TerraSwarm */
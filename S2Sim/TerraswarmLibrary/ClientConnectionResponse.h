@@ -59,7 +59,8 @@ namespace TerraSwarm
                 enum RequestResultValues
                 {
                     RequestAccepted = ( TRequestResult )0x00000000, /**< The request is accepted. */
-                    RequestObjectIdNotFound = ( TRequestResult )0x00000001 /**< The requested object name is not found and rejected. */
+                    RequestObjectIdNotFound = ( TRequestResult )0x00000001, /**< The requested object name is not found and rejected. */
+                    RequestEncodingNotSupported = ( TRequestResult )0x00000002 /**< The requested payload encoding is not supported and rejected. */
                 };
 
             /**
@@ -257,7 +258,8 @@ namespace TerraSwarm
                 enum RequestResultValues
                 {
                     RequestAccepted = ( TRequestResult )0x00000000, /**< The request is accepted. */
-                    RequestObjectIdNotFound = ( TRequestResult )0x00000001 /**< The requested object name is not found and rejected. */
+                    RequestObjectIdNotFound = ( TRequestResult )0x00000001, /**< The requested object name is not found and rejected. */
+                    RequestEncodingNotSupported = ( TRequestResult )0x00000002 /**< The requested payload encoding is not supported and rejected. */
                 };
             
             /**
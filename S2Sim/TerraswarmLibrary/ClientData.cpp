@@ -6,6 +6,7 @@
  */
 
 #include "ClientData.h"
+#include "ByteOrderConverter.h"
 
 namespace TerraSwarm
 {
@@ -28,18 +29,41 @@ namespace TerraSwarm
                                       const TNumberOfDataPoints numberOfDataPoints,
                                       TDataPoint* dataPoints )
         {
-            TDataSize totalDataSize = MessageHeader::MessageHeaderSize +
-                                      StartTimeSize +
-                                      TimeResolutionSize +
-                                      NumberOfDataPointsSize +
-                                      DataPointSize * numberOfDataPoints +
-                                      MessageEnder::EndOfMessageSize;
+            TDataSize dataSize = StartTimeSize +
+                                 TimeResolutionSize +
+                                 NumberOfDataPointsSize +
+                                 DataPointSize * numberOfDataPoints;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
             auto newMemory = CreateObjectArray<char>( totalDataSize );
-            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
             ( ( TStartTimeAccessor* )newMemory )->Write( startTime );
             ( ( TTimeResolutionAccessor* )newMemory )->Write( timeResolution );
             ( ( TNumberOfDataPointsAccessor* )newMemory )->Write( numberOfDataPoints );
-            memcpy( ( newMemory + DataStartIndex ), dataPoints, DataPointSize * numberOfDataPoints );
+            ByteOrderConverter::HostToNetwork( newMemory + DataStartIndex, dataPoints, numberOfDataPoints );
+            ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
+            return ( newMemory );
+        }
+
+        SmartPointer<ClientData>
+        ClientData::GetNewClientData( const MessageHeader::TSenderId senderId,
+                                      const MessageHeader::TReceiverId receiverId,
+                                      const TStartTime startTime,
+                                      const TTimeResolution timeResolution,
+                                      const TNumberOfDataPoints numberOfDataPoints,
+                                      const PayloadEncoding & payloadEncoding,
+                                      const PayloadEncoding::TValue* values )
+        {
+            TDataSize dataSize = StartTimeSize +
+                                 TimeResolutionSize +
+                                 NumberOfDataPointsSize +
+                                 payloadEncoding.GetPayloadSize( numberOfDataPoints );
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
+            auto newMemory = CreateObjectArray<char>( totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
+            ( ( TStartTimeAccessor* )newMemory )->Write( startTime );
+            ( ( TTimeResolutionAccessor* )newMemory )->Write( timeResolution );
+            ( ( TNumberOfDataPointsAccessor* )newMemory )->Write( numberOfDataPoints );
+            payloadEncoding.Encode( values, numberOfDataPoints, newMemory + DataStartIndex );
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
@@ -84,10 +108,132 @@ namespace TerraSwarm
         {
             TNumberOfDataPoints numberOfDataPoints = this->GetNumberOfDataPoints();
             auto dataPoints = CreateObjectArray<TDataPoint>( numberOfDataPoints );
-            memcpy( dataPoints, ( ( char* )this ) + DataStartIndex, numberOfDataPoints * DataPointSize );
+            this->GetDataPointView().CopyToHost( dataPoints );
             return ( dataPoints );
         }
 
+        ClientData::TDataPointView
+        ClientData::GetDataPointView( void ) const
+        {
+            return ( TDataPointView( ( ( const char* )this ) + DataStartIndex, this->GetNumberOfDataPoints() ) );
+        }
+
+        ClientData::TCheckResult
+        ClientData::CheckPayloadSize( const PayloadEncoding & payloadEncoding ) const
+        {
+            if ( ( ( MessageHeader* )this )->GetDataSize() == StartTimeSize + TimeResolutionSize + NumberOfDataPointsSize + payloadEncoding.GetPayloadSize( this->GetNumberOfDataPoints() ) )
+            {
+                return ( Success );
+            }
+            return ( Fail );
+        }
+
+        const void*
+        ClientData::GetPayload( void ) const
+        {
+            return ( ( ( const char* )this ) + DataStartIndex );
+        }
+
+
+        ClientCompressedData::ClientCompressedData( void )
+        {
+        }
+
+        ClientCompressedData::~ClientCompressedData( void )
+        {
+        }
+
+        SmartPointer<ClientCompressedData>
+        ClientCompressedData::GetNewClientCompressedData( const MessageHeader::TSenderId senderId,
+                                                          const MessageHeader::TReceiverId receiverId,
+                                                          const TStartTime startTime,
+                                                          const TTimeResolution timeResolution,
+                                                          const TNumberOfDataPoints numberOfDataPoints,
+                                                          const TDataPoint* dataPoints )
+        {
+            auto encodedData = CreateObjectArray<char>( TraceCodec::GetMaximumEncodedSize( numberOfDataPoints ) + 1 );
+            TEncodedSize encodedSize = TraceCodec::Encode( dataPoints, numberOfDataPoints, encodedData );
+            TDataSize paddingSize = ( 4 - encodedSize % 4 ) % 4;
+            TDataSize dataSize = StartTimeSize +
+                                 TimeResolutionSize +
+                                 NumberOfDataPointsSize +
+                                 EncodedSizeSize +
+                                 encodedSize +
+                                 paddingSize;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
+            auto newMemory = CreateObjectArray<char>( totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
+            ( ( TStartTimeAccessor* )newMemory )->Write( startTime );
+            ( ( TTimeResolutionAccessor* )newMemory )->Write( timeResolution );
+            ( ( TNumberOfDataPointsAccessor* )newMemory )->Write( numberOfDataPoints );
+            ( ( TEncodedSizeAccessor* )newMemory )->Write( encodedSize );
+            memcpy( newMemory + DataStartIndex, encodedData, encodedSize );
+            memset( newMemory + DataStartIndex + encodedSize, 0x00, paddingSize );
+            ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
+            return ( newMemory );
+        }
+
+        ClientCompressedData::TCheckResult
+        ClientCompressedData::CheckMessage( void ) const
+        {
+            if ( ( ( MessageHeader* )this )->GetMessageType() == MessageType &&
+                 ( ( MessageHeader* )this )->GetMessageId() == MessageId )
+            {
+                return ( Success );
+            }
+            return ( Fail );
+        }
+
+        ClientCompressedData::TCheckResult
+        ClientCompressedData::CheckEncodedSize( void ) const
+        {
+            TDataSize dataSize = ( ( MessageHeader* )this )->GetDataSize();
+            TDataSize fieldsSize = StartTimeSize + TimeResolutionSize + NumberOfDataPointsSize + EncodedSizeSize;
+            if ( dataSize >= fieldsSize && this->GetEncodedSize() <= dataSize - fieldsSize )
+            {
+                return ( Success );
+            }
+            return ( Fail );
+        }
+
+        ClientCompressedData::TStartTime
+        ClientCompressedData::GetStartTime( void ) const
+        {
+            TStartTime value;
+            ( ( TStartTimeAccessor* )this )->Read( value );
+            return ( value );
+        }
+
+        ClientCompressedData::TTimeResolution
+        ClientCompressedData::GetTimeResolution( void ) const
+        {
+            TTimeResolution value;
+            ( ( TTimeResolutionAccessor* )this )->Read( value );
+            return ( value );
+        }
+
+        ClientCompressedData::TNumberOfDataPoints
+        ClientCompressedData::GetNumberOfDataPoints( void ) const
+        {
+            TNumberOfDataPoints value;
+            ( ( TNumberOfDataPointsAccessor* )this )->Read( value );
+            return ( value );
+        }
+
+        ClientCompressedData::TEncodedSize
+        ClientCompressedData::GetEncodedSize( void ) const
+        {
+            TEncodedSize value;
+            ( ( TEncodedSizeAccessor* )this )->Read( value );
+            return ( value );
+        }
+
+        const void*
+        ClientCompressedData::GetEncodedData( void ) const
+        {
+            return ( ( ( const char* )this ) + DataStartIndex );
+        }
+
     } /* namespace Asynchronous */
 
     namespace Synchronous
@@ -106,16 +252,30 @@ namespace TerraSwarm
                                       const MessageHeader::TReceiverId receiverId,
                                       TDataPoint dataPoint )
         {
-            TDataSize totalDataSize = MessageHeader::MessageHeaderSize +
-                                      DataPointSize +
-                                      MessageEnder::EndOfMessageSize;
+            TDataSize dataSize = DataPointSize;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
             auto newMemory = CreateObjectArray<char>( totalDataSize );
-            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
             ( ( TDataPointAccessor* )newMemory )->Write( dataPoint );
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
 
+        SmartPointer<ClientData>
+        ClientData::GetNewClientData( const MessageHeader::TSenderId senderId,
+                                      const MessageHeader::TReceiverId receiverId,
+                                      const PayloadEncoding & payloadEncoding,
+                                      const PayloadEncoding::TValue value )
+        {
+            TDataSize dataSize = DataPointSize;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
+            auto newMemory = CreateObjectArray<char>( totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
+            payloadEncoding.Encode( &value, 1, newMemory + DataPointIndex );
+            ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
+            return ( newMemory );
+        }
+
         ClientData::TCheckResult
         ClientData::CheckMessage( void ) const
         {
@@ -134,6 +294,12 @@ namespace TerraSwarm
             ( ( TDataPointAccessor* )this )->Read( value );
             return ( value );
         }
+
+        const void*
+        ClientData::GetPayload( void ) const
+        {
+            return ( ( ( const char* )this ) + DataPointIndex );
+        }
         
         ClientExtendedData::ClientExtendedData( void )
         {
@@ -149,13 +315,29 @@ namespace TerraSwarm
                                               const TNumberOfDataPoints numberOfDataPoints,
                                               TDataPoint* dataPoints )
         {
-            TDataSize totalDataSize = MessageHeader::MessageHeaderSize +
-            DataPointSize +
-            MessageEnder::EndOfMessageSize;
+            TDataSize dataSize = NumberOfDataPointsSize + DataPointSize * numberOfDataPoints;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
+            auto newMemory = CreateObjectArray<char>( totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
+            ( ( TNumberOfDataPointsAccessor* )newMemory )->Write( numberOfDataPoints );
+            ByteOrderConverter::HostToNetwork( newMemory + DataStartIndex, dataPoints, numberOfDataPoints );
+            ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
+            return ( newMemory );
+        }
+
+        SmartPointer<ClientExtendedData>
+        ClientExtendedData::GetNewClientData( const MessageHeader::TSenderId senderId,
+                                              const MessageHeader::TReceiverId receiverId,
+                                              const TNumberOfDataPoints numberOfDataPoints,
+                                              const PayloadEncoding & payloadEncoding,
+                                              const PayloadEncoding::TValue* values )
+        {
+            TDataSize dataSize = NumberOfDataPointsSize + payloadEncoding.GetPayloadSize( numberOfDataPoints );
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
             auto newMemory = CreateObjectArray<char>( totalDataSize );
-            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
             ( ( TNumberOfDataPointsAccessor* )newMemory )->Write( numberOfDataPoints );
-            memcpy( ( newMemory + DataStartIndex ), dataPoints, numberOfDataPoints * DataPointSize );
+            payloadEncoding.Encode( values, numberOfDataPoints, newMemory + DataStartIndex );
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
@@ -184,10 +366,32 @@ namespace TerraSwarm
         {
             TNumberOfDataPoints numberOfDataPoints = this->GetNumberOfDataPoints();
             auto dataPoints = CreateObjectArray<TDataPoint>( numberOfDataPoints );
-            memcpy( dataPoints, ( ( ( char* )this) + DataStartIndex ), numberOfDataPoints * DataPointSize );
+            this->GetDataPointView().CopyToHost( dataPoints );
             return ( dataPoints );
         }
 
+        ClientExtendedData::TDataPointView
+        ClientExtendedData::GetDataPointView( void ) const
+        {
+            return ( TDataPointView( ( ( const char* )this ) + DataStartIndex, this->GetNumberOfDataPoints() ) );
+        }
+
+        ClientExtendedData::TCheckResult
+        ClientExtendedData::CheckPayloadSize( const PayloadEncoding & payloadEncoding ) const
+        {
+            if ( ( ( MessageHeader* )this )->GetDataSize() == NumberOfDataPointsSize + payloadEncoding.GetPayloadSize( this->GetNumberOfDataPoints() ) )
+            {
+                return ( Success );
+            }
+            return ( Fail );
+        }
+
+        const void*
+        ClientExtendedData::GetPayload( void ) const
+        {
+            return ( ( ( const char* )this ) + DataStartIndex );
+        }
+
     } /* namespace Synchronous */
 
 } /* namespace TerraSwarm */
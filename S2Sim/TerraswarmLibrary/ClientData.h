@@ -0,0 +1,723 @@
+/**
+ * @file ClientData.h
+ * Defines the Async and Synchronous ClientData classes and messages.
+ *  Created on: Oct 13, 2013
+ *      Author: Alper
+ */
+
+#ifndef CLIENTDATA_H_
+#define CLIENTDATA_H_
+
+#include "MessageHeader.h"
+#include "MessageEnder.h"
+
+#include "SmartPointer.hpp"
+#include "NetworkArrayView.h"
+#include "PayloadEncoding.h"
+#include "TraceCodec.h"
+
+namespace TerraSwarm
+{
+    namespace Asynchronous
+    {
+
+        /**
+         *  Client Data message sent from asynchronous clients to S2Sim, containing the consumption forecast of the client.
+         */
+        class ClientData
+        {
+            private:
+            /**
+             *  Message header values.
+             */
+                enum HeaderValues
+                {
+                    MessageType = 0x0002,
+                    MessageId = 0x0001
+                };
+
+            public:
+            /**
+             *  Defines the message check result type.
+             */
+                typedef bool TCheckResult;
+
+            /**
+             *  Defines the values for TCheckResult.
+             */
+                enum CheckResultValues
+                {
+                    Success = ( TCheckResult )true, /**< Message is of correct type and id **/
+                    Fail = ( TCheckResult )false /**< Message has incorrect type or id **/
+                };
+
+            /**
+             *  Type for the start time of the data.
+             */
+                typedef unsigned int TStartTime;
+
+            /**
+             *  Type for the time resolution of the data.
+             */
+                typedef unsigned int TTimeResolution;
+
+            /**
+             *  Type for the number of data points.
+             */
+                typedef unsigned int TNumberOfDataPoints;
+
+            /**
+             *  Type for a single data point.
+             */
+                typedef unsigned int TDataPoint;
+
+            /**
+             *  Type for the data points read in place from the message.
+             */
+                typedef NetworkArrayView<TDataPoint> TDataPointView;
+
+            private:
+            /**
+             *  Size values for the data fields.
+             */
+                enum FieldSizeValues
+                {
+                    StartTimeSize = sizeof( TStartTime ),
+                    TimeResolutionSize = sizeof( TTimeResolution ),
+                    NumberOfDataPointsSize = sizeof( TNumberOfDataPoints ),
+                    DataPointSize = sizeof( TDataPoint )
+                };
+
+            /**
+             *  Index values for the data fields.
+             */
+                enum FieldIndexValues
+                {
+                    StartTimeIndex = MessageHeader::MessageHeaderSize,
+                    TimeResolutionIndex = StartTimeIndex + StartTimeSize,
+                    NumberOfDataPointsIndex = TimeResolutionIndex + TimeResolutionSize,
+                    DataStartIndex = NumberOfDataPointsIndex + NumberOfDataPointsSize
+                };
+
+            /**
+             *  Accessor helper for the StartTime field.
+             */
+                typedef NetworkByteAccessor<StartTimeIndex, StartTimeSize> TStartTimeAccessor;
+
+            /**
+             *  Accessor helper for the TimeResolution field.
+             */
+                typedef NetworkByteAccessor<TimeResolutionIndex, TimeResolutionSize> TTimeResolutionAccessor;
+
+            /**
+             *  Accessor helper for the NumberOfDataPoints field.
+             */
+                typedef NetworkByteAccessor<NumberOfDataPointsIndex, NumberOfDataPointsSize> TNumberOfDataPointsAccessor;
+
+            private:
+            /**
+             *  No use. Private constructor to force usage of the static creation method.
+             */
+                ClientData( void );
+
+            public:
+            /**
+             *  Deallocates the memory for the message.
+             */
+                ~ClientData( void );
+
+            /**
+             *  Creates a new ClientData message and allocates memory for it.
+             *
+             *  @param senderId           Id of the sender.
+             *  @param receiverId         Id of the receiver.
+             *  @param startTime          Start time of the data.
+             *  @param timeResolution     Time between two data points.
+             *  @param numberOfDataPoints Number of data points sent within the message.
+             *  @param dataPoints         Data points of the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<ClientData>
+                GetNewClientData( const MessageHeader::TSenderId senderId,
+                                  const MessageHeader::TReceiverId receiverId,
+                                  const TStartTime startTime,
+                                  const TTimeResolution timeResolution,
+                                  const TNumberOfDataPoints numberOfDataPoints,
+                                  TDataPoint* dataPoints );
+
+            /**
+             *  Creates a new ClientData message with the data points in the given encoding and allocates memory for it.
+             *
+             *  @param senderId           Id of the sender.
+             *  @param receiverId         Id of the receiver.
+             *  @param startTime          Start time of the data.
+             *  @param timeResolution     Time between two data points.
+             *  @param numberOfDataPoints Number of data points sent within the message.
+             *  @param payloadEncoding    Encoding negotiated in the ClientConnectionRequest.
+             *  @param values             Consumption values of the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<ClientData>
+                GetNewClientData( const MessageHeader::TSenderId senderId,
+                                  const MessageHeader::TReceiverId receiverId,
+                                  const TStartTime startTime,
+                                  const TTimeResolution timeResolution,
+                                  const TNumberOfDataPoints numberOfDataPoints,
+                                  const PayloadEncoding & payloadEncoding,
+                                  const PayloadEncoding::TValue* values );
+
+            /**
+             *  Checks whether the current memory contains a ClientData message.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckMessage( void ) const;
+
+            /**
+             *  Reads the StartTime field in the message.
+             *
+             *  @return Value of StartTime in the message.
+             */
+                TStartTime
+                GetStartTime( void ) const;
+
+            /**
+             *  Reads the TimeResolution field in the message.
+             *
+             *  @return Value of TimeResolution in the message.
+             */
+                TTimeResolution
+                GetTimeResolution( void ) const;
+
+            /**
+             *  Reads the NumberOfDataPoints field in the message.
+             *
+             *  @return Value of NumberOfDataPoints in the message.
+             */
+                TNumberOfDataPoints
+                GetNumberOfDataPoints( void ) const;
+
+            /**
+             *  Copies the data points in the message.
+             *
+             *  @return Data points in the message.
+             */
+                SmartPointer<TDataPoint>
+                GetDataPoints( void ) const;
+
+            /**
+             *  Returns a view of the data points without copying them. The view is valid as long as the message.
+             *
+             *  @return View of the data points in the message.
+             */
+                TDataPointView
+                GetDataPointView( void ) const;
+
+            /**
+             *  Checks whether the size of the message matches its number of data points in the given encoding. Must succeed before GetPayload() is decoded.
+             *
+             *  @param payloadEncoding Encoding negotiated by the client.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckPayloadSize( const PayloadEncoding & payloadEncoding ) const;
+
+            /**
+             *  Returns the data points as they are encoded in the message.
+             *
+             *  @return Pointer to the first byte of the data points.
+             */
+                const void*
+                GetPayload( void ) const;
+        };
+
+        /**
+         *  Compressed Client Data message sent from asynchronous clients to S2Sim. Contains the same consumption trace as ClientData, encoded with TraceCodec, for long traces.
+         */
+        class ClientCompressedData
+        {
+            private:
+            /**
+             *  Message header values.
+             */
+                enum HeaderValues
+                {
+                    MessageType = 0x0002,
+                    MessageId = 0x0002
+                };
+
+            public:
+            /**
+             *  Defines the message check result type.
+             */
+                typedef bool TCheckResult;
+
+            /**
+             *  Defines the values for TCheckResult.
+             */
+                enum CheckResultValues
+                {
+                    Success = ( TCheckResult )true, /**< Message is of correct type and id **/
+                    Fail = ( TCheckResult )false /**< Message has incorrect type or id **/
+                };
+
+            /**
+             *  Type for the start time of the data.
+             */
+                typedef unsigned int TStartTime;
+
+            /**
+             *  Type for the time resolution of the data.
+             */
+                typedef unsigned int TTimeResolution;
+
+            /**
+             *  Type for the number of data points.
+             */
+                typedef unsigned int TNumberOfDataPoints;
+
+            /**
+             *  Type for a single data point.
+             */
+                typedef TraceCodec::TValue TDataPoint;
+
+            /**
+             *  Type for the size of the encoded data points.
+             */
+                typedef unsigned int TEncodedSize;
+
+            private:
+            /**
+             *  Size values for the data fields.
+             */
+                enum FieldSizeValues
+                {
+                    StartTimeSize = sizeof( TStartTime ),
+                    TimeResolutionSize = sizeof( TTimeResolution ),
+                    NumberOfDataPointsSize = sizeof( TNumberOfDataPoints ),
+                    EncodedSizeSize = sizeof( TEncodedSize )
+                };
+
+            /**
+             *  Index values for the data fields.
+             */
+                enum FieldIndexValues
+                {
+                    StartTimeIndex = MessageHeader::MessageHeaderSize,
+                    TimeResolutionIndex = StartTimeIndex + StartTimeSize,
+                    NumberOfDataPointsIndex = TimeResolutionIndex + TimeResolutionSize,
+                    EncodedSizeIndex = NumberOfDataPointsIndex + NumberOfDataPointsSize,
+                    DataStartIndex = EncodedSizeIndex + EncodedSizeSize
+                };
+
+            /**
+             *  Accessor helper for the StartTime field.
+             */
+                typedef NetworkByteAccessor<StartTimeIndex, StartTimeSize> TStartTimeAccessor;
+
+            /**
+             *  Accessor helper for the TimeResolution field.
+             */
+                typedef NetworkByteAccessor<TimeResolutionIndex, TimeResolutionSize> TTimeResolutionAccessor;
+
+            /**
+             *  Accessor helper for the NumberOfDataPoints field.
+             */
+                typedef NetworkByteAccessor<NumberOfDataPointsIndex, NumberOfDataPointsSize> TNumberOfDataPointsAccessor;
+
+            /**
+             *  Accessor helper for the EncodedSize field.
+             */
+                typedef NetworkByteAccessor<EncodedSizeIndex, EncodedSizeSize> TEncodedSizeAccessor;
+
+            private:
+            /**
+             *  No use. Private constructor to force usage of the static creation method.
+             */
+                ClientCompressedData( void );
+
+            public:
+            /**
+             *  Deallocates the memory for the message.
+             */
+                ~ClientCompressedData( void );
+
+            /**
+             *  Creates a new ClientCompressedData message, compresses the data points into it and allocates memory for it.
+             *
+             *  @param senderId           Id of the sender.
+             *  @param receiverId         Id of the receiver.
+             *  @param startTime          Start time of the data.
+             *  @param timeResolution     Time between two data points.
+             *  @param numberOfDataPoints Number of data points sent within the message.
+             *  @param dataPoints         Data points of the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<ClientCompressedData>
+                GetNewClientCompressedData( const MessageHeader::TSenderId senderId,
+                                            const MessageHeader::TReceiverId receiverId,
+                                            const TStartTime startTime,
+                                            const TTimeResolution timeResolution,
+                                            const TNumberOfDataPoints numberOfDataPoints,
+                                            const TDataPoint* dataPoints );
+
+            /**
+             *  Checks whether the current memory contains a ClientCompressedData message.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckMessage( void ) const;
+
+            /**
+             *  Checks whether the encoded data points fit into the message. Must succeed before GetEncodedData() is read.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckEncodedSize( void ) const;
+
+            /**
+             *  Reads the StartTime field in the message.
+             *
+             *  @return Value of StartTime in the message.
+             */
+                TStartTime
+                GetStartTime( void ) const;
+
+            /**
+             *  Reads the TimeResolution field in the message.
+             *
+             *  @return Value of TimeResolution in the message.
+             */
+                TTimeResolution
+                GetTimeResolution( void ) const;
+
+            /**
+             *  Reads the NumberOfDataPoints field in the message.
+             *
+             *  @return Value of NumberOfDataPoints in the message.
+             */
+                TNumberOfDataPoints
+                GetNumberOfDataPoints( void ) const;
+
+            /**
+             *  Reads the EncodedSize field in the message.
+             *
+             *  @return Number of bytes of the encoded data points, without the padding.
+             */
+                TEncodedSize
+                GetEncodedSize( void ) const;
+
+            /**
+             *  Returns the encoded data points, to be read with TraceCodec::Decoder.
+             *
+             *  @return Pointer to the first byte of the encoded data points.
+             */
+                const void*
+                GetEncodedData( void ) const;
+        };
+
+    } /* namespace Asynchronous */
+
+    namespace Synchronous
+    {
+
+        /**
+         *  Client Data message sent from synchronous clients to S2Sim, containing the consumption of the current time step.
+         */
+        class ClientData
+        {
+            private:
+            /**
+             *  Message header values.
+             */
+                enum HeaderValues
+                {
+                    MessageType = 0x0003,
+                    MessageId = 0x0005
+                };
+
+            public:
+            /**
+             *  Defines the message check result type.
+             */
+                typedef bool TCheckResult;
+
+            /**
+             *  Defines the values for TCheckResult.
+             */
+                enum CheckResultValues
+                {
+                    Success = ( TCheckResult )true, /**< Message is of correct type and id **/
+                    Fail = ( TCheckResult )false /**< Message has incorrect type or id **/
+                };
+
+            /**
+             *  Type for a single data point.
+             */
+                typedef unsigned int TDataPoint;
+
+            private:
+            /**
+             *  Size values for the data fields.
+             */
+                enum FieldSizeValues
+                {
+                    DataPointSize = sizeof( TDataPoint )
+                };
+
+            /**
+             *  Index values for the data fields.
+             */
+                enum FieldIndexValues
+                {
+                    DataPointIndex = MessageHeader::MessageHeaderSize
+                };
+
+            /**
+             *  Accessor helper for the DataPoint field.
+             */
+                typedef NetworkByteAccessor<DataPointIndex, DataPointSize> TDataPointAccessor;
+
+            private:
+            /**
+             *  No use. Private constructor to force usage of the static creation method.
+             */
+                ClientData( void );
+
+            public:
+            /**
+             *  Deallocates the memory for the message.
+             */
+                ~ClientData( void );
+
+            /**
+             *  Creates a new ClientData message and allocates memory for it.
+             *
+             *  @param senderId   Id of the sender.
+             *  @param receiverId Id of the receiver.
+             *  @param dataPoint  Consumption of the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<ClientData>
+                GetNewClientData( const MessageHeader::TSenderId senderId,
+                                  const MessageHeader::TReceiverId receiverId,
+                                  TDataPoint dataPoint );
+
+            /**
+             *  Creates a new ClientData message with the consumption in the given encoding and allocates memory for it.
+             *
+             *  @param senderId        Id of the sender.
+             *  @param receiverId      Id of the receiver.
+             *  @param payloadEncoding Encoding negotiated in the ClientConnectionRequest.
+             *  @param value           Consumption of the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<ClientData>
+                GetNewClientData( const MessageHeader::TSenderId senderId,
+                                  const MessageHeader::TReceiverId receiverId,
+                                  const PayloadEncoding & payloadEncoding,
+                                  const PayloadEncoding::TValue value );
+
+            /**
+             *  Checks whether the current memory contains a ClientData message.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckMessage( void ) const;
+
+            /**
+             *  Reads the DataPoint field in the message.
+             *
+             *  @return Value of DataPoint in the message.
+             */
+                TDataPoint
+                GetDataPoint( void ) const;
+
+            /**
+             *  Returns the consumption as it is encoded in the message. A single value has the same size in every encoding.
+             *
+             *  @return Pointer to the first byte of the DataPoint field.
+             */
+                const void*
+                GetPayload( void ) const;
+        };
+
+        /**
+         *  Client Extended Data message sent from synchronous clients to S2Sim, containing the consumption forecast of the client starting with the current time step.
+         */
+        class ClientExtendedData
+        {
+            private:
+            /**
+             *  Message header values.
+             */
+                enum HeaderValues
+                {
+                    MessageType = 0x0003,
+                    MessageId = 0x0008
+                };
+
+            public:
+            /**
+             *  Defines the message check result type.
+             */
+                typedef bool TCheckResult;
+
+            /**
+             *  Defines the values for TCheckResult.
+             */
+                enum CheckResultValues
+                {
+                    Success = ( TCheckResult )true, /**< Message is of correct type and id **/
+                    Fail = ( TCheckResult )false /**< Message has incorrect type or id **/
+                };
+
+            /**
+             *  Type for the number of data points.
+             */
+                typedef unsigned int TNumberOfDataPoints;
+
+            /**
+             *  Type for a single data point.
+             */
+                typedef unsigned int TDataPoint;
+
+            /**
+             *  Type for the data points read in place from the message.
+             */
+                typedef NetworkArrayView<TDataPoint> TDataPointView;
+
+            private:
+            /**
+             *  Size values for the data fields.
+             */
+                enum FieldSizeValues
+                {
+                    NumberOfDataPointsSize = sizeof( TNumberOfDataPoints ),
+                    DataPointSize = sizeof( TDataPoint )
+                };
+
+            /**
+             *  Index values for the data fields.
+             */
+                enum FieldIndexValues
+                {
+                    NumberOfDataPointsIndex = MessageHeader::MessageHeaderSize,
+                    DataStartIndex = NumberOfDataPointsIndex + NumberOfDataPointsSize
+                };
+
+            /**
+             *  Accessor helper for the NumberOfDataPoints field.
+             */
+                typedef NetworkByteAccessor<NumberOfDataPointsIndex, NumberOfDataPointsSize> TNumberOfDataPointsAccessor;
+
+            private:
+            /**
+             *  No use. Private constructor to force usage of the static creation method.
+             */
+                ClientExtendedData( void );
+
+            public:
+            /**
+             *  Deallocates the memory for the message.
+             */
+                ~ClientExtendedData( void );
+
+            /**
+             *  Creates a new ClientExtendedData message and allocates memory for it.
+             *
+             *  @param senderId           Id of the sender.
+             *  @param receiverId         Id of the receiver.
+             *  @param numberOfDataPoints Number of data points sent within the message.
+             *  @param dataPoints         Data points of the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<ClientExtendedData>
+                GetNewClientData( const MessageHeader::TSenderId senderId,
+                                  const MessageHeader::TReceiverId receiverId,
+                                  const TNumberOfDataPoints numberOfDataPoints,
+                                  TDataPoint* dataPoints );
+
+            /**
+             *  Creates a new ClientExtendedData message with the data points in the given encoding and allocates memory for it.
+             *
+             *  @param senderId           Id of the sender.
+             *  @param receiverId         Id of the receiver.
+             *  @param numberOfDataPoints Number of data points sent within the message.
+             *  @param payloadEncoding    Encoding negotiated in the ClientConnectionRequest.
+             *  @param values             Consumption values of the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<ClientExtendedData>
+                GetNewClientData( const MessageHeader::TSenderId senderId,
+                                  const MessageHeader::TReceiverId receiverId,
+                                  const TNumberOfDataPoints numberOfDataPoints,
+                                  const PayloadEncoding & payloadEncoding,
+                                  const PayloadEncoding::TValue* values );
+
+            /**
+             *  Checks whether the current memory contains a ClientExtendedData message.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckMessage( void ) const;
+
+            /**
+             *  Reads the NumberOfDataPoints field in the message.
+             *
+             *  @return Value of NumberOfDataPoints in the message.
+             */
+                TNumberOfDataPoints
+                GetNumberOfDataPoints( void ) const;
+
+            /**
+             *  Copies the data points in the message.
+             *
+             *  @return Data points in the message.
+             */
+                SmartPointer<TDataPoint>
+                GetDataPoints( void ) const;
+
+            /**
+             *  Returns a view of the data points without copying them. The view is valid as long as the message.
+             *
+             *  @return View of the data points in the message.
+             */
+                TDataPointView
+                GetDataPointView( void ) const;
+
+            /**
+             *  Checks whether the size of the message matches its number of data points in the given encoding. Must succeed before GetPayload() is decoded.
+             *
+             *  @param payloadEncoding Encoding negotiated by the client.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckPayloadSize( const PayloadEncoding & payloadEncoding ) const;
+
+            /**
+             *  Returns the data points as they are encoded in the message.
+             *
+             *  @return Pointer to the first byte of the data points.
+             */
+                const void*
+                GetPayload( void ) const;
+        };
+
+    } /* namespace Synchronous */
+} /* namespace TerraSwarm */
+#endif /* CLIENTDATA_H_ */
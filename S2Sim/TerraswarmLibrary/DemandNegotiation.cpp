@@ -6,6 +6,7 @@
  */
 
 #include "DemandNegotiation.h"
+#include "ByteOrderConverter.h"
 
 namespace TerraSwarm
 {
@@ -25,14 +26,29 @@ namespace TerraSwarm
                                                     const TNumberOfDataPoints numberOfDataPoints,
                                                     TDataPoint* dataPoints )
         {
-            TDataSize totalDataSize = MessageHeader::MessageHeaderSize +
-                                      NumberOfDataPointsSize +
-                                      DataPointSize * numberOfDataPoints +
-                                      MessageEnder::EndOfMessageSize;
+            TDataSize dataSize = NumberOfDataPointsSize + DataPointSize * numberOfDataPoints;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
             auto newMemory = CreateObjectArray<char>( totalDataSize );
-            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
             ( ( TNumberOfDataPointsAccessor* )newMemory )->Write( numberOfDataPoints );
-            memcpy( ( newMemory + DataStartIndex ), dataPoints, DataPointSize * numberOfDataPoints );
+            ByteOrderConverter::HostToNetwork( newMemory + DataStartIndex, dataPoints, numberOfDataPoints );
+            ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
+            return ( newMemory );
+        }
+
+        SmartPointer<DemandNegotiation>
+        DemandNegotiation::GetNewDemandNegotiation( const MessageHeader::TSenderId senderId,
+                                                    const MessageHeader::TReceiverId receiverId,
+                                                    const TNumberOfDataPoints numberOfDataPoints,
+                                                    const PayloadEncoding & payloadEncoding,
+                                                    const PayloadEncoding::TValue* values )
+        {
+            TDataSize dataSize = NumberOfDataPointsSize + payloadEncoding.GetPayloadSize( numberOfDataPoints );
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
+            auto newMemory = CreateObjectArray<char>( totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
+            ( ( TNumberOfDataPointsAccessor* )newMemory )->Write( numberOfDataPoints );
+            payloadEncoding.Encode( values, numberOfDataPoints, newMemory + DataStartIndex );
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
@@ -61,8 +77,30 @@ namespace TerraSwarm
         {
             TNumberOfDataPoints numberOfDataPoints = this->GetNumberOfDataPoints();
             auto dataPoints = CreateObjectArray<TDataPoint>( numberOfDataPoints );
-            memcpy( dataPoints, ( ( char* )this ) + DataStartIndex, numberOfDataPoints * DataPointSize );
+            this->GetDataPointView().CopyToHost( dataPoints );
             return ( dataPoints );
         }
+
+        DemandNegotiation::TDataPointView
+        DemandNegotiation::GetDataPointView( void ) const
+        {
+            return ( TDataPointView( ( ( const char* )this ) + DataStartIndex, this->GetNumberOfDataPoints() ) );
+        }
+
+        DemandNegotiation::TCheckResult
+        DemandNegotiation::CheckPayloadSize( const PayloadEncoding & payloadEncoding ) const
+        {
+            if ( ( ( MessageHeader* )this )->GetDataSize() == NumberOfDataPointsSize + payloadEncoding.GetPayloadSize( this->GetNumberOfDataPoints() ) )
+            {
+                return ( Success );
+            }
+            return ( Fail );
+        }
+
+        const void*
+        DemandNegotiation::GetPayload( void ) const
+        {
+            return ( ( ( const char* )this ) + DataStartIndex );
+        }
     } /* namespace Synchronous */
 } /* namespace TerraSwarm */
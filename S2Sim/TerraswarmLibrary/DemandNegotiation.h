@@ -13,6 +13,8 @@
 #include <string.h>
 
 #include "SmartPointer.hpp"
+#include "NetworkArrayView.h"
+#include "PayloadEncoding.h"
 
 namespace TerraSwarm
 {
@@ -59,6 +61,11 @@ namespace TerraSwarm
              */
                 typedef unsigned int TDataPoint;
 
+            /**
+             *  Type for the data points read in place from the message.
+             */
+                typedef NetworkArrayView<TDataPoint> TDataPointView;
+
             private:
             /**
              *  Size of the fields in the message.
@@ -111,6 +118,24 @@ namespace TerraSwarm
                                          const TNumberOfDataPoints numberOfDataPoints,
                                          TDataPoint* dataPoints );
 
+            /**
+             *  Creates a new DemandNegotiation message with the data points in the given encoding and allocates the memory. @warning Dellocation is the responsibility of the user.
+             *
+             *  @param senderId           Id of the sender.
+             *  @param receiverId         Id of the receiver.
+             *  @param numberOfDataPoints Number of data points in the message.
+             *  @param payloadEncoding    Encoding negotiated in the ClientConnectionRequest.
+             *  @param values             Demand values of the client.
+             *
+             *  @return Pointer to the newly allocated message.
+             */
+                static SmartPointer<DemandNegotiation>
+                GetNewDemandNegotiation( const MessageHeader::TSenderId senderId,
+                                         const MessageHeader::TReceiverId receiverId,
+                                         const TNumberOfDataPoints numberOfDataPoints,
+                                         const PayloadEncoding & payloadEncoding,
+                                         const PayloadEncoding::TValue* values );
+
             /**
              *  Checks whether the current memory contains a DemandNegotiation message.
              *
@@ -134,6 +159,32 @@ namespace TerraSwarm
              */
                 SmartPointer<DemandNegotiation::TDataPoint>
                 GetDataPoints( void ) const;
+
+            /**
+             *  Returns a view of the data points without copying them. The view is valid as long as the message.
+             *
+             *  @return View of the data points in the message.
+             */
+                TDataPointView
+                GetDataPointView( void ) const;
+
+            /**
+             *  Checks whether the size of the message matches its number of data points in the given encoding. Must succeed before GetPayload() is decoded.
+             *
+             *  @param payloadEncoding Encoding negotiated by the client.
+             *
+             *  @return Result of the check.
+             */
+                TCheckResult
+                CheckPayloadSize( const PayloadEncoding & payloadEncoding ) const;
+
+            /**
+             *  Returns the data points as they are encoded in the message.
+             *
+             *  @return Pointer to the first byte of the data points.
+             */
+                const void*
+                GetPayload( void ) const;
         };
 
     } /* namespace Synchronous */
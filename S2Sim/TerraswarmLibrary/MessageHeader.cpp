@@ -30,21 +30,10 @@ namespace TerraSwarm
         this->Access<TStartOfMessageAccessor>()->Write( ( TStartOfMessage )StartOfMessageDefaultValue );
         this->Access<TSenderIdAccessor>()->Write( senderId );
         this->Access<TReceiverIdAccessor>()->Write( receiverId );
-        this->Access<TSequenceNumberAccessor>()->Write( GetNextSequenceNumber( senderId, receiverId ) );
+        this->Access<TSequenceNumberAccessor>()->Write( ( TSequenceNumber )0 );
         this->Access<TMessageTypeAccessor>()->Write( messageType );
         this->Access<TMessageIdAccessor>()->Write( messageId );
         this->Access<TDataSizeAccessor>()->Write( dataSize );
     }
 
-    MessageHeader::TSequenceNumber
-    MessageHeader::GetNextSequenceNumber( const TSenderId senderId, const TReceiverId receiverId )
-    {
-        typedef std::pair<TSenderId,TReceiverId> TIdPair;
-        typedef std::map<TIdPair, TSequenceNumber> TIdPairMap;
-        static TIdPairMap idPairMap;
-        TSequenceNumber sequenceNumber = idPairMap[std::make_pair( senderId, receiverId )];
-        ++idPairMap[std::make_pair( senderId, receiverId )];
-        return ( sequenceNumber );
-    }
-
 } /* namespace TerraSwarm */
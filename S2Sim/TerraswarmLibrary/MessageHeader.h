@@ -9,7 +9,6 @@
 #define MESSAGEHEADER_H_
 
 #include "NetworkByteAccessor.h"
-#include <map>
 
 #include "SmartPointer.hpp"
 
@@ -46,6 +45,11 @@ namespace TerraSwarm
          */
             typedef unsigned short TMessageId;
 
+        /**
+         *  Defines the message sequence number.
+         */
+            typedef unsigned int TSequenceNumber;
+
         private:
         /**
          *  Indicates the start of the message.
@@ -60,22 +64,6 @@ namespace TerraSwarm
                 StartOfMessageDefaultValue = ( TStartOfMessage )0x12345678 /**< Only possible value for SOM */
             };
 
-        /**
-         *  Defines the message sequence number.
-         */
-            typedef unsigned int TSequenceNumber;
-
-        /**
-         *  Static function to get the next sequence number as the sequence number is sender unique, not message unique.
-         *
-         *  @param senderId   Id of the sender.
-         *  @param receiverId Id of the intended receiver.
-         *
-         *  @return Next available sequence number.
-         */
-            static TSequenceNumber
-            GetNextSequenceNumber( const TSenderId senderId, const TReceiverId receiverId );
-
         /**
          *  Size of the header fields.
          */
@@ -197,7 +185,7 @@ namespace TerraSwarm
             GetNewMessageHeader( void );
 
         /**
-         *  Sets all the fields of the message header and prepares it.
+         *  Sets all the fields of the message header and prepares it. The sequence number is set to 0, the connection sending the message assigns the actual value with SetSequenceNumber().
          *
          *  @param senderId    Id of the sender.
          *  @param receiverId  Id of the receiver.
@@ -238,6 +226,30 @@ namespace TerraSwarm
                 return ( value );
             }
 
+        /**
+         *  Gets the Sequence Number.
+         *
+         *  @return Sequence Number field value.
+         */
+            TSequenceNumber
+            GetSequenceNumber( void ) const
+            {
+                TSequenceNumber value;
+                this->Access<TSequenceNumberAccessor>()->Read( value );
+                return ( value );
+            }
+
+        /**
+         *  Sets the Sequence Number.
+         *
+         *  @param sequenceNumber Sequence number of the message on its connection.
+         */
+            void
+            SetSequenceNumber( const TSequenceNumber sequenceNumber )
+            {
+                this->Access<TSequenceNumberAccessor>()->Write( sequenceNumber );
+            }
+
         /**
          *  Gets the message type.
          *
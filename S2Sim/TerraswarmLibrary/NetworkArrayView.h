@@ -0,0 +1,258 @@
+/**
+ * @file NetworkArrayView.h
+ * Defines the NetworkArrayView class for reading array payloads in place.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef NETWORKARRAYVIEW_H_
+#define NETWORKARRAYVIEW_H_
+
+#include <string.h>
+#include <iterator>
+#if ( defined(_WIN32) || defined(_WIN64) )
+#include <winsock2.h>
+#elif ( defined(__linux__) || defined(__APPLE__) )
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
+#include "CompileTimeCheckerLibrary.h"
+#include "ByteOrderConverter.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Non-owning view of an array of 32 bit values in network byte order.
+
+        The view points into a message, e.g. the receive buffer, and converts an element to host byte order only when it is read. Nothing is allocated or copied, so the message must outlive the view. Elements can be interleaved with other fields by giving a stride larger than the element size.
+
+        @tparam TElement Type of the elements, must be 4 bytes long.
+     */
+    template <typename TElement>
+    class NetworkArrayView
+    {
+        public:
+        /**
+         *  Defines the type of the number of elements.
+         */
+            typedef unsigned int TNumberOfElements;
+
+        /**
+         *  Defines the type of the distance between consecutive elements in bytes.
+         */
+            typedef unsigned int TStride;
+
+        /**
+         *  @brief Iterator reading the elements in order.
+
+            Dereferencing returns the converted value, not a reference, so the iterator is an input iterator.
+         */
+            class ConstIterator
+            {
+                public:
+                    typedef std::input_iterator_tag iterator_category;
+                    typedef TElement value_type;
+                    typedef long difference_type;
+                    typedef const TElement* pointer;
+                    typedef TElement reference;
+
+                private:
+                /**
+                 *  First byte of the current element.
+                 */
+                    const char* m_address;
+
+                /**
+                 *  Distance between consecutive elements in bytes.
+                 */
+                    TStride m_stride;
+
+                public:
+                /**
+                 *  Creates an iterator at the given element.
+                 *
+                 *  @param address First byte of the element.
+                 *  @param stride Distance between consecutive elements in bytes.
+                 */
+                    ConstIterator( const char* address, const TStride stride ) : m_address( address ), m_stride( stride )
+                    {
+                    }
+
+                    TElement
+                    operator *( void ) const
+                    {
+                        TElement value;
+                        memcpy( &value, this->m_address, sizeof( TElement ) );
+                        return ( ( TElement )ntohl( value ) );
+                    }
+
+                    ConstIterator &
+                    operator ++( void )
+                    {
+                        this->m_address += this->m_stride;
+                        return ( *this );
+                    }
+
+                    ConstIterator
+                    operator ++( int )
+                    {
+                        ConstIterator previous( *this );
+                        this->m_address += this->m_stride;
+                        return ( previous );
+                    }
+
+                    bool
+                    operator ==( const ConstIterator & other ) const
+                    {
+                        return ( this->m_address == other.m_address );
+                    }
+
+                    bool
+                    operator !=( const ConstIterator & other ) const
+                    {
+                        return ( this->m_address != other.m_address );
+                    }
+            };
+
+        private:
+        /**
+         *  First byte of the first element.
+         */
+            const char* m_address;
+
+        /**
+         *  Number of elements in the view.
+         */
+            TNumberOfElements m_numberOfElements;
+
+        /**
+         *  Distance between consecutive elements in bytes.
+         */
+            TStride m_stride;
+
+        public:
+        /**
+         *  Creates an empty view.
+         */
+            NetworkArrayView( void ) : m_address( nullptr ), m_numberOfElements( 0 ), m_stride( sizeof( TElement ) )
+            {
+                SizeCheck<TElement, 4>::Check();
+            }
+
+        /**
+         *  Creates a view over the given memory.
+         *
+         *  @param address First byte of the first element.
+         *  @param numberOfElements Number of elements.
+         *  @param stride Distance between consecutive elements in bytes, the element size for a contiguous array.
+         */
+            NetworkArrayView( const void* address, const TNumberOfElements numberOfElements, const TStride stride = sizeof( TElement ) ) : m_address( ( const char* )address ),
+                                                                                                                                          m_numberOfElements( numberOfElements ),
+                                                                                                                                          m_stride( stride )
+            {
+                SizeCheck<TElement, 4>::Check();
+            }
+
+        /**
+         *  Returns the number of elements.
+         *
+         *  @return Number of elements.
+         */
+            TNumberOfElements
+            GetNumberOfElements( void ) const
+            {
+                return ( this->m_numberOfElements );
+            }
+
+        /**
+         *  Checks whether the elements follow each other without gaps.
+         *
+         *  @return true if the stride is the element size.
+         */
+            bool
+            IsContiguous( void ) const
+            {
+                return ( this->m_stride == sizeof( TElement ) );
+            }
+
+        /**
+         *  Reads an element in host byte order. The index is not checked.
+         *
+         *  @param index Index of the element.
+         *
+         *  @return Converted element.
+         */
+            TElement
+            operator []( const TNumberOfElements index ) const
+            {
+                return ( *ConstIterator( this->m_address + index * this->m_stride, this->m_stride ) );
+            }
+
+        /**
+         *  Returns an iterator at the first element.
+         *
+         *  @return Iterator at the first element.
+         */
+            ConstIterator
+            begin( void ) const
+            {
+                return ( ConstIterator( this->m_address, this->m_stride ) );
+            }
+
+        /**
+         *  Returns an iterator after the last element.
+         *
+         *  @return Iterator after the last element.
+         */
+            ConstIterator
+            end( void ) const
+            {
+                return ( ConstIterator( this->m_address + this->m_numberOfElements * this->m_stride, this->m_stride ) );
+            }
+
+        /**
+         *  Copies all the elements in host byte order, with the bulk kernel if the elements are contiguous.
+         *
+         *  @param destination Array with at least GetNumberOfElements() elements.
+         */
+            void
+            CopyToHost( TElement* destination ) const
+            {
+                if ( this->IsContiguous() )
+                {
+                    ByteOrderConverter::NetworkToHost( destination, this->m_address, this->m_numberOfElements );
+                    return;
+                }
+                for ( ConstIterator element = this->begin(); element != this->end(); ++element )
+                {
+                    *destination++ = *element;
+                }
+            }
+
+        /**
+         *  Copies all the elements without conversion, e.g. to forward them in another message.
+         *
+         *  @param destination Memory with room for GetNumberOfElements() elements, does not need to be aligned.
+         */
+            void
+            CopyToNetwork( void* destination ) const
+            {
+                if ( this->IsContiguous() )
+                {
+                    memcpy( destination, this->m_address, this->m_numberOfElements * sizeof( TElement ) );
+                    return;
+                }
+                char* currentDestination = ( char* )destination;
+                const char* currentSource = this->m_address;
+                for ( TNumberOfElements index = 0; index < this->m_numberOfElements; ++index )
+                {
+                    memcpy( currentDestination, currentSource, sizeof( TElement ) );
+                    currentDestination += sizeof( TElement );
+                    currentSource += this->m_stride;
+                }
+            }
+    };
+} /* namespace TerraSwarm */
+
+#endif /* NETWORKARRAYVIEW_H_ */
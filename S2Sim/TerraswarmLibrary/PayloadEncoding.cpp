@@ -0,0 +1,179 @@
+/**
+ * @file PayloadEncoding.cpp
+ * Implements the PayloadEncoding class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "PayloadEncoding.h"
+
+namespace TerraSwarm
+{
+    PayloadEncoding::PayloadEncoding( const TEncoding encoding, const TFractionalBits fractionalBits ) : m_encoding( encoding ),
+                                                                                                        m_fractionalBits( fractionalBits )
+    {
+    }
+
+    long long
+    PayloadEncoding::ToScaled( const TValue value, const long long minimumValue, const long long maximumValue ) const
+    {
+        TValue scaledValue = std::ldexp( value, this->m_fractionalBits );
+        if ( !( scaledValue > ( TValue )minimumValue ) )
+        {
+            return ( minimumValue );
+        }
+        return ( std::min( std::llround( std::min( scaledValue, ( TValue )maximumValue ) ), maximumValue ) );
+    }
+
+    bool
+    PayloadEncoding::IsSupported( void ) const
+    {
+        switch ( this->m_encoding )
+        {
+            case IntegerEncoding:
+                return ( this->m_fractionalBits == 0 );
+            case FloatEncoding:
+            case FixedPointEncoding:
+            case DeltaEncoding:
+                return ( this->m_fractionalBits <= MaximumFractionalBits );
+            default:
+                return ( false );
+        }
+    }
+
+    TDataSize
+    PayloadEncoding::GetPayloadSize( const TNumberOfValues numberOfValues ) const
+    {
+        if ( this->m_encoding != DeltaEncoding )
+        {
+            return ( numberOfValues * ValueSize );
+        }
+        if ( numberOfValues == 0 )
+        {
+            return ( 0 );
+        }
+        TDataSize deltaSize = ( numberOfValues - 1 ) * DeltaSize;
+        return ( ValueSize + ( deltaSize + ValueSize - 1 ) / ValueSize * ValueSize );
+    }
+
+    void
+    PayloadEncoding::Encode( const TValue* values, const TNumberOfValues numberOfValues, void* destination ) const
+    {
+        const long long maximumUnsigned = std::numeric_limits<TScaledValue>::max();
+        char* currentDestination = ( char* )destination;
+        if ( this->m_encoding == DeltaEncoding )
+        {
+            memset( destination, 0x00, this->GetPayloadSize( numberOfValues ) );
+            if ( numberOfValues == 0 )
+            {
+                return;
+            }
+            long long encodedValue = this->ToScaled( values[0], 0, maximumUnsigned );
+            TScaledValue convertedValue = htonl( ( TScaledValue )encodedValue );
+            memcpy( currentDestination, &convertedValue, ValueSize );
+            currentDestination += ValueSize;
+            for ( TNumberOfValues index = 1; index < numberOfValues; ++index )
+            {
+                long long delta = this->ToScaled( values[index], 0, maximumUnsigned ) - encodedValue;
+                delta = std::max( std::min( delta, ( long long )std::numeric_limits<short>::max() ), ( long long )std::numeric_limits<short>::min() );
+                encodedValue += delta;
+                unsigned short convertedDelta = htons( ( unsigned short )delta );
+                memcpy( currentDestination, &convertedDelta, DeltaSize );
+                currentDestination += DeltaSize;
+            }
+            return;
+        }
+
+        for ( TNumberOfValues index = 0; index < numberOfValues; ++index )
+        {
+            TScaledValue encodedValue;
+            if ( this->m_encoding == FloatEncoding )
+            {
+                float floatValue = ( float )values[index];
+                memcpy( &encodedValue, &floatValue, ValueSize );
+            }
+            else if ( this->m_encoding == FixedPointEncoding )
+            {
+                encodedValue = ( TScaledValue )this->ToScaled( values[index], std::numeric_limits<int>::min(), std::numeric_limits<int>::max() );
+            }
+            else
+            {
+                encodedValue = ( TScaledValue )this->ToScaled( values[index], 0, maximumUnsigned );
+            }
+            encodedValue = htonl( encodedValue );
+            memcpy( currentDestination, &encodedValue, ValueSize );
+            currentDestination += ValueSize;
+        }
+    }
+
+    void
+    PayloadEncoding::DecodeToScaledPayload( const void* source, const TNumberOfValues numberOfValues, void* destination ) const
+    {
+        if ( this->m_encoding == IntegerEncoding || numberOfValues == 0 )
+        {
+            memcpy( destination, source, numberOfValues * ValueSize );
+            return;
+        }
+
+        const long long maximumUnsigned = std::numeric_limits<TScaledValue>::max();
+        const char* currentSource = ( const char* )source;
+        char* currentDestination = ( char* )destination;
+        long long decodedValue = 0;
+        for ( TNumberOfValues index = 0; index < numberOfValues; ++index )
+        {
+            if ( this->m_encoding == DeltaEncoding && index > 0 )
+            {
+                unsigned short delta;
+                memcpy( &delta, currentSource, DeltaSize );
+                currentSource += DeltaSize;
+                decodedValue += ( short )ntohs( delta );
+            }
+            else
+            {
+                TScaledValue encodedValue;
+                memcpy( &encodedValue, currentSource, ValueSize );
+                currentSource += ValueSize;
+                encodedValue = ntohl( encodedValue );
+                if ( this->m_encoding == FloatEncoding )
+                {
+                    float floatValue;
+                    memcpy( &floatValue, &encodedValue, ValueSize );
+                    decodedValue = this->ToScaled( floatValue, 0, maximumUnsigned );
+                }
+                else if ( this->m_encoding == FixedPointEncoding )
+                {
+                    decodedValue = ( int )encodedValue;
+                }
+                else
+                {
+                    decodedValue = encodedValue;
+                }
+            }
+            decodedValue = std::max( std::min( decodedValue, maximumUnsigned ), 0LL );
+            TScaledValue scaledValue = htonl( ( TScaledValue )decodedValue );
+            memcpy( currentDestination, &scaledValue, ValueSize );
+            currentDestination += ValueSize;
+        }
+    }
+
+    PayloadEncoding::TScaledValue
+    PayloadEncoding::ToInteger( const TScaledValue scaledValue, const TFractionalBits fractionalBits )
+    {
+        return ( Rescale( scaledValue, fractionalBits, 0 ) );
+    }
+
+    PayloadEncoding::TScaledValue
+    PayloadEncoding::Rescale( const TScaledValue scaledValue, const TFractionalBits fractionalBits, const TFractionalBits targetFractionalBits )
+    {
+        if ( targetFractionalBits >= fractionalBits )
+        {
+            unsigned long long rescaledValue = ( unsigned long long )scaledValue << ( targetFractionalBits - fractionalBits );
+            return ( ( TScaledValue )std::min( rescaledValue, ( unsigned long long )std::numeric_limits<TScaledValue>::max() ) );
+        }
+        TFractionalBits shift = fractionalBits - targetFractionalBits;
+        return ( ( TScaledValue )( ( ( unsigned long long )scaledValue + ( 1ULL << ( shift - 1 ) ) ) >> shift ) );
+    }
+} /* namespace TerraSwarm */
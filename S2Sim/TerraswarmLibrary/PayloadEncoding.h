@@ -0,0 +1,202 @@
+/**
+ * @file PayloadEncoding.h
+ * Defines the PayloadEncoding class negotiated by the clients for their consumption values.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef PAYLOADENCODING_H_
+#define PAYLOADENCODING_H_
+
+#include "NetworkByteAccessor.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Encoding of the consumption values in the data messages of a client.
+
+        A client chooses the encoding and its number of fractional bits in its ClientConnectionRequest, and uses it for the data points of ClientData, ClientExtendedData, Asynchronous::ClientData and DemandNegotiation. Clients that do not choose one send integers, as before.
+
+        S2Sim decodes a payload to scaled values, unsigned 32 bit integers in units of 2^-fractionalBits watts, so the fractional part is kept. Negative values are saturated at 0, as consumptions are not negative.
+
+        - IntegerEncoding: 32 bit unsigned integers without fractional bits, read in place.
+        - FloatEncoding: 32 bit IEEE 754 floats, kept with the announced number of fractional bits.
+        - FixedPointEncoding: 32 bit signed fixed-point values with the announced number of fractional bits.
+        - DeltaEncoding: The first value as an unsigned fixed-point value, followed by 16 bit signed differences between consecutive fixed-point values, padded to 4 bytes. Intended for high-frequency meters with small changes. A change beyond the 16 bit range is sent over the following differences, so a client with larger steps should use another encoding.
+
+        All the fields are in network byte order.
+     */
+    class PayloadEncoding
+    {
+        public:
+        /**
+         *  Defines the encoding type.
+         */
+            typedef unsigned short TEncoding;
+
+        /**
+         *  Defines the type of the number of fractional bits.
+         */
+            typedef unsigned short TFractionalBits;
+
+        /**
+         *  Defines the type of the number of values in a payload.
+         */
+            typedef unsigned int TNumberOfValues;
+
+        /**
+         *  Defines the type of a value before encoding.
+         */
+            typedef double TValue;
+
+        /**
+         *  Defines the type of a decoded value, in units of 2^-fractionalBits.
+         */
+            typedef unsigned int TScaledValue;
+
+        /**
+         *  Values of the encoding type.
+         */
+            enum EncodingValues
+            {
+                IntegerEncoding = ( TEncoding )0x0000, /**< 32 bit unsigned integers, the default. */
+                FloatEncoding = ( TEncoding )0x0001, /**< 32 bit IEEE 754 floats. */
+                FixedPointEncoding = ( TEncoding )0x0002, /**< 32 bit signed fixed-point values. */
+                DeltaEncoding = ( TEncoding )0x0003 /**< One fixed-point value followed by 16 bit differences. */
+            };
+
+        /**
+         *  Limits of the encoding parameters.
+         */
+            enum LimitValues
+            {
+                MaximumFractionalBits = ( TFractionalBits )16 /**< Largest number of fractional bits, leaving 16 bits for the watts of a scaled value. */
+            };
+
+        private:
+        /**
+         *  Size values of the encoded fields.
+         */
+            enum FieldSizeValues
+            {
+                ValueSize = 4,
+                DeltaSize = 2
+            };
+
+        /**
+         *  Selected encoding.
+         */
+            TEncoding m_encoding;
+
+        /**
+         *  Number of fractional bits of the values.
+         */
+            TFractionalBits m_fractionalBits;
+
+        /**
+         *  Scales and rounds a value, saturating between the given limits.
+         *
+         *  @param value        Value to be scaled.
+         *  @param minimumValue Smallest scaled value.
+         *  @param maximumValue Largest scaled value.
+         *
+         *  @return Scaled value.
+         */
+            long long
+            ToScaled( const TValue value, const long long minimumValue, const long long maximumValue ) const;
+
+        public:
+        /**
+         *  Creates an encoding.
+         *
+         *  @param encoding       Selected encoding.
+         *  @param fractionalBits Number of fractional bits of the values.
+         */
+            PayloadEncoding( const TEncoding encoding = IntegerEncoding, const TFractionalBits fractionalBits = 0 );
+
+        /**
+         *  Returns the selected encoding.
+         *
+         *  @return Selected encoding.
+         */
+            TEncoding
+            GetEncoding( void ) const
+            {
+                return ( this->m_encoding );
+            }
+
+        /**
+         *  Returns the number of fractional bits of the values.
+         *
+         *  @return Number of fractional bits.
+         */
+            TFractionalBits
+            GetFractionalBits( void ) const
+            {
+                return ( this->m_fractionalBits );
+            }
+
+        /**
+         *  Checks whether the encoding is known and its number of fractional bits is valid.
+         *
+         *  @return true if the encoding can be used.
+         */
+            bool
+            IsSupported( void ) const;
+
+        /**
+         *  Returns the number of payload bytes used for the given number of values, including the padding.
+         *
+         *  @param numberOfValues Number of values.
+         *
+         *  @return Size of the payload.
+         */
+            TDataSize
+            GetPayloadSize( const TNumberOfValues numberOfValues ) const;
+
+        /**
+         *  Encodes values into a payload, rounding them to the fractional bits.
+         *
+         *  @param values         Values to be encoded.
+         *  @param numberOfValues Number of values.
+         *  @param destination    Memory of GetPayloadSize() bytes, does not need to be aligned.
+         */
+            void
+            Encode( const TValue* values, const TNumberOfValues numberOfValues, void* destination ) const;
+
+        /**
+         *  Expands a payload of this encoding to a payload of scaled values of 4 bytes each. A value below 0 or above the limit of 32 bits is saturated.
+         *
+         *  @param source         Payload of GetPayloadSize() bytes.
+         *  @param numberOfValues Number of values.
+         *  @param destination    Memory for the scaled payload of 4 bytes per value.
+         */
+            void
+            DecodeToScaledPayload( const void* source, const TNumberOfValues numberOfValues, void* destination ) const;
+
+        /**
+         *  Rounds a scaled value to watts.
+         *
+         *  @param scaledValue    Value in units of 2^-fractionalBits.
+         *  @param fractionalBits Number of fractional bits of the value.
+         *
+         *  @return Rounded value.
+         */
+            static TScaledValue
+            ToInteger( const TScaledValue scaledValue, const TFractionalBits fractionalBits );
+
+        /**
+         *  Converts a scaled value between numbers of fractional bits, rounding and saturating it.
+         *
+         *  @param scaledValue          Value in units of 2^-fractionalBits.
+         *  @param fractionalBits       Number of fractional bits of the value.
+         *  @param targetFractionalBits Number of fractional bits of the result.
+         *
+         *  @return Converted value.
+         */
+            static TScaledValue
+            Rescale( const TScaledValue scaledValue, const TFractionalBits fractionalBits, const TFractionalBits targetFractionalBits );
+    };
+} /* namespace TerraSwarm */
+
+#endif /* PAYLOADENCODING_H_ */
@@ -0,0 +1,60 @@
+/**
+ * @file SequenceCounter.cpp
+ * Implements the SequenceCounter class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "SequenceCounter.h"
+
+namespace TerraSwarm
+{
+
+    SequenceCounter::SequenceCounter( const TGapDetection gapDetection ) : m_nextSequenceNumber( 0 ),
+                                                                         m_gapDetection( gapDetection ),
+                                                                         m_firstMessageReceived( false ),
+                                                                         m_expectedSequenceNumber( 0 ),
+                                                                         m_receivedMessages( 0 ),
+                                                                         m_missingMessages( 0 ),
+                                                                         m_reorderedMessages( 0 )
+    {
+    }
+
+    SequenceCounter::TSequenceNumber
+    SequenceCounter::Stamp( void* message )
+    {
+        TSequenceNumber sequenceNumber = this->m_nextSequenceNumber.fetch_add( 1, std::memory_order_relaxed );
+        ( ( MessageHeader* )message )->SetSequenceNumber( sequenceNumber );
+        return ( sequenceNumber );
+    }
+
+    SequenceCounter::TCounter
+    SequenceCounter::CheckIncoming( const void* message )
+    {
+        if ( this->m_gapDetection == GapDetectionDisabled )
+        {
+            return ( 0 );
+        }
+
+        TSequenceNumber sequenceNumber = ( ( const MessageHeader* )message )->GetSequenceNumber();
+        this->m_receivedMessages.fetch_add( 1, std::memory_order_relaxed );
+        if ( !this->m_firstMessageReceived )
+        {
+            this->m_firstMessageReceived = true;
+            this->m_expectedSequenceNumber = sequenceNumber + 1;
+            return ( 0 );
+        }
+
+        TSequenceNumber difference = sequenceNumber - this->m_expectedSequenceNumber;
+        if ( difference >= 0x80000000u )
+        {
+            this->m_reorderedMessages.fetch_add( 1, std::memory_order_relaxed );
+            return ( 0 );
+        }
+
+        this->m_missingMessages.fetch_add( difference, std::memory_order_relaxed );
+        this->m_expectedSequenceNumber = sequenceNumber + 1;
+        return ( difference );
+    }
+
+} /* namespace TerraSwarm */
@@ -0,0 +1,158 @@
+/**
+ * @file SequenceCounter.h
+ * Defines the SequenceCounter class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef SEQUENCECOUNTER_H_
+#define SEQUENCECOUNTER_H_
+
+#include <atomic>
+#include "MessageHeader.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Sequence number state of a single connection.
+
+        Each connection owns one SequenceCounter. Outgoing messages are numbered with a single atomic counter when they are sent, so numbering costs the same for any number of connections and the state is freed with the connection. Incoming messages can optionally be checked for gaps to measure dropped or reordered frames.
+     */
+    class SequenceCounter
+    {
+        public:
+        /**
+         *  Defines the sequence number type.
+         */
+            typedef MessageHeader::TSequenceNumber TSequenceNumber;
+
+        /**
+         *  Defines the type of the message counters.
+         */
+            typedef unsigned long long TCounter;
+
+        /**
+         *  Defines the gap detection setting type.
+         */
+            typedef bool TGapDetection;
+
+        /**
+         *  Values of the gap detection setting.
+         */
+            enum GapDetectionValues
+            {
+                GapDetectionEnabled = ( TGapDetection )true, /**< Incoming sequence numbers are checked. */
+                GapDetectionDisabled = ( TGapDetection )false /**< Incoming sequence numbers are ignored, e.g. for peers that always send 0. */
+            };
+
+        private:
+        /**
+         *  Sequence number of the next outgoing message.
+         */
+            std::atomic<TSequenceNumber> m_nextSequenceNumber;
+
+        /**
+         *  Whether incoming messages are checked for gaps.
+         */
+            TGapDetection m_gapDetection;
+
+        /**
+         *  Whether an incoming message was checked before, the first message sets the expected sequence number.
+         */
+            bool m_firstMessageReceived;
+
+        /**
+         *  Sequence number expected with the next incoming message.
+         */
+            TSequenceNumber m_expectedSequenceNumber;
+
+        /**
+         *  Number of checked incoming messages.
+         */
+            std::atomic<TCounter> m_receivedMessages;
+
+        /**
+         *  Number of incoming messages skipped by the peer's sequence numbers.
+         */
+            std::atomic<TCounter> m_missingMessages;
+
+        /**
+         *  Number of incoming messages that arrived with an old sequence number.
+         */
+            std::atomic<TCounter> m_reorderedMessages;
+
+        public:
+        /**
+         *  Creates the state of a new connection.
+         *
+         *  @param gapDetection Whether incoming messages are checked for gaps.
+         */
+            explicit SequenceCounter( const TGapDetection gapDetection = GapDetectionDisabled );
+
+        /**
+         *  Writes the next sequence number into an outgoing message. Thread safe, but the numbers reach the wire in order only if concurrent senders stamp and send under one lock.
+         *
+         *  @param message Message starting with a MessageHeader.
+         *
+         *  @return Sequence number written into the message.
+         */
+            TSequenceNumber
+            Stamp( void* message );
+
+        /**
+         *  Checks the sequence number of an incoming message against the expected one. Sequence numbers wrap around, a number less than 2^31 behind the expected one counts as reordered. Must be called from a single receiving thread.
+         *
+         *  @param message Message starting with a MessageHeader.
+         *
+         *  @return Number of messages missing before this message, 0 if gap detection is disabled.
+         */
+            TCounter
+            CheckIncoming( const void* message );
+
+        /**
+         *  Enables or disables the gap detection.
+         *
+         *  @param gapDetection New setting.
+         */
+            void
+            SetGapDetection( const TGapDetection gapDetection )
+            {
+                this->m_gapDetection = gapDetection;
+            }
+
+        /**
+         *  Returns the number of checked incoming messages.
+         *
+         *  @return Number of checked messages.
+         */
+            TCounter
+            GetReceivedMessages( void ) const
+            {
+                return ( this->m_receivedMessages.load( std::memory_order_relaxed ) );
+            }
+
+        /**
+         *  Returns the number of incoming messages missing in the sequence.
+         *
+         *  @return Number of missing messages.
+         */
+            TCounter
+            GetMissingMessages( void ) const
+            {
+                return ( this->m_missingMessages.load( std::memory_order_relaxed ) );
+            }
+
+        /**
+         *  Returns the number of incoming messages with an old sequence number.
+         *
+         *  @return Number of reordered or duplicated messages.
+         */
+            TCounter
+            GetReorderedMessages( void ) const
+            {
+                return ( this->m_reorderedMessages.load( std::memory_order_relaxed ) );
+            }
+    };
+} /* namespace TerraSwarm */
+
+#endif /* SEQUENCECOUNTER_H_ */
@@ -6,6 +6,7 @@
  */
 
 #include "SetCurrentPrice.h"
+#include "ByteOrderConverter.h"
 
 namespace TerraSwarm
 {
@@ -32,7 +33,25 @@ namespace TerraSwarm
             ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
             ( ( TIntervalBeginAccessor* )newMemory )->Write( intervalBegin );
             ( ( TNumberOfPricePointsAccessor* )newMemory )->Write( numberOfPricePoints );
-            memcpy( ( newMemory + PricePointsIndex ), pricePoints, PriceSize * numberOfPricePoints );
+            ByteOrderConverter::HostToNetwork( newMemory + PricePointsIndex, pricePoints, numberOfPricePoints );
+            ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
+            return ( newMemory );
+        }
+
+        SmartPointer<SetCurrentPrice>
+        SetCurrentPrice::GetNewSetCurrentPrice( const MessageHeader::TSenderId senderId,
+                                                const MessageHeader::TReceiverId receiverId,
+                                                const TInterval intervalBegin,
+                                                const TPriceView & pricePoints )
+        {
+            TNumberOfPricePoints numberOfPricePoints = pricePoints.GetNumberOfElements();
+            TDataSize dataSize = IntervalBeginSize + NumberOfPricePointsSize + numberOfPricePoints * PriceSize;
+            TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
+            auto newMemory = CreateObjectArray<char>( totalDataSize );
+            ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
+            ( ( TIntervalBeginAccessor* )newMemory )->Write( intervalBegin );
+            ( ( TNumberOfPricePointsAccessor* )newMemory )->Write( numberOfPricePoints );
+            pricePoints.CopyToNetwork( newMemory + PricePointsIndex );
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
@@ -53,10 +72,16 @@ namespace TerraSwarm
         {
             TNumberOfPricePoints numberOfPricePoints = this->GetNumberOfPricePoints();
             auto values = CreateObjectArray<TPrice>( numberOfPricePoints );
-            memcpy( values, ( this + PricePointsIndex ), PriceSize * numberOfPricePoints );
+            this->GetPriceView().CopyToHost( values );
             return ( values );
         }
 
+        SetCurrentPrice::TPriceView
+        SetCurrentPrice::GetPriceView( void ) const
+        {
+            return ( TPriceView( ( ( const char* )this ) + PricePointsIndex, this->GetNumberOfPricePoints() ) );
+        }
+
         SetCurrentPrice::TInterval
         SetCurrentPrice::GetIntervalBegin( void ) const
         {
@@ -96,22 +121,23 @@ namespace TerraSwarm
                                                                           TPrice* upRegulationPricePoints,
                                                                           TPrice* downRegulationPricePoints )
         {
-            TDataSize dataSize = IntervalBeginSize + NumberOfPricePointsSize + numberOfPricePoints * PriceSize;
+            TDataSize dataSize = IntervalBeginSize + NumberOfPricePointsSize + 3 * numberOfPricePoints * PriceSize;
             TDataSize totalDataSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
             auto newMemory = CreateObjectArray<char>( totalDataSize );
             ( ( MessageHeader* )newMemory )->PrepareOutgoingMessage( senderId, receiverId, MessageType, MessageId, dataSize );
             ( ( TIntervalBeginAccessor* )newMemory )->Write( intervalBegin );
             ( ( TNumberOfPricePointsAccessor* )newMemory )->Write( numberOfPricePoints );
             char* currentMemory = newMemory + PricePointsIndex;
-            for ( auto index = 0; index < numberOfPricePoints; ++index )
+            for ( TNumberOfPricePoints index = 0; index < numberOfPricePoints; ++index )
             {
-                memcpy( currentMemory, pricePoints, PriceSize );
+                memcpy( currentMemory, pricePoints + index, PriceSize );
                 currentMemory += PriceSize;
-                memcpy( currentMemory, upRegulationPricePoints, PriceSize );
+                memcpy( currentMemory, upRegulationPricePoints + index, PriceSize );
                 currentMemory += PriceSize;
-                memcpy( currentMemory, downRegulationPricePoints, PriceSize * numberOfPricePoints );
+                memcpy( currentMemory, downRegulationPricePoints + index, PriceSize );
                 currentMemory += PriceSize;
             }
+            ByteOrderConverter::HostToNetwork( newMemory + PricePointsIndex, ( TPrice* )( newMemory + PricePointsIndex ), 3 * numberOfPricePoints );
             ( ( MessageEnder* )newMemory )->SetEndOfMessageField();
             return ( newMemory );
         }
@@ -128,13 +154,55 @@ namespace TerraSwarm
         }
         
         SmartPointer<SetCurrentPriceAndRegulation::TPrice>
-        SetCurrentPriceAndRegulation::GetPrice( void ) const
+        SetCurrentPriceAndRegulation::GetPricePoints( const TByteIndex offset ) const
         {
-            TNumberOfPricePoints numberOfPricePoints = 3 * this->GetNumberOfPricePoints();
+            TNumberOfPricePoints numberOfPricePoints = this->GetNumberOfPricePoints();
             auto values = CreateObjectArray<TPrice>( numberOfPricePoints );
-            memcpy( values, ( this + PricePointsIndex ), PriceSize * numberOfPricePoints );
+            this->GetPricePointsView( offset ).CopyToHost( values );
             return ( values );
         }
+
+        SetCurrentPriceAndRegulation::TPriceView
+        SetCurrentPriceAndRegulation::GetPricePointsView( const TByteIndex offset ) const
+        {
+            return ( TPriceView( ( ( const char* )this ) + PricePointsIndex + offset, this->GetNumberOfPricePoints(), 3 * PriceSize ) );
+        }
+
+        SmartPointer<SetCurrentPriceAndRegulation::TPrice>
+        SetCurrentPriceAndRegulation::GetPrice( void ) const
+        {
+            return ( this->GetPricePoints( 0 ) );
+        }
+
+        SmartPointer<SetCurrentPriceAndRegulation::TPrice>
+        SetCurrentPriceAndRegulation::GetUpRegulationPrice( void ) const
+        {
+            return ( this->GetPricePoints( PriceSize ) );
+        }
+
+        SmartPointer<SetCurrentPriceAndRegulation::TPrice>
+        SetCurrentPriceAndRegulation::GetDownRegulationPrice( void ) const
+        {
+            return ( this->GetPricePoints( 2 * PriceSize ) );
+        }
+
+        SetCurrentPriceAndRegulation::TPriceView
+        SetCurrentPriceAndRegulation::GetPriceView( void ) const
+        {
+            return ( this->GetPricePointsView( 0 ) );
+        }
+
+        SetCurrentPriceAndRegulation::TPriceView
+        SetCurrentPriceAndRegulation::GetUpRegulationPriceView( void ) const
+        {
+            return ( this->GetPricePointsView( PriceSize ) );
+        }
+
+        SetCurrentPriceAndRegulation::TPriceView
+        SetCurrentPriceAndRegulation::GetDownRegulationPriceView( void ) const
+        {
+            return ( this->GetPricePointsView( 2 * PriceSize ) );
+        }
         
         SetCurrentPriceAndRegulation::TInterval
         SetCurrentPriceAndRegulation::GetIntervalBegin( void ) const
@@ -155,7 +223,7 @@ namespace TerraSwarm
         TDataSize
         SetCurrentPriceAndRegulation::GetSize( void ) const
         {
-            return ( MessageHeader::MessageHeaderSize + IntervalBeginSize + 3 * NumberOfPricePointsSize + this->GetNumberOfPricePoints() * PriceSize + MessageEnder::EndOfMessageSize );
+            return ( MessageHeader::MessageHeaderSize + IntervalBeginSize + NumberOfPricePointsSize + 3 * this->GetNumberOfPricePoints() * PriceSize + MessageEnder::EndOfMessageSize );
         }
     } /* namespace Synchronous */
 } /* namespace TerraSwarm */
@@ -12,6 +12,7 @@
 #include "MessageEnder.h"
 
 #include "SmartPointer.hpp"
+#include "NetworkArrayView.h"
 
 namespace TerraSwarm
 {
@@ -52,6 +53,11 @@ namespace TerraSwarm
              *  Type for price signal.
              */
                 typedef unsigned int TPrice;
+
+            /**
+             *  Type for the price points read in place from the message.
+             */
+                typedef NetworkArrayView<TPrice> TPriceView;
             
             /**
              *  Type for time interval.
@@ -125,6 +131,22 @@ namespace TerraSwarm
                                        const TNumberOfPricePoints numberOfPricePoints,
                                        TPrice* pricePoints );
 
+            /**
+             *  Creates a new SetCurrentPrice message from price points that are already in network byte order, e.g. received from the External Controller. The points are copied without conversion.
+             *
+             *  @param senderId      Id of the sender.
+             *  @param receiverId    Id of the receiver.
+             *  @param intervalBegin Beginning of the price interval.
+             *  @param pricePoints   View of the price points sent to the client.
+             *
+             *  @return Returns a new allocated message.
+             */
+                static SmartPointer<SetCurrentPrice>
+                GetNewSetCurrentPrice( const MessageHeader::TSenderId senderId,
+                                       const MessageHeader::TReceiverId receiverId,
+                                       const TInterval intervalBegin,
+                                       const TPriceView & pricePoints );
+
             /**
              *  Checks whether the current memory contains a SetCurrentPrice message.
              *
@@ -140,6 +162,14 @@ namespace TerraSwarm
              */
                 SmartPointer<TPrice>
                 GetPrice( void ) const;
+
+            /**
+             *  Returns a view of the price points without copying them. The view is valid as long as the message.
+             *
+             *  @return View of the price points in the message.
+             */
+                TPriceView
+                GetPriceView( void ) const;
             
             /**
              *  Reads the IntervalBegin field in the message.
@@ -201,6 +231,11 @@ namespace TerraSwarm
                  */
                 typedef unsigned int TPrice;
                 
+                /**
+                 *  Type for the price points read in place from the message.
+                 */
+                typedef NetworkArrayView<TPrice> TPriceView;
+                
                 /**
                  *  Type for time interval.
                  */
@@ -248,6 +283,26 @@ namespace TerraSwarm
                  */
                 SetCurrentPriceAndRegulation( void );
                 
+                /**
+                 *  Returns a view of one of the interleaved price, up regulation and down regulation point sequences.
+                 *
+                 *  @param offset Offset of the sequence within each group of three points.
+                 *
+                 *  @return View of the price points of the sequence.
+                 */
+                TPriceView
+                GetPricePointsView( const TByteIndex offset ) const;
+                
+                /**
+                 *  Copies one of the interleaved price, up regulation and down regulation point sequences.
+                 *
+                 *  @param offset Offset of the sequence within each group of three points.
+                 *
+                 *  @return Price points of the sequence.
+                 */
+                SmartPointer<TPrice>
+                GetPricePoints( const TByteIndex offset ) const;
+                
             public:
                 /**
                  *  Deallocates the memory for the message.
@@ -308,6 +363,30 @@ namespace TerraSwarm
                  */
                 SmartPointer<TPrice>
                 GetDownRegulationPrice( void ) const;
+                
+                /**
+                 *  Returns a view of the price points without copying them. The view is valid as long as the message.
+                 *
+                 *  @return View of the price points in the message.
+                 */
+                TPriceView
+                GetPriceView( void ) const;
+                
+                /**
+                 *  Returns a view of the up regulation price points without copying them. The view is valid as long as the message.
+                 *
+                 *  @return View of the up regulation price points in the message.
+                 */
+                TPriceView
+                GetUpRegulationPriceView( void ) const;
+                
+                /**
+                 *  Returns a view of the down regulation price points without copying them. The view is valid as long as the message.
+                 *
+                 *  @return View of the down regulation price points in the message.
+                 */
+                TPriceView
+                GetDownRegulationPriceView( void ) const;
             
                 /**
                  *  Reads the IntervalBegin field in the message.
@@ -0,0 +1,36 @@
+/**
+ * @file TraceCodec.cpp
+ * Implements the TraceCodec class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "TraceCodec.h"
+
+namespace TerraSwarm
+{
+    TraceCodec::Decoder::Decoder( const void* data, const TDataSize size, const TValue previousValue ) : m_current( ( const unsigned char* )data ),
+                                                                                                         m_end( ( const unsigned char* )data + size ),
+                                                                                                         m_value( previousValue )
+    {
+    }
+
+    TDataSize
+    TraceCodec::Encode( const TValue* values, const TNumberOfValues numberOfValues, void* destination, TValue previousValue )
+    {
+        unsigned char* current = ( unsigned char* )destination;
+        for ( TNumberOfValues index = 0; index < numberOfValues; ++index )
+        {
+            long long delta = ( long long )values[index] - ( long long )previousValue;
+            unsigned long long zigzagDelta = ( ( unsigned long long )delta << 1 ) ^ ( unsigned long long )( delta >> 63 );
+            while ( zigzagDelta >= 0x80 )
+            {
+                *current++ = ( unsigned char )( zigzagDelta | 0x80 );
+                zigzagDelta >>= 7;
+            }
+            *current++ = ( unsigned char )zigzagDelta;
+            previousValue = values[index];
+        }
+        return ( ( TDataSize )( current - ( unsigned char* )destination ) );
+    }
+} /* namespace TerraSwarm */
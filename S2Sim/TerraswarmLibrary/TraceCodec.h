@@ -0,0 +1,166 @@
+/**
+ * @file TraceCodec.h
+ * Defines the TraceCodec class compressing consumption traces.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef TRACECODEC_H_
+#define TRACECODEC_H_
+
+#include "NetworkByteAccessor.h"
+
+namespace TerraSwarm
+{
+    /**
+     *  @brief Compresses a trace of 32 bit unsigned values with delta, zigzag and varint coding.
+
+        Each value is stored as the difference to the previous value, the first one as the difference to 0. The signed difference is zigzag mapped to an unsigned number, so small positive and negative changes both become small numbers, and written in 7 bit groups, least significant first, with the highest bit of a byte set if another byte follows. Consumption traces change slowly, so most values take 1 or 2 bytes instead of 4, and a value never takes more than 5 bytes.
+     */
+    class TraceCodec
+    {
+        public:
+        /**
+         *  Defines the type of a value in the trace.
+         */
+            typedef unsigned int TValue;
+
+        /**
+         *  Defines the type of the number of values in a trace.
+         */
+            typedef unsigned int TNumberOfValues;
+
+        /**
+         *  Size limits of an encoded value.
+         */
+            enum SizeValues
+            {
+                MaximumValueSize = 5 /**< Largest number of bytes used by a single value. */
+            };
+
+        /**
+         *  @brief Reads the values of an encoded trace in order.
+
+            The decoder does not own the memory. It can start in the middle of a trace if the previous value is known.
+         */
+            class Decoder
+            {
+                private:
+                /**
+                 *  Next byte to be read.
+                 */
+                    const unsigned char* m_current;
+
+                /**
+                 *  First byte after the encoded trace.
+                 */
+                    const unsigned char* m_end;
+
+                /**
+                 *  Last value read.
+                 */
+                    TValue m_value;
+
+                public:
+                /**
+                 *  Creates a decoder over an encoded trace.
+                 *
+                 *  @param data          First byte of the encoded values.
+                 *  @param size          Number of bytes that can be read.
+                 *  @param previousValue Value before the first encoded value, 0 at the start of a trace.
+                 */
+                    Decoder( const void* data, const TDataSize size, const TValue previousValue = 0 );
+
+                /**
+                 *  Reads the next value.
+                 *
+                 *  @param value Read value.
+                 *
+                 *  @return false if the trace ends or the value is malformed.
+                 */
+                    bool
+                    Next( TValue & value )
+                    {
+                        unsigned long long zigzagDelta = 0;
+                        unsigned int shift = 0;
+                        const unsigned char* current = this->m_current;
+                        while ( true )
+                        {
+                            if ( current == this->m_end || shift >= MaximumValueSize * 7 )
+                            {
+                                return ( false );
+                            }
+                            unsigned char byte = *current++;
+                            zigzagDelta |= ( unsigned long long )( byte & 0x7F ) << shift;
+                            shift += 7;
+                            if ( ( byte & 0x80 ) == 0 )
+                            {
+                                break;
+                            }
+                        }
+
+                        long long delta = ( long long )( zigzagDelta >> 1 ) ^ -( long long )( zigzagDelta & 1 );
+                        long long decodedValue = ( long long )this->m_value + delta;
+                        if ( decodedValue < 0 || decodedValue > ( long long )( TValue )-1 )
+                        {
+                            return ( false );
+                        }
+                        this->m_current = current;
+                        this->m_value = ( TValue )decodedValue;
+                        value = this->m_value;
+                        return ( true );
+                    }
+
+                /**
+                 *  Returns the position of the next value.
+                 *
+                 *  @return Next byte to be read.
+                 */
+                    const void*
+                    GetPosition( void ) const
+                    {
+                        return ( this->m_current );
+                    }
+
+                /**
+                 *  Returns the last value read.
+                 *
+                 *  @return Last value read, the previous value if nothing is read yet.
+                 */
+                    TValue
+                    GetValue( void ) const
+                    {
+                        return ( this->m_value );
+                    }
+            };
+
+        public:
+        /**
+         *  Returns the size of the largest encoding of the given number of values.
+         *
+         *  @param numberOfValues Number of values.
+         *
+         *  @return Size of a buffer that can hold any encoding of the values.
+         */
+            static TDataSize
+            GetMaximumEncodedSize( const TNumberOfValues numberOfValues )
+            {
+                return ( numberOfValues * MaximumValueSize );
+            }
+
+        /**
+         *  Encodes a trace.
+         *
+         *  @param values         Values in host byte order.
+         *  @param numberOfValues Number of values.
+         *  @param destination    Memory of GetMaximumEncodedSize() bytes.
+         *  @param previousValue  Value before the first value, 0 at the start of a trace. Used to continue a trace.
+         *
+         *  @return Number of bytes written.
+         */
+            static TDataSize
+            Encode( const TValue* values, const TNumberOfValues numberOfValues, void* destination, const TValue previousValue = 0 );
+    };
+} /* namespace TerraSwarm */
+
+#endif /* TRACECODEC_H_ */
@@ -11,19 +11,225 @@
  */
 
 
+#include <unistd.h>
+#include <sstream>
+#include <string>
+#include <iostream>
 #include "MatlabManager.h"
 #include "ConnectionManager.h"
 #include "ControlManager.h"
 #include "SystemManager.h"
+#include "ClientManager.h"
 #include "LogPrint.h"
 
+/**
+ *  Prints the command line options.
+ *
+ *  @param programName Name of the executable.
+ */
+static void
+PrintUsage( const char* programName )
+{
+    std::cout << "Usage: " << programName << " [-h] [-g] [-a <directory> [-c <clients>]] [-k <file> [-K <steps>]] [-r <file>] [-l <steps>] [-A <acceptors>] [-b <backlog>] [-w <workers>] [-q <clients>] [-R <rate>] [-o <bytes>] [-P <microseconds>] [-D] [-S <name>] [-U <path> [-L]] [-u <port>] [-Q <fractions>] [-s] [-T <min>,<max>[,<percentile>[,<margin>]]] [-p] [-m <steps>]" << std::endl
+              << "  -h             Print this help and exit" << std::endl
+              << "  -g             Detect sequence number gaps in the client messages" << std::endl
+              << "  -a <directory> Archive the grid state of every time step into the directory" << std::endl
+              << "  -c <clients>   Maximum number of archived clients (default 256)" << std::endl
+              << "  -k <file>      Write a checkpoint of the simulation state into the file periodically" << std::endl
+              << "  -K <steps>     Time steps between two checkpoints (default 60)" << std::endl
+              << "  -r <file>      Restore the simulation state from a checkpoint, clients reconnect with their previous ids" << std::endl
+              << "  -l <steps>     Time steps between two requests of the object names from OpenDSS (default 0, only on connection)" << std::endl
+              << "  -A <acceptors> Threads accepting client connections on the same port with SO_REUSEPORT (default 1)" << std::endl
+              << "  -b <backlog>   Accept queue length of each client port socket (default 1024)" << std::endl
+              << "  -w <workers>   Threads processing the connection handshakes (default 4)" << std::endl
+              << "  -q <clients>   Connections waiting for a handshake before new ones are closed (default 1024)" << std::endl
+              << "  -R <rate>      Accepted connections per second, 0 for no limit (default 0)" << std::endl
+              << "  -o <bytes>     Outbound queue limit of a client, a slower client is disconnected (default 1048576)" << std::endl
+              << "  -P <us>        Busy poll time of the OpenDSS and controller receptions in microseconds (default 0, none)" << std::endl
+              << "  -D             Keep the OS default socket options instead of the port profiles" << std::endl
+              << "  -S <name>      Connect OpenDSS and the controller through the shared memory segments /<name>.opendss and /<name>.controller instead of TCP" << std::endl
+              << "  -U <path>      Listen to the Unix domain sockets <path>.clients, <path>.opendss and <path>.controller next to the TCP ports" << std::endl
+              << "  -L             Listen only to the Unix domain sockets, not to the TCP ports" << std::endl
+              << "  -u <port>      Receive the synchronous client data also as UDP datagrams on the port, e.g. 26999, from the clients connected over TCP" << std::endl
+              << "  -Q <fractions> Send the clients reported so far to the controller at each fraction of the synchronous clients, e.g. 0.5,0.9, and hold the prices until the time step advanced" << std::endl
+              << "  -s             Substitute the synchronous clients missing at the deadline with their prediction or last consumption, and list them in the decision messages" << std::endl
+              << "  -T <min>,<max>[,<percentile>[,<margin>]] Adapt the client timeout to the arrival percentile plus the margin within the bounds in ms (default percentile 0.99, margin 50 ms)" << std::endl
+              << "  -p             Wait for the clients of the next time step while the controller decides" << std::endl
+              << "  -m <steps>     Print the connection statistics every given time steps (default 0, never)" << std::endl;
+}
+
 int
 main( int argc, char **argv )
 {    
     LOG_FUNCTION_START();
     LogPrint( "S2Sim Started in ", argv[0] );
     
-    GetConnectionManager()->Initialize();
+    std::string archiveDirectory;
+    GridArchive::TClientIndex archiveClientCapacity = 256;
+    std::string checkpointPath;
+    SystemManager::TSystemTime checkpointInterval = 60;
+    std::string restorePath;
+    ConnectionManager::Configuration connectionConfiguration;
+    unsigned int statisticsInterval = 0;
+    SocketOptions solverOptions = SocketOptions::GetSolverProfile();
+    SocketOptions controllerOptions = SocketOptions::GetControllerProfile();
+    std::string localPath;
+    bool usePorts = true;
+    
+    int option;
+    while ( ( option = getopt( argc, argv, "hga:c:k:K:r:l:A:b:w:q:R:o:P:DS:U:Lu:Q:sT:pm:" ) ) != -1 )
+    {
+        switch ( option )
+        {
+            case 'g':
+                LogPrint( "Sequence gap detection of the client messages is enabled" );
+                ClientManager::SetGapDetection( SequenceCounter::GapDetectionEnabled );
+                break;
+            case 'a':
+                archiveDirectory = optarg;
+                break;
+            case 'c':
+                archiveClientCapacity = ( GridArchive::TClientIndex )std::stoul( optarg );
+                break;
+            case 'k':
+                checkpointPath = optarg;
+                break;
+            case 'K':
+                checkpointInterval = ( SystemManager::TSystemTime )std::stoul( optarg );
+                break;
+            case 'r':
+                restorePath = optarg;
+                break;
+            case 'l':
+                GetMatlabManager()->SetClientListRefreshInterval( ( MatlabManager::TNumberOfSteps )std::stoul( optarg ) );
+                break;
+            case 'A':
+                connectionConfiguration.numberOfAcceptors = ( ConnectionManager::TNumber )std::stoul( optarg );
+                break;
+            case 'b':
+                connectionConfiguration.listenBacklog = ( ConnectionManager::TNumber )std::stoul( optarg );
+                break;
+            case 'w':
+                connectionConfiguration.numberOfWorkers = ( ConnectionManager::TNumber )std::stoul( optarg );
+                break;
+            case 'q':
+                connectionConfiguration.maximumQueueLength = ( ConnectionManager::TNumber )std::stoul( optarg );
+                break;
+            case 'R':
+                connectionConfiguration.acceptRate = std::stod( optarg );
+                break;
+            case 'o':
+                connectionConfiguration.maximumQueuedBytes = ( ThreadedTCPConnectedClient::TNumberOfBytes )std::stoul( optarg );
+                break;
+            case 'P':
+                solverOptions.busyPollTime = ( SocketOptions::TValue )std::stoi( optarg );
+                controllerOptions.busyPollTime = solverOptions.busyPollTime;
+                break;
+            case 'D':
+                connectionConfiguration.socketOptions = SocketOptions();
+                solverOptions = SocketOptions();
+                controllerOptions = SocketOptions();
+                break;
+            case 'S':
+                GetMatlabManager()->SetSharedMemory( std::string( "/" ) + optarg + ".opendss" );
+                GetControlManager()->SetSharedMemory( std::string( "/" ) + optarg + ".controller" );
+                break;
+            case 'U':
+                localPath = optarg;
+                break;
+            case 'L':
+                usePorts = false;
+                break;
+            case 'u':
+                connectionConfiguration.datagramPort = ( IPAddress::TPort )std::stoul( optarg );
+                break;
+            case 'Q':
+            {
+                SystemManager::TQuorumList decisionQuorums;
+                std::stringstream quorumList( optarg );
+                std::string quorum;
+                while ( std::getline( quorumList, quorum, ',' ) )
+                {
+                    decisionQuorums.push_back( std::stod( quorum ) );
+                }
+                GetSystemManager().SetDecisionQuorums( decisionQuorums );
+                break;
+            }
+            case 's':
+                GetSystemManager().SetStragglerSubstitution( true );
+                break;
+            case 'T':
+            {
+                SystemManager::TimeoutConfiguration timeoutConfiguration;
+                std::stringstream timeoutList( optarg );
+                std::string timeout;
+                timeoutConfiguration.adaptive = true;
+                if ( std::getline( timeoutList, timeout, ',' ) )
+                {
+                    timeoutConfiguration.minimumTimeout = SystemManager::TTimeout( std::stoul( timeout ) );
+                }
+                if ( std::getline( timeoutList, timeout, ',' ) )
+                {
+                    timeoutConfiguration.maximumTimeout = SystemManager::TTimeout( std::stoul( timeout ) );
+                }
+                if ( std::getline( timeoutList, timeout, ',' ) )
+                {
+                    timeoutConfiguration.percentile = std::stod( timeout );
+                }
+                if ( std::getline( timeoutList, timeout, ',' ) )
+                {
+                    timeoutConfiguration.margin = SystemManager::TTimeout( std::stoul( timeout ) );
+                }
+                GetSystemManager().SetTimeoutConfiguration( timeoutConfiguration );
+                break;
+            }
+            case 'p':
+                GetSystemManager().SetPipelining( true );
+                break;
+            case 'm':
+                statisticsInterval = ( unsigned int )std::stoul( optarg );
+                break;
+            case 'h':
+                PrintUsage( argv[0] );
+                LOG_FUNCTION_END();
+                return ( EXIT_SUCCESS );
+            default:
+                PrintUsage( argv[0] );
+                LOG_FUNCTION_END();
+                return ( EXIT_FAILURE );
+        }
+    }
+    
+    if ( !archiveDirectory.empty() && !GetSystemManager().OpenArchive( archiveDirectory, archiveClientCapacity ) )
+    {
+        LOG_FUNCTION_END();
+        return ( EXIT_FAILURE );
+    }
+    if ( !restorePath.empty() && !GetSystemManager().RestoreCheckpoint( restorePath ) )
+    {
+        LOG_FUNCTION_END();
+        return ( EXIT_FAILURE );
+    }
+    if ( !checkpointPath.empty() )
+    {
+        GetSystemManager().SetCheckpoint( checkpointPath, checkpointInterval );
+    }
+    
+    if ( !localPath.empty() )
+    {
+        connectionConfiguration.localPath = localPath + ".clients";
+        if ( !GetMatlabManager()->SetLocalPath( localPath + ".opendss" ) || !GetControlManager()->SetLocalPath( localPath + ".controller" ) )
+        {
+            LOG_FUNCTION_END();
+            return ( EXIT_FAILURE );
+        }
+        connectionConfiguration.usePort = usePorts;
+        GetMatlabManager()->SetPortEnabled( usePorts );
+        GetControlManager()->SetPortEnabled( usePorts );
+    }
+    GetMatlabManager()->SetSocketOptions( solverOptions );
+    GetControlManager()->SetSocketOptions( controllerOptions );
+    GetConnectionManager()->Initialize( connectionConfiguration );
     GetMatlabManager()->Initialize();
     GetControlManager()->Initialize();
     GetSystemManager();
@@ -45,6 +251,10 @@ main( int argc, char **argv )
         
         ++iterationNumber;
         LogPrint( "Time: ", iterationNumber );
+        if ( statisticsInterval > 0 && iterationNumber % statisticsInterval == 0 )
+        {
+            GetConnectionManager()->PrintStatistics();
+        }
     }
     LOG_FUNCTION_END();
     return ( EXIT_SUCCESS );
@@ -0,0 +1,145 @@
+/**
+ * @file main.cpp
+ * Main file of the archive exporter that prints a grid state archive of S2Sim as CSV.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <unistd.h>
+#include <iostream>
+#include <limits>
+#include <cmath>
+#include "GridArchiveReader.h"
+
+using namespace TerraSwarm;
+
+/**
+ *  Prints the command line options.
+ *
+ *  @param programName Name of the executable.
+ */
+static void
+PrintUsage( const char* programName )
+{
+    std::cerr << "Usage: " << programName << " -d <directory> [options]" << std::endl
+              << "  -d <directory> Archive directory written by S2Sim -a" << std::endl
+              << "  -f <tick>      First exported tick (default 0)" << std::endl
+              << "  -n <ticks>     Number of exported ticks (default all)" << std::endl
+              << "  -C <id>        Export only the client with this id" << std::endl;
+}
+
+/**
+ *  Prints a CSV field, empty for a missing value.
+ *
+ *  @param value          Archived value.
+ *  @param fractionalBits Number of fractional bits of the value, 0 for an integer.
+ */
+static void
+PrintValue( const GridArchive::TValue value, const GridArchive::TFractionalBits fractionalBits )
+{
+    std::cout << ',';
+    if ( value == GridArchive::MissingValue )
+    {
+        return;
+    }
+    if ( fractionalBits == 0 )
+    {
+        std::cout << value;
+        return;
+    }
+    std::streamsize precision = std::cout.precision( 17 );
+    std::cout << std::ldexp( ( double )value, -( int )fractionalBits );
+    std::cout.precision( precision );
+}
+
+int
+main( int argc, char **argv )
+{
+    std::string directory;
+    GridArchive::TTickIndex firstTick = 0;
+    GridArchive::TTickIndex numberOfTicks = std::numeric_limits<GridArchive::TTickIndex>::max();
+    bool filterClient = false;
+    GridArchive::TClientId filteredClientId = 0;
+
+    int option;
+    while ( ( option = getopt( argc, argv, "d:f:n:C:" ) ) != -1 )
+    {
+        switch ( option )
+        {
+            case 'd':
+                directory = optarg;
+                break;
+            case 'f':
+                firstTick = ( GridArchive::TTickIndex )std::stoul( optarg );
+                break;
+            case 'n':
+                numberOfTicks = ( GridArchive::TTickIndex )std::stoul( optarg );
+                break;
+            case 'C':
+                filterClient = true;
+                filteredClientId = ( GridArchive::TClientId )std::stoul( optarg );
+                break;
+            default:
+                PrintUsage( argv[0] );
+                return ( EXIT_FAILURE );
+        }
+    }
+    if ( directory.empty() )
+    {
+        PrintUsage( argv[0] );
+        return ( EXIT_FAILURE );
+    }
+
+    GridArchiveReader reader;
+    if ( !reader.Open( directory ) )
+    {
+        std::cerr << "Cannot open archive: " << directory << std::endl;
+        return ( EXIT_FAILURE );
+    }
+
+    GridArchive::TClientIndex firstClient = 0;
+    GridArchive::TClientIndex lastClient = reader.GetNumberOfClients();
+    if ( filterClient )
+    {
+        if ( !reader.FindClientIndex( filteredClientId, firstClient ) )
+        {
+            std::cerr << "Client " << filteredClientId << " is not in the archive" << std::endl;
+            return ( EXIT_FAILURE );
+        }
+        lastClient = firstClient + 1;
+    }
+
+    GridArchiveReader::ColumnRange columns[GridArchive::NumberOfColumns] =
+    {
+        reader.GetRange( GridArchive::ConsumptionColumn, firstTick, numberOfTicks ),
+        reader.GetRange( GridArchive::PredictedConsumptionColumn, firstTick, numberOfTicks ),
+        reader.GetRange( GridArchive::VoltageDeviationColumn, firstTick, numberOfTicks ),
+        reader.GetRange( GridArchive::PriceColumn, firstTick, numberOfTicks )
+    };
+
+    std::cout << "time,client,consumption,predicted_consumption,voltage_deviation,price" << std::endl;
+    for ( GridArchive::TTickIndex tick = 0; tick < columns[0].GetNumberOfTicks(); ++tick )
+    {
+        GridArchive::TValue time = reader.GetTime( firstTick + tick );
+        for ( GridArchive::TClientIndex clientIndex = firstClient; clientIndex < lastClient; ++clientIndex )
+        {
+            bool recorded = false;
+            for ( GridArchive::TColumn column = 0; column < GridArchive::NumberOfColumns; ++column )
+            {
+                recorded = recorded || columns[column].GetValue( tick, clientIndex ) != GridArchive::MissingValue;
+            }
+            if ( !recorded )
+            {
+                continue;
+            }
+            std::cout << time << ',' << reader.GetClientId( clientIndex );
+            for ( GridArchive::TColumn column = 0; column < GridArchive::NumberOfColumns; ++column )
+            {
+                bool consumption = column == GridArchive::ConsumptionColumn || column == GridArchive::PredictedConsumptionColumn;
+                PrintValue( columns[column].GetValue( tick, clientIndex ), consumption ? reader.GetFractionalBits( clientIndex ) : 0 );
+            }
+            std::cout << '\n';
+        }
+    }
+    return ( EXIT_SUCCESS );
+}
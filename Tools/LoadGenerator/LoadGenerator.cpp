@@ -0,0 +1,518 @@
+/**
+ * @file LoadGenerator.cpp
+ * Implements the LoadGenerator class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "LoadGenerator.h"
+#include <thread>
+#include <random>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cmath>
+
+/**
+ *  Upper bound for the data size of a received message, protecting against corrupted headers.
+ */
+static const TDataSize MaximumDataSize = 1024 * 1024;
+
+LoadGenerator::LoadGenerator( const Configuration & configuration ) : m_configuration( configuration )
+{
+}
+
+bool
+LoadGenerator::Connect( TCPClient & client )
+{
+    if ( !this->m_configuration.localPath.empty() )
+    {
+        return ( client.ConnectLocal( this->m_configuration.localPath + ".clients" ) );
+    }
+    IPAddress serverAddress;
+    if ( !this->GetServerAddress( serverAddress ) )
+    {
+        return ( false );
+    }
+    serverAddress.SetPort( this->m_configuration.serverPort );
+    return ( client.Connect( serverAddress ) );
+}
+
+bool
+LoadGenerator::GetServerAddress( IPAddress & serverAddress ) const
+{
+    in_addr_t address = inet_addr( this->m_configuration.serverAddress.c_str() );
+    if ( address == INADDR_NONE )
+    {
+        hostent* host = gethostbyname( this->m_configuration.serverAddress.c_str() );
+        if ( host == nullptr )
+        {
+            ErrorPrint( "Unknown server address: ", this->m_configuration.serverAddress );
+            return ( false );
+        }
+        memcpy( &address, host->h_addr_list[0], sizeof( address ) );
+    }
+    serverAddress.SetAddress( ntohl( address ) );
+    return ( true );
+}
+
+bool
+LoadGenerator::SendDatagram( UDPSocket & socket, IPAddress & destination, void* message, SequenceCounter & sequenceCounter, Statistics & statistics )
+{
+    sequenceCounter.Stamp( message );
+    TDataSize messageSize = MessageHeader::MessageHeaderSize + ( ( MessageHeader* )message )->GetDataSize() + MessageEnder::EndOfMessageSize;
+    if ( socket.SendData( message, messageSize, destination ) != messageSize )
+    {
+        return ( false );
+    }
+    ++statistics.sentMessages;
+    statistics.sentBytes += messageSize;
+    return ( true );
+}
+
+bool
+LoadGenerator::SendMessage( TCPClient & client, void* message, SequenceCounter & sequenceCounter, Statistics & statistics )
+{
+    sequenceCounter.Stamp( message );
+    TDataSize messageSize = MessageHeader::MessageHeaderSize + ( ( MessageHeader* )message )->GetDataSize() + MessageEnder::EndOfMessageSize;
+    TDataSize sentSize = 0;
+    while ( sentSize < messageSize )
+    {
+        TCPClient::TNumberOfBytes result = client.SendData( ( char* )message + sentSize, messageSize - sentSize );
+        if ( result == 0 || result > messageSize - sentSize )
+        {
+            return ( false );
+        }
+        sentSize += result;
+    }
+    ++statistics.sentMessages;
+    statistics.sentBytes += messageSize;
+    return ( true );
+}
+
+bool
+LoadGenerator::ReceiveAll( TCPClient & client, char* buffer, const TDataSize length )
+{
+    TDataSize receivedSize = 0;
+    while ( receivedSize < length )
+    {
+        TCPClient::TNumberOfBytes result = client.ReceiveData( buffer + receivedSize, length - receivedSize );
+        if ( result == 0 || result > length - receivedSize )
+        {
+            return ( false );
+        }
+        receivedSize += result;
+    }
+    return ( true );
+}
+
+SmartPointer<char>
+LoadGenerator::ReceiveMessage( TCPClient & client, SequenceCounter & sequenceCounter, Statistics & statistics )
+{
+    SmartPointer<char> message;
+    char header[MessageHeader::MessageHeaderSize];
+    if ( !this->ReceiveAll( client, header, MessageHeader::MessageHeaderSize ) )
+    {
+        return ( message );
+    }
+
+    TDataSize dataSize = ( ( MessageHeader* )header )->GetDataSize();
+    if ( dataSize > MaximumDataSize )
+    {
+        ErrorPrint( "Received message with invalid data size: ", dataSize );
+        return ( message );
+    }
+
+    TDataSize messageSize = MessageHeader::MessageHeaderSize + dataSize + MessageEnder::EndOfMessageSize;
+    SmartPointer<char> newMessage = CreateObjectArray<char>( messageSize );
+    memcpy( newMessage, header, MessageHeader::MessageHeaderSize );
+    if ( !this->ReceiveAll( client, newMessage + MessageHeader::MessageHeaderSize, dataSize + MessageEnder::EndOfMessageSize ) )
+    {
+        return ( message );
+    }
+    ++statistics.receivedMessages;
+    statistics.receivedBytes += messageSize;
+    statistics.missingMessages += sequenceCounter.CheckIncoming( newMessage );
+    statistics.reorderedMessages = sequenceCounter.GetReorderedMessages();
+    return ( newMessage );
+}
+
+LoadGenerator::TClientName
+LoadGenerator::GetHouseholdName( const TNumberOfHouseholds householdIndex ) const
+{
+    if ( !this->m_configuration.names.empty() )
+    {
+        return ( this->m_configuration.names[householdIndex % this->m_configuration.names.size()] );
+    }
+    return ( this->m_configuration.namePrefix + std::to_string( householdIndex + 1 ) );
+}
+
+LoadGenerator::TConsumption
+LoadGenerator::GetConsumption( const TNumberOfHouseholds householdIndex, const TNumberOfTicks time ) const
+{
+    TDataPoint variation = this->m_configuration.baseConsumption / 2 + 1;
+    TDataPoint integerPart = this->m_configuration.baseConsumption - variation / 2 + ( householdIndex * 37 + time * 13 ) % variation;
+    return ( integerPart + ( TConsumption )( ( householdIndex + time ) % 4 ) / 4 );
+}
+
+void
+LoadGenerator::MergeStatistics( const Statistics & statistics )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_statisticsLock );
+    this->m_statistics.connectionAttempts += statistics.connectionAttempts;
+    this->m_statistics.acceptedConnections += statistics.acceptedConnections;
+    this->m_statistics.rejectedConnections += statistics.rejectedConnections;
+    this->m_statistics.failedConnections += statistics.failedConnections;
+    this->m_statistics.completedTicks += statistics.completedTicks;
+    this->m_statistics.sentMessages += statistics.sentMessages;
+    this->m_statistics.sentBytes += statistics.sentBytes;
+    this->m_statistics.receivedMessages += statistics.receivedMessages;
+    this->m_statistics.receivedBytes += statistics.receivedBytes;
+    this->m_statistics.missingMessages += statistics.missingMessages;
+    this->m_statistics.reorderedMessages += statistics.reorderedMessages;
+    this->m_statistics.connectionTimes.insert( this->m_statistics.connectionTimes.end(), statistics.connectionTimes.begin(), statistics.connectionTimes.end() );
+    this->m_statistics.tickLatencies.insert( this->m_statistics.tickLatencies.end(), statistics.tickLatencies.begin(), statistics.tickLatencies.end() );
+    this->m_statistics.firstConnection = std::min( this->m_statistics.firstConnection, statistics.firstConnection );
+    this->m_statistics.lastConnection = std::max( this->m_statistics.lastConnection, statistics.lastConnection );
+}
+
+void
+LoadGenerator::RunSynchronousHousehold( const TNumberOfHouseholds householdIndex )
+{
+    Statistics statistics;
+    TCPClient client;
+    SequenceCounter sequenceCounter( SequenceCounter::GapDetectionEnabled );
+    TClientName clientName = this->GetHouseholdName( householdIndex );
+
+    ++statistics.connectionAttempts;
+    TClock::time_point connectionStart = TClock::now();
+    statistics.firstConnection = connectionStart;
+    if ( !this->Connect( client ) )
+    {
+        WarningPrint( "Household ", clientName, " could not connect" );
+        ++statistics.failedConnections;
+        this->MergeStatistics( statistics );
+        return;
+    }
+
+    auto request = Synchronous::ClientConnectionRequest::GetNewClientConnectionRequest( this->m_clientIds[householdIndex], 0x0000, clientName, this->m_configuration.payloadEncoding );
+    SmartPointer<char> response;
+    if ( !this->SendMessage( client, request, sequenceCounter, statistics ) ||
+         ( response = this->ReceiveMessage( client, sequenceCounter, statistics ) ).IsNull() ||
+         !( ( Synchronous::ClientConnectionResponse* )response )->CheckMessage() )
+    {
+        WarningPrint( "Household ", clientName, " lost the connection during the request" );
+        ++statistics.failedConnections;
+        this->MergeStatistics( statistics );
+        return;
+    }
+    TClock::time_point connectionEnd = TClock::now();
+    statistics.connectionTimes.push_back( GetMicroseconds( connectionStart, connectionEnd ) );
+    statistics.lastConnection = connectionEnd;
+
+    if ( ( ( Synchronous::ClientConnectionResponse* )response )->GetRequestResult() != Synchronous::ClientConnectionResponse::RequestAccepted )
+    {
+        WarningPrint( "Household ", clientName, " is rejected" );
+        ++statistics.rejectedConnections;
+        this->MergeStatistics( statistics );
+        return;
+    }
+    ++statistics.acceptedConnections;
+    MessageHeader::TId clientId = ( ( MessageHeader* )response )->GetReceiverId();
+    this->m_clientIds[householdIndex] = clientId;
+    LogPrint( "Household ", clientName, " connected with id: ", clientId );
+
+    SmartPointer<UDPSocket> datagramSocket;
+    IPAddress datagramAddress;
+    SequenceCounter datagramCounter( SequenceCounter::GapDetectionEnabled );
+    if ( this->m_configuration.datagramPort != 0 && this->m_configuration.horizon == 1 && this->GetServerAddress( datagramAddress ) )
+    {
+        datagramAddress.SetPort( this->m_configuration.datagramPort );
+        datagramSocket = CreateObject<UDPSocket>();
+    }
+
+    std::mt19937 randomGenerator( householdIndex );
+    std::uniform_int_distribution<TMilliseconds> jitterDistribution( 0, this->m_configuration.jitter );
+    SmartPointer<TConsumption> consumptions = CreateObjectArray<TConsumption>( this->m_configuration.horizon );
+    TConsumption* consumptionValues = consumptions;
+    TClock::time_point lastDataTime;
+    bool dataSent = false;
+
+    for ( TNumberOfTicks tick = 0; tick < this->m_configuration.numberOfTicks; )
+    {
+        SmartPointer<char> message = this->ReceiveMessage( client, sequenceCounter, statistics );
+        if ( message.IsNull() )
+        {
+            WarningPrint( "Household ", clientName, " lost the connection at tick: ", tick );
+            break;
+        }
+        if ( !( ( Synchronous::SetCurrentPrice* )message )->CheckMessage() )
+        {
+            continue;
+        }
+
+        if ( dataSent )
+        {
+            statistics.tickLatencies.push_back( GetMicroseconds( lastDataTime, TClock::now() ) );
+        }
+
+        if ( this->m_configuration.jitter > 0 )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( jitterDistribution( randomGenerator ) ) );
+        }
+
+        SmartPointer<Synchronous::ClientExtendedData> extendedData;
+        SmartPointer<Synchronous::ClientData> data;
+        if ( this->m_configuration.horizon > 1 )
+        {
+            for ( TNumberOfDataPoints index = 0; index < this->m_configuration.horizon; ++index )
+            {
+                consumptionValues[index] = this->GetConsumption( householdIndex, tick + index );
+            }
+            extendedData = Synchronous::ClientExtendedData::GetNewClientData( clientId, 0x0000, this->m_configuration.horizon, this->m_configuration.payloadEncoding, consumptionValues );
+        }
+        else
+        {
+            data = Synchronous::ClientData::GetNewClientData( clientId, 0x0000, this->m_configuration.payloadEncoding, this->GetConsumption( householdIndex, tick ) );
+        }
+
+        lastDataTime = TClock::now();
+        bool dataDelivered;
+        if ( !extendedData.IsNull() )
+        {
+            dataDelivered = this->SendMessage( client, extendedData, sequenceCounter, statistics );
+        }
+        else if ( !datagramSocket.IsNull() )
+        {
+            dataDelivered = this->SendDatagram( *datagramSocket, datagramAddress, data, datagramCounter, statistics );
+        }
+        else
+        {
+            dataDelivered = this->SendMessage( client, data, sequenceCounter, statistics );
+        }
+        if ( !dataDelivered )
+        {
+            WarningPrint( "Household ", clientName, " could not send data at tick: ", tick );
+            break;
+        }
+        dataSent = true;
+        ++statistics.completedTicks;
+        ++tick;
+    }
+
+    this->MergeStatistics( statistics );
+}
+
+void
+LoadGenerator::RunAsynchronousHousehold( const TNumberOfHouseholds householdIndex )
+{
+    Statistics statistics;
+    TCPClient client;
+    SequenceCounter sequenceCounter( SequenceCounter::GapDetectionEnabled );
+    TClientName clientName = this->GetHouseholdName( householdIndex );
+
+    ++statistics.connectionAttempts;
+    TClock::time_point connectionStart = TClock::now();
+    statistics.firstConnection = connectionStart;
+    if ( !this->Connect( client ) )
+    {
+        WarningPrint( "Household ", clientName, " could not connect" );
+        ++statistics.failedConnections;
+        this->MergeStatistics( statistics );
+        return;
+    }
+
+    auto request = Asynchronous::ClientConnectionRequest::GetNewClientConnectionRequest( this->m_clientIds[householdIndex], 0x0000, clientName, this->m_configuration.payloadEncoding );
+    SmartPointer<char> response;
+    if ( !this->SendMessage( client, request, sequenceCounter, statistics ) ||
+         ( response = this->ReceiveMessage( client, sequenceCounter, statistics ) ).IsNull() ||
+         !( ( Asynchronous::ClientConnectionResponse* )response )->CheckMessage() )
+    {
+        WarningPrint( "Household ", clientName, " lost the connection during the request" );
+        ++statistics.failedConnections;
+        this->MergeStatistics( statistics );
+        return;
+    }
+    TClock::time_point connectionEnd = TClock::now();
+    statistics.connectionTimes.push_back( GetMicroseconds( connectionStart, connectionEnd ) );
+    statistics.lastConnection = connectionEnd;
+
+    if ( ( ( Asynchronous::ClientConnectionResponse* )response )->GetRequestResult() != Asynchronous::ClientConnectionResponse::RequestAccepted )
+    {
+        WarningPrint( "Household ", clientName, " is rejected" );
+        ++statistics.rejectedConnections;
+        this->MergeStatistics( statistics );
+        return;
+    }
+    ++statistics.acceptedConnections;
+    MessageHeader::TId clientId = ( ( MessageHeader* )response )->GetReceiverId();
+    this->m_clientIds[householdIndex] = clientId;
+    Asynchronous::ClientConnectionResponse::TSystemTime systemTime = ( ( Asynchronous::ClientConnectionResponse* )response )->GetSystemTime();
+
+    SmartPointer<TConsumption> consumptions = CreateObjectArray<TConsumption>( this->m_configuration.horizon );
+    TConsumption* consumptionValues = consumptions;
+    SmartPointer<TDataPoint> dataPoints = CreateObjectArray<TDataPoint>( this->m_configuration.horizon );
+    for ( TNumberOfDataPoints index = 0; index < this->m_configuration.horizon; ++index )
+    {
+        consumptionValues[index] = this->GetConsumption( householdIndex, index );
+        dataPoints[index] = ( TDataPoint )std::lround( consumptionValues[index] );
+    }
+
+    bool dataDelivered;
+    if ( this->m_configuration.compressTraces )
+    {
+        auto data = Asynchronous::ClientCompressedData::GetNewClientCompressedData( clientId,
+                                                                                    0x0000,
+                                                                                    systemTime,
+                                                                                    this->m_configuration.asynchronousResolution,
+                                                                                    this->m_configuration.horizon,
+                                                                                    dataPoints );
+        dataDelivered = this->SendMessage( client, data, sequenceCounter, statistics );
+    }
+    else
+    {
+        auto data = Asynchronous::ClientData::GetNewClientData( clientId,
+                                                                0x0000,
+                                                                systemTime,
+                                                                this->m_configuration.asynchronousResolution,
+                                                                this->m_configuration.horizon,
+                                                                this->m_configuration.payloadEncoding,
+                                                                consumptionValues );
+        dataDelivered = this->SendMessage( client, data, sequenceCounter, statistics );
+    }
+    if ( dataDelivered )
+    {
+        ++statistics.completedTicks;
+    }
+    else
+    {
+        WarningPrint( "Household ", clientName, " could not send its trace" );
+    }
+
+    this->MergeStatistics( statistics );
+}
+
+void
+LoadGenerator::Run( void )
+{
+    std::vector<std::thread> households;
+    TNumberOfHouseholds numberOfHouseholds = this->m_configuration.numberOfSynchronousHouseholds + this->m_configuration.numberOfAsynchronousHouseholds;
+    households.reserve( numberOfHouseholds );
+    this->m_clientIds.assign( numberOfHouseholds, NewClientId );
+    this->LoadClientIds();
+
+    this->m_startTime = TClock::now();
+    for ( TNumberOfHouseholds householdIndex = 0; householdIndex < numberOfHouseholds; ++householdIndex )
+    {
+        if ( householdIndex < this->m_configuration.numberOfSynchronousHouseholds )
+        {
+            households.push_back( std::thread( &LoadGenerator::RunSynchronousHousehold, this, householdIndex ) );
+        }
+        else
+        {
+            households.push_back( std::thread( &LoadGenerator::RunAsynchronousHousehold, this, householdIndex ) );
+        }
+
+        if ( this->m_configuration.rampRate > 0 )
+        {
+            std::this_thread::sleep_for( std::chrono::microseconds( 1000000 / this->m_configuration.rampRate ) );
+        }
+    }
+
+    for ( auto & household : households )
+    {
+        household.join();
+    }
+    this->m_endTime = TClock::now();
+    this->SaveClientIds();
+}
+
+void
+LoadGenerator::LoadClientIds( void )
+{
+    if ( this->m_configuration.clientIdFile.empty() )
+    {
+        return;
+    }
+    std::ifstream clientIdFile( this->m_configuration.clientIdFile );
+    TClientIdList::size_type householdIndex = 0;
+    unsigned long clientId;
+    while ( householdIndex < this->m_clientIds.size() && clientIdFile >> clientId )
+    {
+        this->m_clientIds[householdIndex++] = ( TClientId )clientId;
+    }
+}
+
+void
+LoadGenerator::SaveClientIds( void ) const
+{
+    if ( this->m_configuration.clientIdFile.empty() )
+    {
+        return;
+    }
+    std::ofstream clientIdFile( this->m_configuration.clientIdFile );
+    for ( TClientId clientId : this->m_clientIds )
+    {
+        clientIdFile << clientId << std::endl;
+    }
+}
+
+LoadGenerator::TMicroseconds
+LoadGenerator::GetPercentile( const TDurationList & durations, const double percentile )
+{
+    if ( durations.empty() )
+    {
+        return ( 0 );
+    }
+    size_t index = ( size_t )( percentile * ( durations.size() - 1 ) + 0.5 );
+    return ( durations[index] );
+}
+
+LoadGenerator::TMicroseconds
+LoadGenerator::GetTickLatency( const double percentile )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_statisticsLock );
+    std::sort( this->m_statistics.tickLatencies.begin(), this->m_statistics.tickLatencies.end() );
+    return ( GetPercentile( this->m_statistics.tickLatencies, percentile ) );
+}
+
+void
+LoadGenerator::PrintReport( void )
+{
+    std::lock_guard<std::mutex> lockGuard( this->m_statisticsLock );
+    std::sort( this->m_statistics.connectionTimes.begin(), this->m_statistics.connectionTimes.end() );
+    std::sort( this->m_statistics.tickLatencies.begin(), this->m_statistics.tickLatencies.end() );
+
+    double runSeconds = GetMicroseconds( this->m_startTime, this->m_endTime ) / 1e6;
+    double connectionSeconds = 0.0;
+    if ( this->m_statistics.lastConnection > this->m_statistics.firstConnection )
+    {
+        connectionSeconds = GetMicroseconds( this->m_statistics.firstConnection, this->m_statistics.lastConnection ) / 1e6;
+    }
+
+    std::cout << std::fixed << std::setprecision( 3 );
+    std::cout << "Households: " << this->m_configuration.numberOfSynchronousHouseholds << " synchronous, "
+              << this->m_configuration.numberOfAsynchronousHouseholds << " asynchronous, horizon " << this->m_configuration.horizon
+              << ", jitter " << this->m_configuration.jitter << " ms" << std::endl;
+    std::cout << "Connections: " << this->m_statistics.connectionAttempts << " attempted, "
+              << this->m_statistics.acceptedConnections << " accepted, "
+              << this->m_statistics.rejectedConnections << " rejected, "
+              << this->m_statistics.failedConnections << " failed" << std::endl;
+    std::cout << "Connect rate: " << ( connectionSeconds > 0.0 ? this->m_statistics.acceptedConnections / connectionSeconds : 0.0 ) << " accepted/s"
+              << ", connect time p50 " << GetPercentile( this->m_statistics.connectionTimes, 0.5 ) / 1e3 << " ms"
+              << ", p99 " << GetPercentile( this->m_statistics.connectionTimes, 0.99 ) / 1e3 << " ms" << std::endl;
+    std::cout << "Tick latency over " << this->m_statistics.tickLatencies.size() << " ticks: p50 "
+              << GetPercentile( this->m_statistics.tickLatencies, 0.5 ) / 1e3 << " ms, p90 "
+              << GetPercentile( this->m_statistics.tickLatencies, 0.9 ) / 1e3 << " ms, p99 "
+              << GetPercentile( this->m_statistics.tickLatencies, 0.99 ) / 1e3 << " ms, max "
+              << GetPercentile( this->m_statistics.tickLatencies, 1.0 ) / 1e3 << " ms" << std::endl;
+    if ( runSeconds > 0.0 )
+    {
+        std::cout << "Throughput over " << runSeconds << " s: sent "
+                  << this->m_statistics.sentMessages / runSeconds << " msg/s, " << this->m_statistics.sentBytes / runSeconds << " B/s; received "
+                  << this->m_statistics.receivedMessages / runSeconds << " msg/s, " << this->m_statistics.receivedBytes / runSeconds << " B/s" << std::endl;
+    }
+    std::cout << "Sequence gaps in received messages: " << this->m_statistics.missingMessages << " missing, "
+              << this->m_statistics.reorderedMessages << " reordered" << std::endl;
+}
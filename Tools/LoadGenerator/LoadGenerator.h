@@ -0,0 +1,552 @@
+/**
+ * @file LoadGenerator.h
+ * Defines the LoadGenerator class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef LOADGENERATOR_H_
+#define LOADGENERATOR_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include "TCPClient.h"
+#include "UDPSocket.h"
+#include "IPAddress.h"
+#include "SmartPointer.hpp"
+#include "MessageHeader.h"
+#include "SequenceCounter.h"
+#include "MessageEnder.h"
+#include "ClientConnectionRequest.h"
+#include "ClientConnectionResponse.h"
+#include "ClientData.h"
+#include "SetCurrentPrice.h"
+
+using namespace TerraSwarm;
+
+/**
+ *  @brief Spawns simulated households against a running S2Sim instance.
+
+    Every household runs on its own thread and speaks the same client protocol as the Matlab sample clients. Synchronous households stay connected and answer each price signal with their consumption, asynchronous households upload a whole consumption trace and disconnect. The timing of every step is collected and summarized after the run.
+ */
+class LoadGenerator
+{
+    public:
+    /**
+     *  Defines the type for the number of simulated households.
+     */
+        typedef unsigned int TNumberOfHouseholds;
+
+    /**
+     *  Defines the type for the number of simulated time steps.
+     */
+        typedef unsigned int TNumberOfTicks;
+
+    /**
+     *  Defines the type for a duration given in milliseconds.
+     */
+        typedef unsigned int TMilliseconds;
+
+    /**
+     *  Defines the type for the connection ramp rate in households per second.
+     */
+        typedef unsigned int TRampRate;
+
+    /**
+     *  Redefines the consumption data point for rapid development.
+     */
+        typedef Synchronous::ClientData::TDataPoint TDataPoint;
+
+    /**
+     *  Type of the consumption values before they are encoded into a message.
+     */
+        typedef PayloadEncoding::TValue TConsumption;
+
+    /**
+     *  Redefines the number of data points for rapid development.
+     */
+        typedef Synchronous::ClientExtendedData::TNumberOfDataPoints TNumberOfDataPoints;
+
+    /**
+     *  Redefines the asynchronous time resolution for rapid development.
+     */
+        typedef Asynchronous::ClientData::TTimeResolution TTimeResolution;
+
+    /**
+     *  Redefines the object name for rapid development.
+     */
+        typedef Synchronous::ClientConnectionRequest::TClientName TClientName;
+
+    /**
+     *  Defines the list of object names the households are cycled through.
+     */
+        typedef std::vector<TClientName> TNameList;
+
+    /**
+     *  Redefines the unique client id for rapid development.
+     */
+        typedef MessageHeader::TId TClientId;
+
+    /**
+     *  Defines the client id of each household.
+     */
+        typedef std::vector<TClientId> TClientIdList;
+
+    /**
+     *  Defines the clock used for all measurements.
+     */
+        typedef std::chrono::steady_clock TClock;
+
+    /**
+     *  Defines the type for a measured duration in microseconds.
+     */
+        typedef std::chrono::microseconds::rep TMicroseconds;
+
+    /**
+     *  Defines the list of measured durations.
+     */
+        typedef std::vector<TMicroseconds> TDurationList;
+
+    /**
+     *  Defines the type for message and byte counters.
+     */
+        typedef unsigned long long TCounter;
+
+    /**
+     *  Run parameters of the load generator.
+     */
+        struct Configuration
+        {
+            /**
+             *  Address of the S2Sim client port.
+             */
+            std::string serverAddress;
+
+            /**
+             *  Client port of S2Sim.
+             */
+            IPAddress::TPort serverPort;
+
+            /**
+             *  Path given to S2Sim with -U, the Unix domain socket <path>.clients is used instead of TCP if it is not empty.
+             */
+            std::string localPath;
+
+            /**
+             *  UDP port of S2Sim -u, the synchronous households send their consumption as datagrams to it if not 0 and the horizon is 1.
+             */
+            IPAddress::TPort datagramPort;
+
+            /**
+             *  Number of synchronous households to spawn.
+             */
+            TNumberOfHouseholds numberOfSynchronousHouseholds;
+
+            /**
+             *  Number of asynchronous households to spawn.
+             */
+            TNumberOfHouseholds numberOfAsynchronousHouseholds;
+
+            /**
+             *  Number of data points sent with each consumption message. Synchronous households use ClientExtendedData if larger than 1.
+             */
+            TNumberOfDataPoints horizon;
+
+            /**
+             *  Maximum random delay before a synchronous household answers a price signal.
+             */
+            TMilliseconds jitter;
+
+            /**
+             *  Number of price signals each synchronous household answers before disconnecting.
+             */
+            TNumberOfTicks numberOfTicks;
+
+            /**
+             *  Time resolution of the asynchronous consumption traces.
+             */
+            TTimeResolution asynchronousResolution;
+
+            /**
+             *  Number of households connecting per second, 0 connects all at once.
+             */
+            TRampRate rampRate;
+
+            /**
+             *  Average consumption of a household.
+             */
+            TDataPoint baseConsumption;
+
+            /**
+             *  Prefix of the generated object names, followed by the household index.
+             */
+            TClientName namePrefix;
+
+            /**
+             *  Object names to cycle through instead of the generated names, if not empty.
+             */
+            TNameList names;
+
+            /**
+             *  Encoding of the consumption values, requested in the connection request.
+             */
+            PayloadEncoding payloadEncoding;
+
+            /**
+             *  Whether the asynchronous traces are sent compressed in ClientCompressedData messages.
+             */
+            bool compressTraces;
+
+            /**
+             *  File with one client id per household, if not empty. The households reconnect with the ids in the file, e.g. to a restored S2Sim, and the assigned ids are written back after the run.
+             */
+            std::string clientIdFile;
+
+            /**
+             *  Sets the default parameters matching a local S2Sim instance.
+             */
+            Configuration( void ) : serverAddress( "127.0.0.1" ),
+                                    serverPort( 26999 ),
+                                    localPath(),
+                                    datagramPort( 0 ),
+                                    numberOfSynchronousHouseholds( 1 ),
+                                    numberOfAsynchronousHouseholds( 0 ),
+                                    horizon( 1 ),
+                                    jitter( 0 ),
+                                    numberOfTicks( 10 ),
+                                    asynchronousResolution( 1 ),
+                                    rampRate( 0 ),
+                                    baseConsumption( 1000 ),
+                                    namePrefix( "load" ),
+                                    compressTraces( false )
+            {}
+        };
+
+    private:
+    /**
+     *  Measurements collected by a household. Each household fills its own copy and merges it at the end to keep the lock out of the measured path.
+     */
+        struct Statistics
+        {
+            /**
+             *  Number of connection requests sent.
+             */
+            TCounter connectionAttempts;
+
+            /**
+             *  Number of accepted connection requests.
+             */
+            TCounter acceptedConnections;
+
+            /**
+             *  Number of rejected connection requests.
+             */
+            TCounter rejectedConnections;
+
+            /**
+             *  Number of connections that failed at the socket level.
+             */
+            TCounter failedConnections;
+
+            /**
+             *  Number of price signals answered.
+             */
+            TCounter completedTicks;
+
+            /**
+             *  Number of messages sent to S2Sim.
+             */
+            TCounter sentMessages;
+
+            /**
+             *  Number of bytes sent to S2Sim.
+             */
+            TCounter sentBytes;
+
+            /**
+             *  Number of messages received from S2Sim.
+             */
+            TCounter receivedMessages;
+
+            /**
+             *  Number of bytes received from S2Sim.
+             */
+            TCounter receivedBytes;
+
+            /**
+             *  Number of messages from S2Sim skipped by its sequence numbers.
+             */
+            TCounter missingMessages;
+
+            /**
+             *  Number of messages from S2Sim that arrived with an old sequence number.
+             */
+            TCounter reorderedMessages;
+
+            /**
+             *  Durations from the connection request until the response.
+             */
+            TDurationList connectionTimes;
+
+            /**
+             *  Durations from sending the consumption until the next price signal.
+             */
+            TDurationList tickLatencies;
+
+            /**
+             *  Time of the first connection request.
+             */
+            TClock::time_point firstConnection;
+
+            /**
+             *  Time of the last connection response.
+             */
+            TClock::time_point lastConnection;
+
+            /**
+             *  Clears all counters.
+             */
+            Statistics( void ) : connectionAttempts( 0 ),
+                                 acceptedConnections( 0 ),
+                                 rejectedConnections( 0 ),
+                                 failedConnections( 0 ),
+                                 completedTicks( 0 ),
+                                 sentMessages( 0 ),
+                                 sentBytes( 0 ),
+                                 receivedMessages( 0 ),
+                                 receivedBytes( 0 ),
+                                 missingMessages( 0 ),
+                                 reorderedMessages( 0 ),
+                                 firstConnection( TClock::time_point::max() ),
+                                 lastConnection( TClock::time_point::min() )
+            {}
+        };
+
+    private:
+    /**
+     *  Run parameters.
+     */
+        Configuration m_configuration;
+
+    /**
+     *  Merged measurements of all households.
+     */
+        Statistics m_statistics;
+
+    /**
+     *  Protects the merged measurements.
+     */
+        std::mutex m_statisticsLock;
+
+    /**
+     *  Start time of the run.
+     */
+        TClock::time_point m_startTime;
+
+    /**
+     *  End time of the run.
+     */
+        TClock::time_point m_endTime;
+
+    /**
+     *  Client id of each household, sent as the sender id of the connection request. NewClientId for households without a previous id.
+     */
+        TClientIdList m_clientIds;
+
+    private:
+    /**
+     *  Defines the special client ids.
+     */
+        enum ClientIdValues
+        {
+            NewClientId = 0xFFFF /**< Sender id of a household connecting for the first time. */
+        };
+
+    /**
+     *  Reads the previous client ids of the households from the client id file, if there is one.
+     */
+        void
+        LoadClientIds( void );
+
+    /**
+     *  Writes the assigned client ids of the households to the client id file, if there is one.
+     */
+        void
+        SaveClientIds( void ) const;
+
+    private:
+    /**
+     *  Simulates a synchronous household until all ticks are answered or the connection drops.
+     *
+     *  @param householdIndex Index of the household.
+     */
+        void
+        RunSynchronousHousehold( const TNumberOfHouseholds householdIndex );
+
+    /**
+     *  Simulates an asynchronous household that uploads its trace once.
+     *
+     *  @param householdIndex Index of the household.
+     */
+        void
+        RunAsynchronousHousehold( const TNumberOfHouseholds householdIndex );
+
+    /**
+     *  Connects the client to the S2Sim client port.
+     *
+     *  @param client Client to be connected.
+     *
+     *  @return Success of the connection.
+     */
+        bool
+        Connect( TCPClient & client );
+
+    /**
+     *  Resolves the address of S2Sim.
+     *
+     *  @param serverAddress Resolved address, the port is not set.
+     *
+     *  @return false if the address is unknown.
+     */
+        bool
+        GetServerAddress( IPAddress & serverAddress ) const;
+
+    /**
+     *  Assigns the next datagram sequence number to a message and sends it as a single datagram.
+     *
+     *  @param socket          Socket of the household.
+     *  @param destination     Datagram port of S2Sim.
+     *  @param message         Message starting with a MessageHeader.
+     *  @param sequenceCounter Sequence numbers of the datagrams, separate from the connection.
+     *  @param statistics      Measurements of the household.
+     *
+     *  @return Success of the transmission.
+     */
+        bool
+        SendDatagram( UDPSocket & socket, IPAddress & destination, void* message, SequenceCounter & sequenceCounter, Statistics & statistics );
+
+    /**
+     *  Assigns the next sequence number of the connection to a message and sends it completely.
+     *
+     *  @param client          Connected client.
+     *  @param message         Message starting with a MessageHeader.
+     *  @param sequenceCounter Sequence numbers of the connection.
+     *  @param statistics      Measurements of the household.
+     *
+     *  @return Success of the transmission.
+     */
+        bool
+        SendMessage( TCPClient & client, void* message, SequenceCounter & sequenceCounter, Statistics & statistics );
+
+    /**
+     *  Receives exactly the requested number of bytes.
+     *
+     *  @param client Connected client.
+     *  @param buffer Buffer that will hold the data.
+     *  @param length Number of bytes to receive.
+     *
+     *  @return Success of the reception.
+     */
+        bool
+        ReceiveAll( TCPClient & client, char* buffer, const TDataSize length );
+
+    /**
+     *  Receives a complete S2Sim message using the data size of its header and checks its sequence number.
+     *
+     *  @param client          Connected client.
+     *  @param sequenceCounter Sequence numbers of the connection.
+     *  @param statistics      Measurements of the household.
+     *
+     *  @return The received message, null if the connection is broken.
+     */
+        SmartPointer<char>
+        ReceiveMessage( TCPClient & client, SequenceCounter & sequenceCounter, Statistics & statistics );
+
+    /**
+     *  Returns the object name a household registers with.
+     *
+     *  @param householdIndex Index of the household.
+     *
+     *  @return Object name of the household.
+     */
+        TClientName
+        GetHouseholdName( const TNumberOfHouseholds householdIndex ) const;
+
+    /**
+     *  Returns a deterministic consumption value that varies over households and time, with a fractional part in quarter watts for the fractional encodings.
+     *
+     *  @param householdIndex Index of the household.
+     *  @param time           Time step of the consumption.
+     *
+     *  @return Consumption of the household at the given time.
+     */
+        TConsumption
+        GetConsumption( const TNumberOfHouseholds householdIndex, const TNumberOfTicks time ) const;
+
+    /**
+     *  Merges the measurements of a household into the total.
+     *
+     *  @param statistics Measurements of the household.
+     */
+        void
+        MergeStatistics( const Statistics & statistics );
+
+    /**
+     *  Returns the given percentile of a list of durations.
+     *
+     *  @param durations  Sorted list of durations.
+     *  @param percentile Requested percentile between 0 and 1.
+     *
+     *  @return Duration at the percentile, 0 for an empty list.
+     */
+        static TMicroseconds
+        GetPercentile( const TDurationList & durations, const double percentile );
+
+    /**
+     *  Returns the elapsed microseconds between two time points.
+     *
+     *  @param begin Start of the interval.
+     *  @param end   End of the interval.
+     *
+     *  @return Elapsed microseconds.
+     */
+        static TMicroseconds
+        GetMicroseconds( const TClock::time_point & begin, const TClock::time_point & end )
+        {
+            return ( std::chrono::duration_cast<std::chrono::microseconds>( end - begin ).count() );
+        }
+
+    public:
+    /**
+     *  Stores the run parameters.
+     *
+     *  @param configuration Run parameters.
+     */
+        LoadGenerator( const Configuration & configuration );
+
+    /**
+     *  Spawns all households with the configured ramp rate and waits for them to finish.
+     */
+        void
+        Run( void );
+
+    /**
+     *  Prints the connect rate, tick latency percentiles and throughput of the last run.
+     */
+        void
+        PrintReport( void );
+
+    /**
+     *  Returns a percentile of the tick latencies of the last run.
+     *
+     *  @param percentile Requested percentile between 0 and 1.
+     *
+     *  @return Tick latency at the percentile, 0 if no tick completed.
+     */
+        TMicroseconds
+        GetTickLatency( const double percentile );
+};
+
+#endif /* LOADGENERATOR_H_ */
@@ -0,0 +1,207 @@
+/**
+ * @file main.cpp
+ * Main file of the load generator that drives a running S2Sim instance with simulated households.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <unistd.h>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include "LoadGenerator.h"
+#include "LogPrint.h"
+
+/**
+ *  Prints the command line options.
+ *
+ *  @param programName Name of the executable.
+ */
+static void
+PrintUsage( const char* programName )
+{
+    std::cerr << "Usage: " << programName << " [options]" << std::endl
+              << "  -s <address>  S2Sim address (default 127.0.0.1)" << std::endl
+              << "  -p <port>     S2Sim client port (default 26999)" << std::endl
+              << "  -U <path>     Connect through the Unix domain socket of S2Sim -U <path> instead of TCP" << std::endl
+              << "  -u <port>     Send the synchronous consumption as UDP datagrams to the port of S2Sim -u <port>, horizon 1 only" << std::endl
+              << "  -n <count>    Number of synchronous households (default 1)" << std::endl
+              << "  -a <count>    Number of asynchronous households (default 0)" << std::endl
+              << "  -H <points>   Horizon, data points per consumption message (default 1)" << std::endl
+              << "  -j <ms>       Maximum random answer delay per tick (default 0)" << std::endl
+              << "  -t <ticks>    Number of ticks per synchronous household (default 10)" << std::endl
+              << "  -r <rate>     Households connecting per second, 0 for all at once (default 0)" << std::endl
+              << "  -R <seconds>  Time resolution of asynchronous traces (default 1)" << std::endl
+              << "  -c <watts>    Average household consumption (default 1000)" << std::endl
+              << "  -x <prefix>   Object name prefix followed by the household index (default load)" << std::endl
+              << "  -f <file>     File with one object name per line, cycled over households" << std::endl
+              << "  -e <encoding> Consumption encoding: integer, float:<bits>, fixed:<bits> or delta:<bits> with the number of fractional bits (default integer)" << std::endl
+              << "  -z            Send asynchronous traces compressed" << std::endl
+              << "  -I <file>     Client id file, households reconnect with the ids in it and the assigned ids are written back" << std::endl
+              << "  -L <ms>       Fail if the p99 tick latency exceeds the limit or no tick completed (default 0, no limit)" << std::endl
+              << "  -v            Print S2Sim library warnings" << std::endl;
+}
+
+/**
+ *  Parses a consumption encoding given on the command line, optionally followed by a colon and the number of fractional bits.
+ *
+ *  @param text            Encoding name.
+ *  @param payloadEncoding Parsed encoding.
+ *
+ *  @return false if the text is not a supported encoding.
+ */
+static bool
+ParsePayloadEncoding( const std::string & text, PayloadEncoding & payloadEncoding )
+{
+    std::string::size_type separator = text.find( ':' );
+    std::string name = text.substr( 0, separator );
+    unsigned long fractionalBits = 0;
+    if ( separator != std::string::npos )
+    {
+        char* end;
+        fractionalBits = strtoul( text.c_str() + separator + 1, &end, 10 );
+        if ( *end != '\0' || end == text.c_str() + separator + 1 || fractionalBits > PayloadEncoding::MaximumFractionalBits )
+        {
+            return ( false );
+        }
+    }
+
+    PayloadEncoding::TEncoding encoding;
+    if ( name == "integer" )
+    {
+        encoding = PayloadEncoding::IntegerEncoding;
+    }
+    else if ( name == "float" )
+    {
+        encoding = PayloadEncoding::FloatEncoding;
+    }
+    else if ( name == "fixed" )
+    {
+        encoding = PayloadEncoding::FixedPointEncoding;
+    }
+    else if ( name == "delta" )
+    {
+        encoding = PayloadEncoding::DeltaEncoding;
+    }
+    else
+    {
+        return ( false );
+    }
+    payloadEncoding = PayloadEncoding( encoding, ( PayloadEncoding::TFractionalBits )fractionalBits );
+    return ( payloadEncoding.IsSupported() );
+}
+
+int
+main( int argc, char **argv )
+{
+    LoadGenerator::Configuration configuration;
+    LoadGenerator::TMilliseconds latencyLimit = 0;
+    LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::ErrorOnly );
+
+    int option;
+    while ( ( option = getopt( argc, argv, "s:p:n:a:H:j:t:r:R:c:x:f:e:zI:vU:u:L:" ) ) != -1 )
+    {
+        switch ( option )
+        {
+            case 's':
+                configuration.serverAddress = optarg;
+                break;
+            case 'p':
+                configuration.serverPort = ( IPAddress::TPort )std::stoul( optarg );
+                break;
+            case 'U':
+                configuration.localPath = optarg;
+                break;
+            case 'u':
+                configuration.datagramPort = ( IPAddress::TPort )std::stoul( optarg );
+                break;
+            case 'n':
+                configuration.numberOfSynchronousHouseholds = ( LoadGenerator::TNumberOfHouseholds )std::stoul( optarg );
+                break;
+            case 'a':
+                configuration.numberOfAsynchronousHouseholds = ( LoadGenerator::TNumberOfHouseholds )std::stoul( optarg );
+                break;
+            case 'H':
+                configuration.horizon = std::max( ( LoadGenerator::TNumberOfDataPoints )std::stoul( optarg ), ( LoadGenerator::TNumberOfDataPoints )1 );
+                break;
+            case 'j':
+                configuration.jitter = ( LoadGenerator::TMilliseconds )std::stoul( optarg );
+                break;
+            case 't':
+                configuration.numberOfTicks = ( LoadGenerator::TNumberOfTicks )std::stoul( optarg );
+                break;
+            case 'r':
+                configuration.rampRate = ( LoadGenerator::TRampRate )std::stoul( optarg );
+                break;
+            case 'R':
+                configuration.asynchronousResolution = ( LoadGenerator::TTimeResolution )std::stoul( optarg );
+                break;
+            case 'c':
+                configuration.baseConsumption = ( LoadGenerator::TDataPoint )std::stoul( optarg );
+                break;
+            case 'x':
+                configuration.namePrefix = optarg;
+                break;
+            case 'f':
+            {
+                std::ifstream nameFile( optarg );
+                if ( !nameFile.is_open() )
+                {
+                    std::cerr << "Cannot open name file: " << optarg << std::endl;
+                    return ( EXIT_FAILURE );
+                }
+                LoadGenerator::TClientName name;
+                while ( std::getline( nameFile, name ) )
+                {
+                    if ( !name.empty() )
+                    {
+                        configuration.names.push_back( name );
+                    }
+                }
+                break;
+            }
+            case 'e':
+                if ( !ParsePayloadEncoding( optarg, configuration.payloadEncoding ) )
+                {
+                    std::cerr << "Unknown encoding: " << optarg << std::endl;
+                    PrintUsage( argv[0] );
+                    return ( EXIT_FAILURE );
+                }
+                break;
+            case 'z':
+                configuration.compressTraces = true;
+                break;
+            case 'I':
+                configuration.clientIdFile = optarg;
+                break;
+            case 'L':
+                latencyLimit = ( LoadGenerator::TMilliseconds )std::stoul( optarg );
+                break;
+            case 'v':
+                LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::Warnings );
+                break;
+            default:
+                PrintUsage( argv[0] );
+                return ( EXIT_FAILURE );
+        }
+    }
+
+    LoadGenerator loadGenerator( configuration );
+    loadGenerator.Run();
+    loadGenerator.PrintReport();
+    if ( latencyLimit > 0 )
+    {
+        LoadGenerator::TMicroseconds tickLatency = loadGenerator.GetTickLatency( 0.99 );
+        if ( tickLatency == 0 )
+        {
+            std::cerr << "No tick completed" << std::endl;
+            return ( EXIT_FAILURE );
+        }
+        if ( tickLatency > ( LoadGenerator::TMicroseconds )latencyLimit * 1000 )
+        {
+            std::cerr << "p99 tick latency of " << tickLatency / 1e3 << " ms exceeds the limit of " << latencyLimit << " ms" << std::endl;
+            return ( EXIT_FAILURE );
+        }
+    }
+    return ( EXIT_SUCCESS );
+}
@@ -0,0 +1,135 @@
+/**
+ * @file GridModel.cpp
+ * Implements the GridModel class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "GridModel.h"
+#include <algorithm>
+
+GridModel::GridModel( const TNumberOfLoads numberOfFeeders,
+                      const TParameter nominalVoltage,
+                      const TParameter impedance,
+                      const bool acceptUnknownLoads ) : m_numberOfFeeders( numberOfFeeders > 0 ? numberOfFeeders : 1 ),
+                                                        m_nominalVoltage( nominalVoltage ),
+                                                        m_impedance( impedance ),
+                                                        m_acceptUnknownLoads( acceptUnknownLoads )
+{
+}
+
+GridModel::TNumberOfLoads
+GridModel::AddLoad( const TLoadName & loadName )
+{
+    TNumberOfLoads loadIndex = ( TNumberOfLoads )this->m_loads.size();
+    Load load;
+    load.feeder = loadIndex % this->m_numberOfFeeders;
+    load.position = 0.0;
+    load.wattage = 0;
+    load.deviation = 0.0;
+    this->m_loads.push_back( load );
+    this->m_loadIndices[loadName] = loadIndex;
+    return ( loadIndex );
+}
+
+void
+GridModel::PlaceLoads( void )
+{
+    TNumberOfLoads loadsPerFeeder = ( TNumberOfLoads )( this->m_loads.size() + this->m_numberOfFeeders - 1 ) / this->m_numberOfFeeders;
+    for ( TNumberOfLoads loadIndex = 0; loadIndex < this->m_loads.size(); ++loadIndex )
+    {
+        this->m_loads[loadIndex].position = ( TParameter )( loadIndex / this->m_numberOfFeeders + 1 ) / loadsPerFeeder;
+    }
+}
+
+void
+GridModel::AddLoads( const std::vector<TLoadName> & loadNames )
+{
+    for ( auto & loadName : loadNames )
+    {
+        if ( this->m_loadIndices.find( loadName ) == this->m_loadIndices.end() )
+        {
+            this->AddLoad( loadName );
+        }
+    }
+    this->PlaceLoads();
+}
+
+bool
+GridModel::LoadExists( const TLoadName & loadName )
+{
+    if ( this->m_loadIndices.find( loadName ) != this->m_loadIndices.end() )
+    {
+        return ( true );
+    }
+    if ( this->m_acceptUnknownLoads )
+    {
+        this->AddLoad( loadName );
+        this->PlaceLoads();
+        return ( true );
+    }
+    return ( false );
+}
+
+std::vector<GridModel::TLoadName>
+GridModel::GetLoadNames( void ) const
+{
+    std::vector<TLoadName> loadNames;
+    loadNames.reserve( this->m_loadIndices.size() );
+    for ( const auto & load : this->m_loadIndices )
+    {
+        loadNames.push_back( load.first );
+    }
+    return ( loadNames );
+}
+
+void
+GridModel::SetWattage( const TLoadName & loadName, const TWattage wattage )
+{
+    TLoadIndexMap::const_iterator load = this->m_loadIndices.find( loadName );
+    if ( load != this->m_loadIndices.end() )
+    {
+        this->m_loads[load->second].wattage = wattage;
+    }
+}
+
+GridModel::TWattage
+GridModel::GetWattage( const TLoadName & loadName ) const
+{
+    TLoadIndexMap::const_iterator load = this->m_loadIndices.find( loadName );
+    if ( load != this->m_loadIndices.end() )
+    {
+        return ( this->m_loads[load->second].wattage );
+    }
+    return ( 0 );
+}
+
+GridModel::TVoltage
+GridModel::GetVoltage( const TLoadName & loadName ) const
+{
+    TLoadIndexMap::const_iterator load = this->m_loadIndices.find( loadName );
+    TParameter deviation = ( load != this->m_loadIndices.end() ) ? this->m_loads[load->second].deviation : 0.0;
+    return ( ( TVoltage )( this->m_nominalVoltage * ( 1.0 - deviation / 100.0 ) * VoltageScale ) );
+}
+
+GridModel::TVoltage
+GridModel::GetVoltageDeviation( const TLoadName & loadName ) const
+{
+    TLoadIndexMap::const_iterator load = this->m_loadIndices.find( loadName );
+    TParameter deviation = ( load != this->m_loadIndices.end() ) ? this->m_loads[load->second].deviation : 0.0;
+    return ( ( TVoltage )( deviation * VoltageScale ) );
+}
+
+void
+GridModel::Solve( void )
+{
+    std::vector<TParameter> feederConsumptions( this->m_numberOfFeeders, 0.0 );
+    for ( auto & load : this->m_loads )
+    {
+        feederConsumptions[load.feeder] += load.wattage / 1000.0;
+    }
+    for ( auto & load : this->m_loads )
+    {
+        load.deviation = std::min( this->m_impedance * feederConsumptions[load.feeder] * load.position, 100.0 );
+    }
+}
@@ -0,0 +1,233 @@
+/**
+ * @file GridModel.h
+ * Defines the GridModel class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef GRIDMODEL_H_
+#define GRIDMODEL_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/**
+ *  @brief Synthetic radial distribution grid standing in for the OpenDSS circuit.
+
+    The loads are spread evenly over a number of feeders. Each feeder is a single line with the loads placed along it, and the voltage drop at a load grows with the total feeder consumption and with its distance from the substation. This is far from a power flow solution, but it reacts to the consumption the way a controller expects, at a fraction of the cost.
+ */
+class GridModel
+{
+    public:
+    /**
+     *  Defines the object name type.
+     */
+        typedef std::string TLoadName;
+
+    /**
+     *  Defines the consumption type in Watts, as sent by S2Sim.
+     */
+        typedef unsigned int TWattage;
+
+    /**
+     *  Defines the voltage type in the Q15 fixed point format of OpenDSSManagerBackup.m.
+     */
+        typedef unsigned int TVoltage;
+
+    /**
+     *  Defines the type for load and feeder counts.
+     */
+        typedef unsigned int TNumberOfLoads;
+
+    /**
+     *  Defines the type for the model parameters.
+     */
+        typedef double TParameter;
+
+    /**
+     *  Defines the scaling of the fixed point voltage values.
+     */
+        enum FixedPointValues
+        {
+            VoltageScale = 32768 /**< Voltage values are multiplied by this value before transmission. */
+        };
+
+    private:
+    /**
+     *  State of a single load.
+     */
+        struct Load
+        {
+            /**
+             *  Feeder the load is connected to.
+             */
+            TNumberOfLoads feeder;
+
+            /**
+             *  Relative distance from the substation, between 0 and 1.
+             */
+            TParameter position;
+
+            /**
+             *  Consumption set by S2Sim.
+             */
+            TWattage wattage;
+
+            /**
+             *  Voltage deviation from the nominal voltage in percent, calculated by the last solution.
+             */
+            TParameter deviation;
+        };
+
+    /**
+     *  Defines the mapping from object names to load indices.
+     */
+        typedef std::unordered_map<TLoadName, TNumberOfLoads> TLoadIndexMap;
+
+    private:
+    /**
+     *  All loads of the grid.
+     */
+        std::vector<Load> m_loads;
+
+    /**
+     *  Index of each load by name.
+     */
+        TLoadIndexMap m_loadIndices;
+
+    /**
+     *  Number of feeders the loads are spread over.
+     */
+        TNumberOfLoads m_numberOfFeeders;
+
+    /**
+     *  Nominal voltage of the loads in Volts.
+     */
+        TParameter m_nominalVoltage;
+
+    /**
+     *  Voltage drop in percent per kW of feeder consumption at the end of a feeder.
+     */
+        TParameter m_impedance;
+
+    /**
+     *  Whether unknown names are added as new loads instead of being rejected.
+     */
+        bool m_acceptUnknownLoads;
+
+    private:
+    /**
+     *  Places a new load on the next feeder.
+     *
+     *  @param loadName Name of the load.
+     *
+     *  @return Index of the new load.
+     */
+        TNumberOfLoads
+        AddLoad( const TLoadName & loadName );
+
+    /**
+     *  Places the loads along their feeders according to their order of addition.
+     */
+        void
+        PlaceLoads( void );
+
+    public:
+    /**
+     *  Creates an empty grid.
+     *
+     *  @param numberOfFeeders    Number of feeders.
+     *  @param nominalVoltage     Nominal voltage of the loads in Volts.
+     *  @param impedance          Voltage drop in percent per kW of feeder consumption at the end of a feeder.
+     *  @param acceptUnknownLoads Whether unknown names are added as new loads.
+     */
+        GridModel( const TNumberOfLoads numberOfFeeders,
+                   const TParameter nominalVoltage,
+                   const TParameter impedance,
+                   const bool acceptUnknownLoads );
+
+    /**
+     *  Adds the given loads to the grid.
+     *
+     *  @param loadNames Names of the loads.
+     */
+        void
+        AddLoads( const std::vector<TLoadName> & loadNames );
+
+    /**
+     *  Checks whether a load exists, adding it first if unknown loads are accepted.
+     *
+     *  @param loadName Name of the load.
+     *
+     *  @return Whether the load exists.
+     */
+        bool
+        LoadExists( const TLoadName & loadName );
+
+    /**
+     *  Sets the consumption of a load. Unknown loads are ignored like in OpenDSS.
+     *
+     *  @param loadName Name of the load.
+     *  @param wattage  New consumption.
+     */
+        void
+        SetWattage( const TLoadName & loadName, const TWattage wattage );
+
+    /**
+     *  Returns the consumption of a load.
+     *
+     *  @param loadName Name of the load.
+     *
+     *  @return Consumption of the load, 0 for unknown loads.
+     */
+        TWattage
+        GetWattage( const TLoadName & loadName ) const;
+
+    /**
+     *  Returns the voltage of a load calculated by the last solution.
+     *
+     *  @param loadName Name of the load.
+     *
+     *  @return Fixed point voltage of the load.
+     */
+        TVoltage
+        GetVoltage( const TLoadName & loadName ) const;
+
+    /**
+     *  Returns the voltage deviation of a load calculated by the last solution.
+     *
+     *  @param loadName Name of the load.
+     *
+     *  @return Fixed point deviation in percent below the nominal voltage.
+     */
+        TVoltage
+        GetVoltageDeviation( const TLoadName & loadName ) const;
+
+    /**
+     *  Returns the names of all loads.
+     *
+     *  @return Names of the loads in no particular order.
+     */
+        std::vector<TLoadName>
+        GetLoadNames( void ) const;
+
+    /**
+     *  Calculates the voltages of all loads from the current consumptions.
+     */
+        void
+        Solve( void );
+
+    /**
+     *  Returns the number of loads in the grid.
+     *
+     *  @return Number of loads.
+     */
+        TNumberOfLoads
+        GetNumberOfLoads( void ) const
+        {
+            return ( ( TNumberOfLoads )this->m_loads.size() );
+        }
+};
+
+#endif /* GRIDMODEL_H_ */
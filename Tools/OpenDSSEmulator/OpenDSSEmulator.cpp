@@ -0,0 +1,258 @@
+/**
+ * @file OpenDSSEmulator.cpp
+ * Implements the OpenDSSEmulator class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "OpenDSSEmulator.h"
+#include <thread>
+#include <vector>
+#include <iostream>
+
+/**
+ *  Upper bound for the length of a request, protecting against a corrupted stream.
+ */
+static const OpenDSSEmulator::TMessageLength MaximumMessageLength = 64 * 1024;
+
+OpenDSSEmulator::OpenDSSEmulator( const Configuration & configuration, GridModel & gridModel ) : m_configuration( configuration ),
+                                                                                                 m_gridModel( gridModel ),
+                                                                                                 m_numberOfRequests( 0 ),
+                                                                                                 m_numberOfSolutions( 0 ),
+                                                                                                 m_solutionTime( TClock::duration::zero() )
+{
+}
+
+bool
+OpenDSSEmulator::Connect( TCPClient & client )
+{
+    if ( !this->m_configuration.localPath.empty() )
+    {
+        return ( client.ConnectLocal( this->m_configuration.localPath + ".opendss" ) );
+    }
+    if ( !this->m_configuration.sharedMemoryName.empty() )
+    {
+        return ( client.ConnectSharedMemory( "/" + this->m_configuration.sharedMemoryName + ".opendss" ) );
+    }
+    IPAddress serverAddress;
+    in_addr_t address = inet_addr( this->m_configuration.serverAddress.c_str() );
+    if ( address == INADDR_NONE )
+    {
+        hostent* host = gethostbyname( this->m_configuration.serverAddress.c_str() );
+        if ( host == nullptr )
+        {
+            ErrorPrint( "Unknown server address: ", this->m_configuration.serverAddress );
+            return ( false );
+        }
+        memcpy( &address, host->h_addr_list[0], sizeof( address ) );
+    }
+    serverAddress.SetAddress( ntohl( address ) );
+    serverAddress.SetPort( this->m_configuration.serverPort );
+    return ( client.Connect( serverAddress ) );
+}
+
+bool
+OpenDSSEmulator::ReceiveAll( TCPClient & client, char* buffer, const size_t length )
+{
+    size_t receivedSize = 0;
+    while ( receivedSize < length )
+    {
+        TCPClient::TNumberOfBytes result = client.ReceiveData( buffer + receivedSize, length - receivedSize );
+        if ( result == 0 || result > length - receivedSize )
+        {
+            return ( false );
+        }
+        receivedSize += result;
+    }
+    return ( true );
+}
+
+bool
+OpenDSSEmulator::SendResponse( TCPClient & client, const TMessageType messageType, const unsigned int* values, const size_t numberOfValues )
+{
+    unsigned int response[3];
+    response[0] = htonl( messageType );
+    for ( size_t valueIndex = 0; valueIndex < numberOfValues; ++valueIndex )
+    {
+        response[valueIndex + 1] = htonl( values[valueIndex] );
+    }
+
+    return ( this->SendAll( client, ( char* )response, sizeof( TMessageType ) + numberOfValues * sizeof( unsigned int ) ) );
+}
+
+bool
+OpenDSSEmulator::SendAll( TCPClient & client, const char* buffer, const size_t length )
+{
+    size_t sentSize = 0;
+    while ( sentSize < length )
+    {
+        TCPClient::TNumberOfBytes result = client.SendData( ( char* )buffer + sentSize, length - sentSize );
+        if ( result == 0 || result > length - sentSize )
+        {
+            return ( false );
+        }
+        sentSize += result;
+    }
+    return ( true );
+}
+
+bool
+OpenDSSEmulator::SendLoadNames( TCPClient & client )
+{
+    std::vector<GridModel::TLoadName> loadNames = this->m_gridModel.GetLoadNames();
+    std::vector<char> response;
+    for ( const auto & loadName : loadNames )
+    {
+        unsigned int header[2] = { htonl( ClientListEntryType ), htonl( ( unsigned int )loadName.size() ) };
+        response.insert( response.end(), ( char* )header, ( char* )header + sizeof( header ) );
+        response.insert( response.end(), loadName.begin(), loadName.end() );
+    }
+    unsigned int end[2] = { htonl( ClientListEndType ), htonl( ( unsigned int )loadNames.size() ) };
+    response.insert( response.end(), ( char* )end, ( char* )end + sizeof( end ) );
+    LogPrint( "Client list of ", loadNames.size(), " loads" );
+    return ( this->SendAll( client, response.data(), response.size() ) );
+}
+
+void
+OpenDSSEmulator::Delay( const TMicroseconds delay )
+{
+    if ( delay > 0 )
+    {
+        std::this_thread::sleep_for( std::chrono::microseconds( delay ) );
+    }
+}
+
+void
+OpenDSSEmulator::AdvanceTimeStep( void )
+{
+    TClock::time_point solutionStart = TClock::now();
+    this->m_gridModel.Solve();
+    Delay( this->m_configuration.solveLatency + this->m_configuration.perLoadSolveLatency * this->m_gridModel.GetNumberOfLoads() );
+    this->m_solutionTime += TClock::now() - solutionStart;
+    ++this->m_numberOfSolutions;
+
+    if ( this->m_configuration.reportInterval > 0 && this->m_numberOfSolutions % this->m_configuration.reportInterval == 0 )
+    {
+        std::cout << "Solutions: " << this->m_numberOfSolutions
+                  << ", requests: " << this->m_numberOfRequests
+                  << ", loads: " << this->m_gridModel.GetNumberOfLoads()
+                  << ", mean solution time: " << std::chrono::duration_cast<std::chrono::microseconds>( this->m_solutionTime ).count() / this->m_numberOfSolutions << " us" << std::endl;
+    }
+}
+
+bool
+OpenDSSEmulator::ProcessMessage( TCPClient & client, const char* message, const size_t length )
+{
+    if ( length < sizeof( TMessageType ) )
+    {
+        ErrorPrint( "Request without message type of length: ", length );
+        return ( true );
+    }
+
+    ++this->m_numberOfRequests;
+    TMessageType messageType;
+    memcpy( &messageType, message, sizeof( TMessageType ) );
+    messageType = ntohl( messageType );
+    const char* currentAddress = message + sizeof( TMessageType );
+    size_t remainingSize = length - sizeof( TMessageType );
+
+    if ( messageType == ClientCheckRequestType )
+    {
+        GridModel::TLoadName loadName( currentAddress, remainingSize );
+        TClientCheckResult checkResult = this->m_gridModel.LoadExists( loadName ) ? ClientExists : ClientDoesNotExist;
+        LogPrint( "Client check for \"", loadName, "\": ", checkResult );
+        Delay( this->m_configuration.queryLatency );
+        return ( this->SendResponse( client, ClientCheckResultType, &checkResult, 1 ) );
+    }
+    else if ( messageType == ClientSetWattageType )
+    {
+        if ( remainingSize < sizeof( GridModel::TWattage ) )
+        {
+            ErrorPrint( "Set wattage request too short: ", length );
+            return ( true );
+        }
+        GridModel::TWattage wattage;
+        memcpy( &wattage, currentAddress, sizeof( GridModel::TWattage ) );
+        GridModel::TLoadName loadName( currentAddress + sizeof( GridModel::TWattage ), remainingSize - sizeof( GridModel::TWattage ) );
+        this->m_gridModel.SetWattage( loadName, ntohl( wattage ) );
+        return ( true );
+    }
+    else if ( messageType == ClientGetWattageType )
+    {
+        GridModel::TWattage wattage = this->m_gridModel.GetWattage( GridModel::TLoadName( currentAddress, remainingSize ) );
+        Delay( this->m_configuration.queryLatency );
+        return ( this->SendResponse( client, ClientWattageResultType, &wattage, 1 ) );
+    }
+    else if ( messageType == AdvanceTimeStepType )
+    {
+        this->AdvanceTimeStep();
+        return ( true );
+    }
+    else if ( messageType == ClientGetVoltageType )
+    {
+        GridModel::TVoltage voltage = this->m_gridModel.GetVoltage( GridModel::TLoadName( currentAddress, remainingSize ) );
+        Delay( this->m_configuration.queryLatency );
+        return ( this->SendResponse( client, ClientVoltageResultType, &voltage, 1 ) );
+    }
+    else if ( messageType == ClientGetVoltageDeviationType )
+    {
+        GridModel::TVoltage deviation = this->m_gridModel.GetVoltageDeviation( GridModel::TLoadName( currentAddress, remainingSize ) );
+        Delay( this->m_configuration.queryLatency );
+        return ( this->SendResponse( client, ClientVoltageDeviationResultType, &deviation, 1 ) );
+    }
+    else if ( messageType == ClientGetVoltageDeviationAndConsumptionType )
+    {
+        GridModel::TLoadName loadName( currentAddress, remainingSize );
+        unsigned int values[2] = { this->m_gridModel.GetVoltageDeviation( loadName ), this->m_gridModel.GetWattage( loadName ) };
+        Delay( this->m_configuration.queryLatency );
+        return ( this->SendResponse( client, ClientVoltageDeviationAndConsumptionResultType, values, 2 ) );
+    }
+    else if ( messageType == ClientListRequestType )
+    {
+        Delay( this->m_configuration.queryLatency );
+        return ( this->SendLoadNames( client ) );
+    }
+
+    ErrorPrint( "Unknown Message Type received: ", messageType );
+    return ( true );
+}
+
+void
+OpenDSSEmulator::Run( void )
+{
+    std::vector<char> message;
+    while ( true )
+    {
+        SmartPointer<TCPClient> client = CreateObject<TCPClient>();
+        if ( !this->Connect( *client ) )
+        {
+            LogPrint( "No connection, retrying..." );
+            std::this_thread::sleep_for( std::chrono::seconds( 1 ) );
+            continue;
+        }
+        std::cout << "Connected to S2Sim" << std::endl;
+
+        while ( true )
+        {
+            TMessageLength messageLength;
+            if ( !this->ReceiveAll( *client, ( char* )&messageLength, sizeof( TMessageLength ) ) )
+            {
+                break;
+            }
+            messageLength = ntohl( messageLength );
+            if ( messageLength < ( TMessageLength )sizeof( TMessageLength ) || messageLength > MaximumMessageLength )
+            {
+                ErrorPrint( "Invalid request length: ", messageLength );
+                break;
+            }
+
+            message.resize( messageLength - sizeof( TMessageLength ) );
+            if ( !this->ReceiveAll( *client, message.data(), message.size() ) ||
+                 !this->ProcessMessage( *client, message.data(), message.size() ) )
+            {
+                break;
+            }
+        }
+        WarningPrint( "Connection to S2Sim lost, reconnecting" );
+    }
+}
@@ -0,0 +1,272 @@
+/**
+ * @file OpenDSSEmulator.h
+ * Defines the OpenDSSEmulator class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef OPENDSSEMULATOR_H_
+#define OPENDSSEMULATOR_H_
+
+#include <string>
+#include <chrono>
+#include "TCPClient.h"
+#include "IPAddress.h"
+#include "SmartPointer.hpp"
+#include "GridModel.h"
+
+/**
+ *  @brief Stand-in for OpenDSSManagerBackup.m that serves the MatlabManager protocol from a GridModel.
+
+    Like the Matlab manager, the emulator connects to the OpenDSS port of S2Sim, reconnects whenever the connection drops and answers every request with the same message layout. The time OpenDSS spends solving the circuit is reproduced with a configurable delay, so that the S2Sim tick pipeline can be measured with a realistic or a negligible grid solver.
+ */
+class OpenDSSEmulator
+{
+    public:
+    /**
+     *  Defines the message type. Must match MatlabManager::TMessageType.
+     */
+        typedef unsigned int TMessageType;
+
+    /**
+     *  Message types of the MatlabManager protocol.
+     */
+        enum MessageTypeValues
+        {
+            ClientCheckRequestType = ( TMessageType )0x00000001, /**< Checks whether a client exists. */
+            ClientCheckResultType = ( TMessageType )0x00000002, /**< Result of the client existence check. */
+            ClientSetWattageType = ( TMessageType )0x00000003, /**< Sets the consumption of an object. */
+            ClientGetWattageType = ( TMessageType )0x00000004, /**< Gets the consumption of an object. */
+            ClientWattageResultType = ( TMessageType )0x00000005, /**< Result of the consumption get request. */
+            AdvanceTimeStepType = ( TMessageType )0x00000006, /**< Solves the circuit for the end of a time step. */
+            ClientGetVoltageType = ( TMessageType )0x00000007, /**< Gets the terminal voltage of an object. */
+            ClientVoltageResultType = ( TMessageType )0x00000008, /**< Result of the voltage get request. */
+            ClientGetVoltageDeviationType = ( TMessageType )0x00000009, /**< Gets the terminal voltage deviation of an object. */
+            ClientVoltageDeviationResultType = ( TMessageType )0x0000000A, /**< Result of the voltage deviation get request. */
+            ClientGetVoltageDeviationAndConsumptionType = ( TMessageType )0x0000000B, /**< Gets the deviation and consumption of an object. */
+            ClientVoltageDeviationAndConsumptionResultType = ( TMessageType )0x0000000C, /**< Result of the deviation and consumption get request. */
+            ClientListRequestType = ( TMessageType )0x0000000D, /**< Gets the names of all objects. */
+            ClientListEntryType = ( TMessageType )0x0000000E, /**< Name of a single object in the result of the list request. */
+            ClientListEndType = ( TMessageType )0x0000000F /**< Number of names, ending the result of the list request. */
+        };
+
+    /**
+     *  Defines the client check result. Must match MatlabManager::TClientCheckResult.
+     */
+        typedef unsigned int TClientCheckResult;
+
+    /**
+     *  Values of the client check result.
+     */
+        enum ClientCheckResultValues
+        {
+            ClientExists = ( TClientCheckResult )0x00000001, /**< The object exists. */
+            ClientDoesNotExist = ( TClientCheckResult )0x00000002 /**< The object does not exist. */
+        };
+
+    /**
+     *  Defines the length prefix of the requests, which includes its own size.
+     */
+        typedef int TMessageLength;
+
+    /**
+     *  Defines the type for a delay in microseconds.
+     */
+        typedef unsigned int TMicroseconds;
+
+    /**
+     *  Defines the type for request and solution counters.
+     */
+        typedef unsigned long long TCounter;
+
+    /**
+     *  Defines the clock used for the solution time measurements.
+     */
+        typedef std::chrono::steady_clock TClock;
+
+    /**
+     *  Run parameters of the emulator.
+     */
+        struct Configuration
+        {
+            /**
+             *  Address of S2Sim.
+             */
+            std::string serverAddress;
+
+            /**
+             *  OpenDSS port of S2Sim.
+             */
+            IPAddress::TPort serverPort;
+
+            /**
+             *  Path given to S2Sim with -U, the Unix domain socket <path>.opendss is used instead of TCP if it is not empty.
+             */
+            std::string localPath;
+
+            /**
+             *  Shared memory name given to S2Sim with -S, empty to connect through TCP.
+             */
+            std::string sharedMemoryName;
+
+            /**
+             *  Fixed delay of each circuit solution.
+             */
+            TMicroseconds solveLatency;
+
+            /**
+             *  Additional delay of each circuit solution per load.
+             */
+            TMicroseconds perLoadSolveLatency;
+
+            /**
+             *  Delay before answering each query, modeling the COM round trip of the Matlab manager.
+             */
+            TMicroseconds queryLatency;
+
+            /**
+             *  Number of solutions between two printed reports, 0 disables the reports.
+             */
+            TCounter reportInterval;
+
+            /**
+             *  Sets the default parameters matching a local S2Sim instance.
+             */
+            Configuration( void ) : serverAddress( "127.0.0.1" ),
+                                    serverPort( 26998 ),
+                                    localPath(),
+                                    sharedMemoryName(),
+                                    solveLatency( 0 ),
+                                    perLoadSolveLatency( 0 ),
+                                    queryLatency( 0 ),
+                                    reportInterval( 0 )
+            {}
+        };
+
+    private:
+    /**
+     *  Run parameters.
+     */
+        Configuration m_configuration;
+
+    /**
+     *  Grid answering the requests.
+     */
+        GridModel & m_gridModel;
+
+    /**
+     *  Number of processed requests.
+     */
+        TCounter m_numberOfRequests;
+
+    /**
+     *  Number of circuit solutions.
+     */
+        TCounter m_numberOfSolutions;
+
+    /**
+     *  Total time spent in circuit solutions including the artificial delay.
+     */
+        TClock::duration m_solutionTime;
+
+    private:
+    /**
+     *  Connects to S2Sim.
+     *
+     *  @param client Client to be connected.
+     *
+     *  @return Success of the connection.
+     */
+        bool
+        Connect( TCPClient & client );
+
+    /**
+     *  Receives exactly the requested number of bytes.
+     *
+     *  @param client Connected client.
+     *  @param buffer Buffer that will hold the data.
+     *  @param length Number of bytes to receive.
+     *
+     *  @return Success of the reception.
+     */
+        bool
+        ReceiveAll( TCPClient & client, char* buffer, const size_t length );
+
+    /**
+     *  Sends exactly the given number of bytes.
+     *
+     *  @param client Connected client.
+     *  @param buffer Data to be sent.
+     *  @param length Number of bytes to send.
+     *
+     *  @return Success of the transmission.
+     */
+        bool
+        SendAll( TCPClient & client, const char* buffer, const size_t length );
+
+    /**
+     *  Sends the names of all loads, each in a ClientListEntryType message, followed by a ClientListEndType message.
+     *
+     *  @param client Connected client.
+     *
+     *  @return Success of the transmission.
+     */
+        bool
+        SendLoadNames( TCPClient & client );
+
+    /**
+     *  Sends a response consisting of a message type and up to two values.
+     *
+     *  @param client         Connected client.
+     *  @param messageType    Type of the response.
+     *  @param values         Values following the type in host byte order.
+     *  @param numberOfValues Number of values.
+     *
+     *  @return Success of the transmission.
+     */
+        bool
+        SendResponse( TCPClient & client, const TMessageType messageType, const unsigned int* values, const size_t numberOfValues );
+
+    /**
+     *  Processes a single request and sends its response.
+     *
+     *  @param client  Connected client.
+     *  @param message Request without the length prefix.
+     *  @param length  Length of the request.
+     *
+     *  @return False if the connection is broken.
+     */
+        bool
+        ProcessMessage( TCPClient & client, const char* message, const size_t length );
+
+    /**
+     *  Solves the circuit and applies the configured solution delay.
+     */
+        void
+        AdvanceTimeStep( void );
+
+    /**
+     *  Waits for the given duration.
+     *
+     *  @param delay Duration to wait.
+     */
+        static void
+        Delay( const TMicroseconds delay );
+
+    public:
+    /**
+     *  Stores the run parameters.
+     *
+     *  @param configuration Run parameters.
+     *  @param gridModel     Grid answering the requests.
+     */
+        OpenDSSEmulator( const Configuration & configuration, GridModel & gridModel );
+
+    /**
+     *  Serves S2Sim until the process is terminated, reconnecting whenever the connection drops.
+     */
+        void
+        Run( void );
+};
+
+#endif /* OPENDSSEMULATOR_H_ */
@@ -0,0 +1,144 @@
+/**
+ * @file main.cpp
+ * Main file of the OpenDSS emulator that serves the OpenDSS port of S2Sim from a synthetic grid.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <unistd.h>
+#include <fstream>
+#include <iostream>
+#include "OpenDSSEmulator.h"
+#include "GridModel.h"
+#include "LogPrint.h"
+
+/**
+ *  Prints the command line options.
+ *
+ *  @param programName Name of the executable.
+ */
+static void
+PrintUsage( const char* programName )
+{
+    std::cerr << "Usage: " << programName << " [options]" << std::endl
+              << "  -s <address>  S2Sim address (default 127.0.0.1)" << std::endl
+              << "  -p <port>     S2Sim OpenDSS port (default 26998)" << std::endl
+              << "  -U <path>     Connect through the Unix domain socket of S2Sim -U <path> instead of TCP" << std::endl
+              << "  -S <name>     Connect through the shared memory of S2Sim -S <name> instead of TCP" << std::endl
+              << "  -n <count>    Number of generated loads (default 100)" << std::endl
+              << "  -x <prefix>   Generated load name prefix followed by the load index (default load)" << std::endl
+              << "  -f <file>     File with one load name per line, replaces the generated loads" << std::endl
+              << "  -A            Accept and add unknown load names" << std::endl
+              << "  -F <count>    Number of feeders (default 4)" << std::endl
+              << "  -V <volts>    Nominal load voltage (default 240)" << std::endl
+              << "  -z <percent>  Voltage drop per kW of feeder load at the feeder end (default 0.05)" << std::endl
+              << "  -l <us>       Fixed solution delay (default 0)" << std::endl
+              << "  -L <us>       Additional solution delay per load (default 0)" << std::endl
+              << "  -q <us>       Delay before each query response (default 0)" << std::endl
+              << "  -i <count>    Solutions between printed reports, 0 for none (default 0)" << std::endl
+              << "  -v            Print all requests" << std::endl;
+}
+
+int
+main( int argc, char **argv )
+{
+    OpenDSSEmulator::Configuration configuration;
+    GridModel::TNumberOfLoads numberOfLoads = 100;
+    GridModel::TNumberOfLoads numberOfFeeders = 4;
+    GridModel::TParameter nominalVoltage = 240.0;
+    GridModel::TParameter impedance = 0.05;
+    GridModel::TLoadName namePrefix = "load";
+    std::vector<GridModel::TLoadName> loadNames;
+    bool acceptUnknownLoads = false;
+    LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::Warnings );
+
+    int option;
+    while ( ( option = getopt( argc, argv, "s:p:n:x:f:AF:V:z:l:L:q:i:vS:U:" ) ) != -1 )
+    {
+        switch ( option )
+        {
+            case 's':
+                configuration.serverAddress = optarg;
+                break;
+            case 'p':
+                configuration.serverPort = ( IPAddress::TPort )std::stoul( optarg );
+                break;
+            case 'U':
+                configuration.localPath = optarg;
+                break;
+            case 'S':
+                configuration.sharedMemoryName = optarg;
+                break;
+            case 'n':
+                numberOfLoads = ( GridModel::TNumberOfLoads )std::stoul( optarg );
+                break;
+            case 'x':
+                namePrefix = optarg;
+                break;
+            case 'f':
+            {
+                std::ifstream nameFile( optarg );
+                if ( !nameFile.is_open() )
+                {
+                    std::cerr << "Cannot open name file: " << optarg << std::endl;
+                    return ( EXIT_FAILURE );
+                }
+                GridModel::TLoadName name;
+                while ( std::getline( nameFile, name ) )
+                {
+                    if ( !name.empty() )
+                    {
+                        loadNames.push_back( name );
+                    }
+                }
+                break;
+            }
+            case 'A':
+                acceptUnknownLoads = true;
+                break;
+            case 'F':
+                numberOfFeeders = ( GridModel::TNumberOfLoads )std::stoul( optarg );
+                break;
+            case 'V':
+                nominalVoltage = std::stod( optarg );
+                break;
+            case 'z':
+                impedance = std::stod( optarg );
+                break;
+            case 'l':
+                configuration.solveLatency = ( OpenDSSEmulator::TMicroseconds )std::stoul( optarg );
+                break;
+            case 'L':
+                configuration.perLoadSolveLatency = ( OpenDSSEmulator::TMicroseconds )std::stoul( optarg );
+                break;
+            case 'q':
+                configuration.queryLatency = ( OpenDSSEmulator::TMicroseconds )std::stoul( optarg );
+                break;
+            case 'i':
+                configuration.reportInterval = std::stoull( optarg );
+                break;
+            case 'v':
+                LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::Logs );
+                break;
+            default:
+                PrintUsage( argv[0] );
+                return ( EXIT_FAILURE );
+        }
+    }
+
+    if ( loadNames.empty() )
+    {
+        for ( GridModel::TNumberOfLoads loadIndex = 1; loadIndex <= numberOfLoads; ++loadIndex )
+        {
+            loadNames.push_back( namePrefix + std::to_string( loadIndex ) );
+        }
+    }
+
+    GridModel gridModel( numberOfFeeders, nominalVoltage, impedance, acceptUnknownLoads );
+    gridModel.AddLoads( loadNames );
+    std::cout << "Grid with " << gridModel.GetNumberOfLoads() << " loads on " << numberOfFeeders << " feeders" << std::endl;
+
+    OpenDSSEmulator emulator( configuration, gridModel );
+    emulator.Run();
+    return ( EXIT_SUCCESS );
+}
@@ -0,0 +1,456 @@
+/**
+ * @file ReferenceController.cpp
+ * Implements the ReferenceController class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include "ReferenceController.h"
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <iostream>
+
+/**
+ *  Upper bound for the size of a received message, protecting against a corrupted stream.
+ */
+static const ReferenceController::TDataSize MaximumMessageSize = 64 * 1024 * 1024;
+
+/**
+ *  Scaling of the fixed point voltage deviations received from S2Sim.
+ */
+static const double VoltageScale = 32768.0;
+
+ReferenceController::ReferenceController( const Configuration & configuration ) : m_configuration( configuration ),
+                                                                                  m_randomGenerator( 0 ),
+                                                                                  m_numberOfDecisions( 0 ),
+                                                                                  m_numberOfPriceRequests( 0 ),
+                                                                                  m_numberOfNegotiations( 0 ),
+                                                                                  m_numberOfPartialDecisions( 0 ),
+                                                                                  m_numberOfSubstitutedClients( 0 ),
+                                                                                  m_controllerTime( TClock::duration::zero() ),
+                                                                                  m_simulatorTime( TClock::duration::zero() ),
+                                                                                  m_finishSent( false )
+{
+}
+
+bool
+ReferenceController::Connect( TCPClient & client )
+{
+    if ( !this->m_configuration.localPath.empty() )
+    {
+        return ( client.ConnectLocal( this->m_configuration.localPath + ".controller" ) );
+    }
+    if ( !this->m_configuration.sharedMemoryName.empty() )
+    {
+        return ( client.ConnectSharedMemory( "/" + this->m_configuration.sharedMemoryName + ".controller" ) );
+    }
+    IPAddress serverAddress;
+    in_addr_t address = inet_addr( this->m_configuration.serverAddress.c_str() );
+    if ( address == INADDR_NONE )
+    {
+        hostent* host = gethostbyname( this->m_configuration.serverAddress.c_str() );
+        if ( host == nullptr )
+        {
+            ErrorPrint( "Unknown server address: ", this->m_configuration.serverAddress );
+            return ( false );
+        }
+        memcpy( &address, host->h_addr_list[0], sizeof( address ) );
+    }
+    serverAddress.SetAddress( ntohl( address ) );
+    serverAddress.SetPort( this->m_configuration.serverPort );
+    return ( client.Connect( serverAddress ) );
+}
+
+bool
+ReferenceController::ReceiveAll( TCPClient & client, char* buffer, const size_t length )
+{
+    size_t receivedSize = 0;
+    while ( receivedSize < length )
+    {
+        TCPClient::TNumberOfBytes result = client.ReceiveData( buffer + receivedSize, length - receivedSize );
+        if ( result == 0 || result > length - receivedSize )
+        {
+            return ( false );
+        }
+        receivedSize += result;
+    }
+    return ( true );
+}
+
+void
+ReferenceController::AppendShort( const unsigned short value )
+{
+    unsigned short convertedValue = htons( value );
+    const char* valueAddress = ( const char* )&convertedValue;
+    this->m_outgoingBuffer.insert( this->m_outgoingBuffer.end(), valueAddress, valueAddress + sizeof( convertedValue ) );
+}
+
+void
+ReferenceController::AppendInteger( const unsigned int value )
+{
+    unsigned int convertedValue = htonl( value );
+    const char* valueAddress = ( const char* )&convertedValue;
+    this->m_outgoingBuffer.insert( this->m_outgoingBuffer.end(), valueAddress, valueAddress + sizeof( convertedValue ) );
+}
+
+void
+ReferenceController::BeginMessage( const TMessageType messageType )
+{
+    this->m_messageOffsets.push_back( this->m_outgoingBuffer.size() );
+    this->AppendInteger( messageType );
+}
+
+bool
+ReferenceController::Flush( TCPClient & client )
+{
+    this->m_messageOffsets.push_back( this->m_outgoingBuffer.size() );
+    size_t chunkStart = 0;
+    size_t messageIndex = 1;
+    while ( chunkStart < this->m_outgoingBuffer.size() )
+    {
+        size_t chunkEnd = this->m_messageOffsets[messageIndex++];
+        while ( messageIndex < this->m_messageOffsets.size() &&
+                this->m_messageOffsets[messageIndex] - chunkStart <= this->m_configuration.maximumChunkSize )
+        {
+            chunkEnd = this->m_messageOffsets[messageIndex++];
+        }
+
+        size_t sentSize = chunkStart;
+        while ( sentSize < chunkEnd )
+        {
+            TCPClient::TNumberOfBytes result = client.SendData( this->m_outgoingBuffer.data() + sentSize, chunkEnd - sentSize );
+            if ( result == 0 || result > chunkEnd - sentSize )
+            {
+                this->m_outgoingBuffer.clear();
+                this->m_messageOffsets.clear();
+                return ( false );
+            }
+            sentSize += result;
+        }
+        chunkStart = chunkEnd;
+    }
+    this->m_outgoingBuffer.clear();
+    this->m_messageOffsets.clear();
+    return ( true );
+}
+
+ReferenceController::TPrice
+ReferenceController::CalculatePrice( const ClientState & clientState, const TSystemTime time ) const
+{
+    if ( this->m_configuration.pricingPolicy == TimeOfUsePricing )
+    {
+        TSystemTime period = std::max( this->m_configuration.period, ( TSystemTime )1 );
+        return ( ( time % period ) * 3 >= period * 2 ? this->m_configuration.peakPrice : this->m_configuration.basePrice );
+    }
+    else if ( this->m_configuration.pricingPolicy == VoltagePricing )
+    {
+        double averageDeviation = 0.0;
+        if ( !clientState.deviations.empty() )
+        {
+            averageDeviation = std::accumulate( clientState.deviations.begin(), clientState.deviations.end(), 0.0 ) / clientState.deviations.size();
+        }
+        double newPrice = std::max( this->m_configuration.basePrice + this->m_configuration.priceGain * averageDeviation, 0.0 );
+        if ( clientState.price > 0 )
+        {
+            newPrice = std::min( newPrice, ( double )clientState.price + this->m_configuration.maximumPriceStep );
+            newPrice = std::max( newPrice, ( double )clientState.price - std::min( clientState.price, this->m_configuration.maximumPriceStep ) );
+        }
+        return ( ( TPrice )newPrice );
+    }
+    return ( this->m_configuration.basePrice );
+}
+
+void
+ReferenceController::Delay( const TNumberOfClients numberOfClients )
+{
+    TMicroseconds delay = this->m_configuration.decisionLatency + this->m_configuration.perClientLatency * numberOfClients;
+    if ( this->m_configuration.decisionJitter > 0 )
+    {
+        std::uniform_int_distribution<TMicroseconds> jitterDistribution( 0, this->m_configuration.decisionJitter );
+        delay += jitterDistribution( this->m_randomGenerator );
+    }
+    if ( delay > 0 )
+    {
+        std::this_thread::sleep_for( std::chrono::microseconds( delay ) );
+    }
+}
+
+bool
+ReferenceController::ProcessMakeDecision( const char* message, const size_t length, const bool finalDecision )
+{
+    const size_t headerSize = sizeof( TNumberOfClients ) + sizeof( TSystemMode ) + sizeof( TSystemTime );
+    if ( length < headerSize )
+    {
+        ErrorPrint( "Decision request too short: ", length );
+        return ( false );
+    }
+
+    TNumberOfClients numberOfClients;
+    memcpy( &numberOfClients, message, sizeof( TNumberOfClients ) );
+    numberOfClients = ntohs( numberOfClients );
+    TSystemTime systemTime;
+    memcpy( &systemTime, message + sizeof( TNumberOfClients ) + sizeof( TSystemMode ), sizeof( TSystemTime ) );
+    systemTime = ntohl( systemTime );
+
+    const char* currentAddress = message + headerSize;
+    const char* endAddress = message + length;
+    std::vector<TClientId> clientIds;
+    clientIds.reserve( numberOfClients );
+
+    for ( TNumberOfClients clientIndex = 0; clientIndex < numberOfClients; ++clientIndex )
+    {
+        if ( endAddress - currentAddress < ( ptrdiff_t )sizeof( TNumberOfDataPoints ) )
+        {
+            ErrorPrint( "Decision request truncated at client: ", clientIndex );
+            return ( false );
+        }
+        TNumberOfDataPoints numberOfDataPoints;
+        memcpy( &numberOfDataPoints, currentAddress, sizeof( TNumberOfDataPoints ) );
+        numberOfDataPoints = ntohl( numberOfDataPoints );
+        currentAddress += sizeof( TNumberOfDataPoints );
+
+        size_t clientSize = ( size_t )numberOfDataPoints * 2 * sizeof( TDataPoint ) + 2 * sizeof( TClientId );
+        if ( ( size_t )( endAddress - currentAddress ) < clientSize )
+        {
+            ErrorPrint( "Decision request truncated at client: ", clientIndex );
+            return ( false );
+        }
+
+        TDataPoint consumption = 0;
+        TDataPoint deviation = 0;
+        if ( numberOfDataPoints > 0 )
+        {
+            memcpy( &consumption, currentAddress, sizeof( TDataPoint ) );
+            memcpy( &deviation, currentAddress + sizeof( TDataPoint ), sizeof( TDataPoint ) );
+        }
+        currentAddress += numberOfDataPoints * 2 * sizeof( TDataPoint );
+
+        TClientId clientId;
+        memcpy( &clientId, currentAddress, sizeof( TClientId ) );
+        clientId = ntohs( clientId );
+        currentAddress += 2 * sizeof( TClientId );
+
+        ClientState & clientState = this->m_clients[clientId];
+        clientState.consumption = ntohl( consumption );
+        clientState.lastSeen = systemTime;
+        clientState.deviations.push_back( ( int )ntohl( deviation ) / VoltageScale );
+        if ( clientState.deviations.size() > this->m_configuration.windowSize )
+        {
+            clientState.deviations.erase( clientState.deviations.begin() );
+        }
+        clientIds.push_back( clientId );
+    }
+
+    /* The substituted clients follow the clients, only if S2Sim substitutes stragglers (-s). */
+    if ( ( size_t )( endAddress - currentAddress ) >= sizeof( TNumberOfClients ) )
+    {
+        TNumberOfClients numberOfSubstitutedClients;
+        memcpy( &numberOfSubstitutedClients, currentAddress, sizeof( TNumberOfClients ) );
+        this->m_numberOfSubstitutedClients += ntohs( numberOfSubstitutedClients );
+    }
+
+    /* Forget the clients that left, as S2Sim reuses no ids. */
+    for ( TClientStateMap::iterator client = this->m_clients.begin(); finalDecision && client != this->m_clients.end(); )
+    {
+        if ( client->second.lastSeen != systemTime )
+        {
+            client = this->m_clients.erase( client );
+        }
+        else
+        {
+            ++client;
+        }
+    }
+
+    this->Delay( numberOfClients );
+
+    for ( auto clientId : clientIds )
+    {
+        ClientState & clientState = this->m_clients[clientId];
+        this->BeginMessage( SetPriceType );
+        this->AppendShort( clientId );
+        this->AppendShort( clientId );
+        this->AppendInteger( this->m_configuration.numberOfPricePoints );
+        for ( TNumberOfPricePoints pricePoint = 0; pricePoint < this->m_configuration.numberOfPricePoints; ++pricePoint )
+        {
+            TPrice price = this->CalculatePrice( clientState, systemTime + pricePoint );
+            if ( pricePoint == 0 )
+            {
+                clientState.price = price;
+            }
+            this->AppendInteger( price );
+        }
+
+        if ( this->m_configuration.proposalInterval > 0 && systemTime % this->m_configuration.proposalInterval == 0 )
+        {
+            this->BeginMessage( SendPriceProposalType );
+            this->AppendShort( clientId );
+            this->AppendInteger( clientState.price );
+        }
+    }
+
+    if ( finalDecision )
+    {
+        ++this->m_numberOfDecisions;
+    }
+    else
+    {
+        ++this->m_numberOfPartialDecisions;
+    }
+    return ( true );
+}
+
+void
+ReferenceController::ProcessPriceRequest( const char* message, const size_t length )
+{
+    if ( length < sizeof( TClientId ) )
+    {
+        ErrorPrint( "Price request too short: ", length );
+        return;
+    }
+    TClientId clientId;
+    memcpy( &clientId, message, sizeof( TClientId ) );
+    clientId = ntohs( clientId );
+    ++this->m_numberOfPriceRequests;
+
+    TClientStateMap::const_iterator client = this->m_clients.find( clientId );
+    if ( client == this->m_clients.end() )
+    {
+        WarningPrint( "Price request of unknown client: ", clientId );
+        return;
+    }
+    this->BeginMessage( SetPriceType );
+    this->AppendShort( clientId );
+    this->AppendShort( clientId );
+    this->AppendInteger( 1 );
+    this->AppendInteger( client->second.price );
+}
+
+void
+ReferenceController::PrintReport( void )
+{
+    TClock::time_point now = TClock::now();
+    double elapsedSeconds = std::chrono::duration_cast<std::chrono::microseconds>( now - this->m_reportStartTime ).count() / 1e6;
+    std::cout << "Decisions: " << this->m_numberOfDecisions
+              << ", clients: " << this->m_clients.size()
+              << ", rate: " << ( elapsedSeconds > 0.0 ? this->m_configuration.reportInterval / elapsedSeconds : 0.0 ) << " ticks/s"
+              << ", S2Sim time: " << std::chrono::duration_cast<std::chrono::microseconds>( this->m_simulatorTime ).count() / this->m_configuration.reportInterval << " us/tick"
+              << ", controller time: " << std::chrono::duration_cast<std::chrono::microseconds>( this->m_controllerTime ).count() / this->m_configuration.reportInterval << " us/tick"
+              << ", price requests: " << this->m_numberOfPriceRequests
+              << ", negotiations: " << this->m_numberOfNegotiations
+              << ", partial decisions: " << this->m_numberOfPartialDecisions
+              << ", substituted clients: " << this->m_numberOfSubstitutedClients << std::endl;
+    this->m_simulatorTime = TClock::duration::zero();
+    this->m_controllerTime = TClock::duration::zero();
+    this->m_reportStartTime = now;
+}
+
+void
+ReferenceController::Run( void )
+{
+    std::vector<char> message;
+    while ( true )
+    {
+        SmartPointer<TCPClient> client = CreateObject<TCPClient>();
+        if ( !this->Connect( *client ) )
+        {
+            LogPrint( "No connection, retrying..." );
+            std::this_thread::sleep_for( std::chrono::seconds( 1 ) );
+            continue;
+        }
+        std::cout << "Connected to S2Sim" << std::endl;
+
+        /* S2Sim waits for a finished decision before its first time step. */
+        this->BeginMessage( DecisionFinishedType );
+        if ( !this->Flush( *client ) )
+        {
+            continue;
+        }
+        this->m_finishSent = false;
+        this->m_reportStartTime = TClock::now();
+
+        while ( true )
+        {
+            TDataSize messageSize;
+            if ( !this->ReceiveAll( *client, ( char* )&messageSize, sizeof( TDataSize ) ) )
+            {
+                break;
+            }
+            TClock::time_point receptionTime = TClock::now();
+            messageSize = ntohl( messageSize );
+            if ( messageSize < sizeof( TDataSize ) + sizeof( TMessageType ) || messageSize > MaximumMessageSize )
+            {
+                ErrorPrint( "Invalid message size: ", messageSize );
+                break;
+            }
+
+            message.resize( messageSize - sizeof( TDataSize ) );
+            if ( !this->ReceiveAll( *client, message.data(), message.size() ) )
+            {
+                break;
+            }
+
+            TMessageType messageType;
+            memcpy( &messageType, message.data(), sizeof( TMessageType ) );
+            messageType = ntohl( messageType );
+            const char* payload = message.data() + sizeof( TMessageType );
+            size_t payloadSize = message.size() - sizeof( TMessageType );
+
+            if ( messageType == MakeDecisionType )
+            {
+                if ( this->m_finishSent )
+                {
+                    this->m_simulatorTime += receptionTime - this->m_lastFinishTime;
+                }
+                if ( this->ProcessMakeDecision( payload, payloadSize, true ) && this->m_configuration.finishLatency > 0 )
+                {
+                    if ( !this->Flush( *client ) )
+                    {
+                        break;
+                    }
+                    std::this_thread::sleep_for( std::chrono::microseconds( this->m_configuration.finishLatency ) );
+                }
+                this->BeginMessage( DecisionFinishedType );
+                if ( !this->Flush( *client ) )
+                {
+                    break;
+                }
+                this->m_lastFinishTime = TClock::now();
+                this->m_finishSent = true;
+                this->m_controllerTime += this->m_lastFinishTime - receptionTime;
+
+                if ( this->m_configuration.reportInterval > 0 && this->m_numberOfDecisions % this->m_configuration.reportInterval == 0 )
+                {
+                    this->PrintReport();
+                }
+            }
+            else if ( messageType == PartialDecisionType )
+            {
+                this->ProcessMakeDecision( payload, payloadSize, false );
+                if ( !this->Flush( *client ) )
+                {
+                    break;
+                }
+            }
+            else if ( messageType == PriceRequestType )
+            {
+                this->ProcessPriceRequest( payload, payloadSize );
+                if ( !this->Flush( *client ) )
+                {
+                    break;
+                }
+            }
+            else if ( messageType == DemandNegotiationType )
+            {
+                LogPrint( "Demand negotiation received" );
+                ++this->m_numberOfNegotiations;
+            }
+            else
+            {
+                ErrorPrint( "Unknown Message Type received: ", messageType );
+            }
+        }
+        WarningPrint( "Connection to S2Sim lost, reconnecting" );
+    }
+}
@@ -0,0 +1,478 @@
+/**
+ * @file ReferenceController.h
+ * Defines the ReferenceController class.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#ifndef REFERENCECONTROLLER_H_
+#define REFERENCECONTROLLER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include "TCPClient.h"
+#include "IPAddress.h"
+#include "SmartPointer.hpp"
+
+/**
+ *  @brief Stand-in for ControlManagerBackup.m that answers the ControlManager protocol with simple pricing policies.
+
+    The controller connects to the control port of S2Sim, parses every MakeDecision frame, and replies with a SetPrice message for each synchronous client, optional price proposals and the DecisionFinished message that releases the next time step. The decision time of a real controller is reproduced with a configurable delay. The controller also measures the time S2Sim spends between releasing a time step and starting the next decision, which is the overhead of S2Sim itself.
+ */
+class ReferenceController
+{
+    public:
+    /**
+     *  Defines the message type. Must match ControlManager::TMessageType.
+     */
+        typedef unsigned int TMessageType;
+
+    /**
+     *  Message types of the ControlManager protocol.
+     */
+        enum MessageTypeValues
+        {
+            MakeDecisionType = 0x00000001, /**< Received at the beginning of a frame. */
+            DecisionFinishedType = 0x00000002, /**< Sent at the end of a frame. */
+            SetPriceType = 0x00000003, /**< Sent to set the price signal of a client. */
+            SendPriceProposalType = 0x00000004, /**< Sent to propose a price to a client. */
+            PriceRequestType = 0x00000005, /**< Received when a client requests its price. */
+            DemandNegotiationType = 0x00000006, /**< Received when a client answers a price proposal. */
+            PartialDecisionType = 0x00000007 /**< Received with the clients that reported early, in the layout of MakeDecisionType and answered without DecisionFinished. */
+        };
+
+    /**
+     *  Defines the size prefix of the received messages, which includes its own size.
+     */
+        typedef unsigned int TDataSize;
+
+    /**
+     *  Defines the client id type. Must match ControlManager::TClientId.
+     */
+        typedef unsigned short TClientId;
+
+    /**
+     *  Defines the number of clients type.
+     */
+        typedef unsigned short TNumberOfClients;
+
+    /**
+     *  Defines the system mode type.
+     */
+        typedef unsigned short TSystemMode;
+
+    /**
+     *  Defines the system time type.
+     */
+        typedef unsigned int TSystemTime;
+
+    /**
+     *  Defines the consumption and voltage data point type.
+     */
+        typedef unsigned int TDataPoint;
+
+    /**
+     *  Defines the number of data points type.
+     */
+        typedef unsigned int TNumberOfDataPoints;
+
+    /**
+     *  Defines the price type.
+     */
+        typedef unsigned int TPrice;
+
+    /**
+     *  Defines the number of price points type.
+     */
+        typedef unsigned int TNumberOfPricePoints;
+
+    /**
+     *  Defines the type for a delay in microseconds.
+     */
+        typedef unsigned int TMicroseconds;
+
+    /**
+     *  Defines the type for decision counters.
+     */
+        typedef unsigned long long TCounter;
+
+    /**
+     *  Defines the clock used for all measurements.
+     */
+        typedef std::chrono::steady_clock TClock;
+
+    /**
+     *  Defines the pricing policy type.
+     */
+        typedef unsigned char TPricingPolicy;
+
+    /**
+     *  Values of the pricing policy.
+     */
+        enum PricingPolicyValues
+        {
+            FixedPricing = ( TPricingPolicy )0x00, /**< Every client gets the base price. */
+            VoltagePricing = ( TPricingPolicy )0x01, /**< The price follows the averaged voltage deviation of the client, as in ControlManagerBackup.m. */
+            TimeOfUsePricing = ( TPricingPolicy )0x02 /**< The peak price is used in the last third of every period. */
+        };
+
+    /**
+     *  Run parameters of the controller.
+     */
+        struct Configuration
+        {
+            /**
+             *  Address of S2Sim.
+             */
+            std::string serverAddress;
+
+            /**
+             *  Control port of S2Sim.
+             */
+            IPAddress::TPort serverPort;
+
+            /**
+             *  Path given to S2Sim with -U, the Unix domain socket <path>.controller is used instead of TCP if it is not empty.
+             */
+            std::string localPath;
+
+            /**
+             *  Shared memory name given to S2Sim with -S, empty to connect through TCP.
+             */
+            std::string sharedMemoryName;
+
+            /**
+             *  Pricing policy of the decisions.
+             */
+            TPricingPolicy pricingPolicy;
+
+            /**
+             *  Price used by the fixed policy and as the offset of the other policies.
+             */
+            TPrice basePrice;
+
+            /**
+             *  Price used during the peak of the time of use policy.
+             */
+            TPrice peakPrice;
+
+            /**
+             *  Length of a time of use period in time steps.
+             */
+            TSystemTime period;
+
+            /**
+             *  Price increase per percent of averaged voltage deviation for the voltage policy.
+             */
+            double priceGain;
+
+            /**
+             *  Maximum price change between two decisions for the voltage policy.
+             */
+            TPrice maximumPriceStep;
+
+            /**
+             *  Number of time steps the voltage deviation is averaged over.
+             */
+            TNumberOfDataPoints windowSize;
+
+            /**
+             *  Number of price points sent with each price signal.
+             */
+            TNumberOfPricePoints numberOfPricePoints;
+
+            /**
+             *  A price proposal is sent to every client every this many decisions, 0 disables the proposals.
+             */
+            TSystemTime proposalInterval;
+
+            /**
+             *  Fixed delay of each decision.
+             */
+            TMicroseconds decisionLatency;
+
+            /**
+             *  Additional delay of each decision per client.
+             */
+            TMicroseconds perClientLatency;
+
+            /**
+             *  Maximum random delay added to each decision.
+             */
+            TMicroseconds decisionJitter;
+
+            /**
+             *  Delay between the sent prices and DecisionFinished, the work of the controller after its decision.
+             */
+            TMicroseconds finishLatency;
+
+            /**
+             *  Number of decisions between two printed reports, 0 disables the reports.
+             */
+            TCounter reportInterval;
+
+            /**
+             *  Largest chunk written to the socket at once. ControlManager treats each reception as complete messages, so chunks are split at message boundaries.
+             */
+            TDataSize maximumChunkSize;
+
+            /**
+             *  Sets the default parameters matching a local S2Sim instance.
+             */
+            Configuration( void ) : serverAddress( "127.0.0.1" ),
+                                    serverPort( 26997 ),
+                                    localPath(),
+                                    sharedMemoryName(),
+                                    pricingPolicy( FixedPricing ),
+                                    basePrice( 100 ),
+                                    peakPrice( 300 ),
+                                    period( 24 ),
+                                    priceGain( 50.0 ),
+                                    maximumPriceStep( 350 ),
+                                    windowSize( 20 ),
+                                    numberOfPricePoints( 1 ),
+                                    proposalInterval( 0 ),
+                                    decisionLatency( 0 ),
+                                    perClientLatency( 0 ),
+                                    decisionJitter( 0 ),
+                                    finishLatency( 0 ),
+                                    reportInterval( 0 ),
+                                    maximumChunkSize( 8192 )
+            {}
+        };
+
+    private:
+    /**
+     *  Information the controller keeps about each synchronous client.
+     */
+        struct ClientState
+        {
+            /**
+             *  Voltage deviations of the last decisions in percent.
+             */
+            std::vector<double> deviations;
+
+            /**
+             *  Last price sent to the client.
+             */
+            TPrice price;
+
+            /**
+             *  Consumption reported in the last decision.
+             */
+            TDataPoint consumption;
+
+            /**
+             *  Time of the last decision the client took part in.
+             */
+            TSystemTime lastSeen;
+
+            /**
+             *  Creates a client without history.
+             */
+            ClientState( void ) : price( 0 ), consumption( 0 ), lastSeen( 0 ) {}
+        };
+
+    /**
+     *  Defines the mapping from client ids to their state.
+     */
+        typedef std::map<TClientId, ClientState> TClientStateMap;
+
+    private:
+    /**
+     *  Run parameters.
+     */
+        Configuration m_configuration;
+
+    /**
+     *  State of the known clients.
+     */
+        TClientStateMap m_clients;
+
+    /**
+     *  Messages waiting to be sent.
+     */
+        std::vector<char> m_outgoingBuffer;
+
+    /**
+     *  Start offsets of the messages in the outgoing buffer.
+     */
+        std::vector<size_t> m_messageOffsets;
+
+    /**
+     *  Random generator for the decision jitter.
+     */
+        std::mt19937 m_randomGenerator;
+
+    /**
+     *  Number of decisions made.
+     */
+        TCounter m_numberOfDecisions;
+
+    /**
+     *  Number of price requests answered.
+     */
+        TCounter m_numberOfPriceRequests;
+
+    /**
+     *  Number of demand negotiations received.
+     */
+        TCounter m_numberOfNegotiations;
+
+    /**
+     *  Number of partial decisions made.
+     */
+        TCounter m_numberOfPartialDecisions;
+
+    /**
+     *  Number of client consumptions S2Sim substituted at the deadline.
+     */
+        TCounter m_numberOfSubstitutedClients;
+
+    /**
+     *  Total time between receiving a decision request and sending DecisionFinished.
+     */
+        TClock::duration m_controllerTime;
+
+    /**
+     *  Total time between sending DecisionFinished and receiving the next decision request.
+     */
+        TClock::duration m_simulatorTime;
+
+    /**
+     *  Time the last DecisionFinished message was sent.
+     */
+        TClock::time_point m_lastFinishTime;
+
+    /**
+     *  Whether m_lastFinishTime is valid.
+     */
+        bool m_finishSent;
+
+    /**
+     *  Start of the current report interval.
+     */
+        TClock::time_point m_reportStartTime;
+
+    private:
+    /**
+     *  Connects to S2Sim.
+     *
+     *  @param client Client to be connected.
+     *
+     *  @return Success of the connection.
+     */
+        bool
+        Connect( TCPClient & client );
+
+    /**
+     *  Receives exactly the requested number of bytes.
+     *
+     *  @param client Connected client.
+     *  @param buffer Buffer that will hold the data.
+     *  @param length Number of bytes to receive.
+     *
+     *  @return Success of the reception.
+     */
+        bool
+        ReceiveAll( TCPClient & client, char* buffer, const size_t length );
+
+    /**
+     *  Appends a 16 bit value in network byte order to the message being built.
+     *
+     *  @param value Value to be appended.
+     */
+        void
+        AppendShort( const unsigned short value );
+
+    /**
+     *  Appends a 32 bit value in network byte order to the message being built.
+     *
+     *  @param value Value to be appended.
+     */
+        void
+        AppendInteger( const unsigned int value );
+
+    /**
+     *  Marks the start of a new message in the outgoing buffer.
+     *
+     *  @param messageType Type of the new message.
+     */
+        void
+        BeginMessage( const TMessageType messageType );
+
+    /**
+     *  Sends the outgoing buffer in chunks split at message boundaries and clears it.
+     *
+     *  @param client Connected client.
+     *
+     *  @return Success of the transmission.
+     */
+        bool
+        Flush( TCPClient & client );
+
+    /**
+     *  Calculates the price of a client for a time step.
+     *
+     *  @param clientState State of the client.
+     *  @param time        Time step of the price.
+     *
+     *  @return Price for the time step.
+     */
+        TPrice
+        CalculatePrice( const ClientState & clientState, const TSystemTime time ) const;
+
+    /**
+     *  Parses a decision request and queues the prices and proposals. The clients missing from a partial decision request are kept.
+     *
+     *  @param message       Message without the size prefix.
+     *  @param length        Length of the message.
+     *  @param finalDecision Whether the request is the final MakeDecision of the time step.
+     *
+     *  @return False if the message is malformed.
+     */
+        bool
+        ProcessMakeDecision( const char* message, const size_t length, const bool finalDecision );
+
+    /**
+     *  Queues the current price of a client that requested it.
+     *
+     *  @param message Message without the size prefix.
+     *  @param length  Length of the message.
+     */
+        void
+        ProcessPriceRequest( const char* message, const size_t length );
+
+    /**
+     *  Waits for the configured decision time.
+     *
+     *  @param numberOfClients Number of clients in the decision.
+     */
+        void
+        Delay( const TNumberOfClients numberOfClients );
+
+    /**
+     *  Prints the decision rate and the time split between S2Sim and the controller.
+     */
+        void
+        PrintReport( void );
+
+    public:
+    /**
+     *  Stores the run parameters.
+     *
+     *  @param configuration Run parameters.
+     */
+        ReferenceController( const Configuration & configuration );
+
+    /**
+     *  Serves S2Sim until the process is terminated, reconnecting whenever the connection drops.
+     */
+        void
+        Run( void );
+};
+
+#endif /* REFERENCECONTROLLER_H_ */
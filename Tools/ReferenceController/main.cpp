@@ -0,0 +1,143 @@
+/**
+ * @file main.cpp
+ * Main file of the reference controller that serves the control port of S2Sim.
+ *  @date Oct 19, 2026
+ *  @author: Alper Sinan Akyurek
+ */
+
+#include <unistd.h>
+#include <iostream>
+#include "ReferenceController.h"
+#include "LogPrint.h"
+
+/**
+ *  Prints the command line options.
+ *
+ *  @param programName Name of the executable.
+ */
+static void
+PrintUsage( const char* programName )
+{
+    std::cerr << "Usage: " << programName << " [options]" << std::endl
+              << "  -s <address>  S2Sim address (default 127.0.0.1)" << std::endl
+              << "  -p <port>     S2Sim control port (default 26997)" << std::endl
+              << "  -U <path>     Connect through the Unix domain socket of S2Sim -U <path> instead of TCP" << std::endl
+              << "  -S <name>     Connect through the shared memory of S2Sim -S <name> instead of TCP" << std::endl
+              << "  -P <policy>   Pricing policy: fixed, voltage or tou (default fixed)" << std::endl
+              << "  -b <price>    Base price (default 100)" << std::endl
+              << "  -k <price>    Peak price of the tou policy (default 300)" << std::endl
+              << "  -T <ticks>    Period of the tou policy (default 24)" << std::endl
+              << "  -g <gain>     Price per percent voltage deviation of the voltage policy (default 50)" << std::endl
+              << "  -m <price>    Maximum price step of the voltage policy (default 350)" << std::endl
+              << "  -w <ticks>    Deviation averaging window of the voltage policy (default 20)" << std::endl
+              << "  -H <points>   Price points per price signal (default 1)" << std::endl
+              << "  -o <ticks>    Send a price proposal every this many ticks, 0 for none (default 0)" << std::endl
+              << "  -l <us>       Fixed decision delay (default 0)" << std::endl
+              << "  -L <us>       Additional decision delay per client (default 0)" << std::endl
+              << "  -j <us>       Maximum random decision delay (default 0)" << std::endl
+              << "  -F <us>       Delay between the sent prices and DecisionFinished (default 0)" << std::endl
+              << "  -c <bytes>    Largest write to the socket (default 8192)" << std::endl
+              << "  -i <count>    Decisions between printed reports, 0 for none (default 0)" << std::endl
+              << "  -v            Print all messages" << std::endl;
+}
+
+int
+main( int argc, char **argv )
+{
+    ReferenceController::Configuration configuration;
+    LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::Warnings );
+
+    int option;
+    while ( ( option = getopt( argc, argv, "s:p:P:b:k:T:g:m:w:H:o:l:L:j:F:c:i:vS:U:" ) ) != -1 )
+    {
+        switch ( option )
+        {
+            case 's':
+                configuration.serverAddress = optarg;
+                break;
+            case 'p':
+                configuration.serverPort = ( IPAddress::TPort )std::stoul( optarg );
+                break;
+            case 'U':
+                configuration.localPath = optarg;
+                break;
+            case 'S':
+                configuration.sharedMemoryName = optarg;
+                break;
+            case 'P':
+            {
+                std::string policy = optarg;
+                if ( policy == "fixed" )
+                {
+                    configuration.pricingPolicy = ReferenceController::FixedPricing;
+                }
+                else if ( policy == "voltage" )
+                {
+                    configuration.pricingPolicy = ReferenceController::VoltagePricing;
+                }
+                else if ( policy == "tou" )
+                {
+                    configuration.pricingPolicy = ReferenceController::TimeOfUsePricing;
+                }
+                else
+                {
+                    PrintUsage( argv[0] );
+                    return ( EXIT_FAILURE );
+                }
+                break;
+            }
+            case 'b':
+                configuration.basePrice = ( ReferenceController::TPrice )std::stoul( optarg );
+                break;
+            case 'k':
+                configuration.peakPrice = ( ReferenceController::TPrice )std::stoul( optarg );
+                break;
+            case 'T':
+                configuration.period = ( ReferenceController::TSystemTime )std::stoul( optarg );
+                break;
+            case 'g':
+                configuration.priceGain = std::stod( optarg );
+                break;
+            case 'm':
+                configuration.maximumPriceStep = ( ReferenceController::TPrice )std::stoul( optarg );
+                break;
+            case 'w':
+                configuration.windowSize = std::max( ( ReferenceController::TNumberOfDataPoints )std::stoul( optarg ), ( ReferenceController::TNumberOfDataPoints )1 );
+                break;
+            case 'H':
+                configuration.numberOfPricePoints = std::max( ( ReferenceController::TNumberOfPricePoints )std::stoul( optarg ), ( ReferenceController::TNumberOfPricePoints )1 );
+                break;
+            case 'o':
+                configuration.proposalInterval = ( ReferenceController::TSystemTime )std::stoul( optarg );
+                break;
+            case 'l':
+                configuration.decisionLatency = ( ReferenceController::TMicroseconds )std::stoul( optarg );
+                break;
+            case 'L':
+                configuration.perClientLatency = ( ReferenceController::TMicroseconds )std::stoul( optarg );
+                break;
+            case 'j':
+                configuration.decisionJitter = ( ReferenceController::TMicroseconds )std::stoul( optarg );
+                break;
+            case 'F':
+                configuration.finishLatency = ( ReferenceController::TMicroseconds )std::stoul( optarg );
+                break;
+            case 'c':
+                configuration.maximumChunkSize = ( ReferenceController::TDataSize )std::stoul( optarg );
+                break;
+            case 'i':
+                configuration.reportInterval = std::stoull( optarg );
+                break;
+            case 'v':
+                LogManager::GetLogManager().SetLogLevel( LogManager::LogLevel::Logs );
+                break;
+            default:
+                PrintUsage( argv[0] );
+                return ( EXIT_FAILURE );
+        }
+    }
+
+    ReferenceController controller( configuration );
+    controller.Run();
+    return ( EXIT_SUCCESS );
+}